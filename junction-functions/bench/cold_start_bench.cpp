@@ -0,0 +1,177 @@
+// Cold-start comparison: raw ONNX export vs. pre-optimized ORT artifact.
+//
+// Every trial is a fresh process (this binary re-executed in --load mode), so the
+// numbers include loading libonnxruntime and creating the Env, as a function cold
+// start would. Two timings are reported per trial:
+//   process  fork to "session ready", measured by the parent
+//   session  Ort::Session construction alone, measured by the child
+#include <onnxruntime_cxx_api.h>
+
+#include "../common/model_cache.h"
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+double ms_since(Clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+}
+
+// Child side: build a session the way the function binaries do and report its cost.
+int load_once(const std::string& model) {
+    Ort::Env env(ORT_LOGGING_LEVEL_WARNING, "cold_start_bench");
+    Ort::SessionOptions opts;
+    opts.SetIntraOpNumThreads(1);
+    configure_model_load(opts, model);
+    auto t0 = Clock::now();
+    Ort::Session session(env, model.c_str(), opts);
+    std::printf("%.3f\n", ms_since(t0));
+    return 0;
+}
+
+struct Trial {
+    double process_ms;
+    double session_ms;
+};
+
+Trial spawn_load(const std::string& self, const std::string& model) {
+    int fds[2];
+    if (pipe(fds) != 0) throw std::runtime_error("pipe failed");
+    auto t0 = Clock::now();
+    pid_t pid = fork();
+    if (pid < 0) throw std::runtime_error("fork failed");
+    if (pid == 0) {
+        dup2(fds[1], STDOUT_FILENO);
+        close(fds[0]);
+        close(fds[1]);
+        execl(self.c_str(), self.c_str(), "--load", model.c_str(), static_cast<char*>(nullptr));
+        _exit(127);
+    }
+    close(fds[1]);
+    std::string out;
+    char buf[64];
+    ssize_t n;
+    while ((n = read(fds[0], buf, sizeof(buf))) > 0) {
+        out.append(buf, static_cast<size_t>(n));
+        if (out.find('\n') != std::string::npos) break;
+    }
+    const double process_ms = ms_since(t0);
+    close(fds[0]);
+    int status = 0;
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0 || out.empty()) {
+        throw std::runtime_error("loading " + model + " failed");
+    }
+    return {process_ms, std::stod(out)};
+}
+
+double percentile(std::vector<double> v, double q) {
+    std::sort(v.begin(), v.end());
+    return v[static_cast<size_t>(q * static_cast<double>(v.size() - 1) + 0.5)];
+}
+
+struct Summary {
+    double process_p50, process_p90, session_p50, session_p90;
+};
+
+Summary measure(const std::string& self, const std::string& model, int runs) {
+    std::vector<double> process, session;
+    spawn_load(self, model);  // page the model file in; every mode then reads from page cache
+    for (int i = 0; i < runs; ++i) {
+        Trial t = spawn_load(self, model);
+        process.push_back(t.process_ms);
+        session.push_back(t.session_ms);
+    }
+    return {percentile(process, 0.5), percentile(process, 0.9),
+            percentile(session, 0.5), percentile(session, 0.9)};
+}
+
+// Compile in a child too: the parent never initializes ORT, so forked trials
+// start from a clean process.
+std::string compile_in_child(const std::string& self, const std::string& model, const std::string& cache_dir) {
+    int fds[2];
+    if (pipe(fds) != 0) throw std::runtime_error("pipe failed");
+    pid_t pid = fork();
+    if (pid < 0) throw std::runtime_error("fork failed");
+    if (pid == 0) {
+        dup2(fds[1], STDOUT_FILENO);
+        close(fds[0]);
+        close(fds[1]);
+        execl(self.c_str(), self.c_str(), "--compile", model.c_str(), cache_dir.c_str(),
+              static_cast<char*>(nullptr));
+        _exit(127);
+    }
+    close(fds[1]);
+    std::string out;
+    char buf[256];
+    ssize_t n;
+    while ((n = read(fds[0], buf, sizeof(buf))) > 0) out.append(buf, static_cast<size_t>(n));
+    close(fds[0]);
+    int status = 0;
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) throw std::runtime_error("compiling " + model + " failed");
+    while (!out.empty() && out.back() == '\n') out.pop_back();
+    return out;
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        if (argc == 3 && std::string(argv[1]) == "--load") return load_once(argv[2]);
+        if (argc == 4 && std::string(argv[1]) == "--compile") {
+            Ort::Env env(ORT_LOGGING_LEVEL_WARNING, "cold_start_bench");
+            std::printf("%s\n", compile_optimized_model(env, argv[2], argv[3]).path.c_str());
+            return 0;
+        }
+
+        int runs = 10;
+        std::string cache_dir = "model_cache";
+        std::vector<std::string> models;
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (arg == "--runs" && i + 1 < argc) {
+                runs = std::max(1, std::stoi(argv[++i]));
+            } else if (arg == "--cache-dir" && i + 1 < argc) {
+                cache_dir = argv[++i];
+            } else {
+                models.push_back(arg);
+            }
+        }
+        if (models.empty()) {
+            std::cerr << "Usage: " << argv[0] << " model.onnx [model.onnx ...] [--runs 10] [--cache-dir model_cache]\n"
+                      << "Example: " << argv[0] << " distilbert.onnx distilgpt2.onnx gpt2.onnx\n";
+            return 1;
+        }
+
+        const std::string self = "/proc/self/exe";
+        std::printf("%-20s %-10s %12s %12s %12s %12s\n", "model", "mode", "process_p50", "process_p90",
+                    "session_p50", "session_p90");
+        for (const auto& model : models) {
+            const std::string artifact = compile_in_child(self, model, cache_dir);
+            Summary raw = measure(self, model, runs);
+            Summary opt = measure(self, artifact, runs);
+            const std::string name = model.substr(model.find_last_of('/') + 1);
+            std::printf("%-20s %-10s %12.1f %12.1f %12.1f %12.1f\n", name.c_str(), "raw", raw.process_p50,
+                        raw.process_p90, raw.session_p50, raw.session_p90);
+            std::printf("%-20s %-10s %12.1f %12.1f %12.1f %12.1f\n", name.c_str(), "optimized", opt.process_p50,
+                        opt.process_p90, opt.session_p50, opt.session_p90);
+            std::printf("%-20s %-10s %11.2fx %12s %11.2fx\n", name.c_str(), "speedup",
+                        raw.process_p50 / opt.process_p50, "", raw.session_p50 / opt.session_p50);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,101 @@
+// Gateway request-path microbenchmarks: what /infer does to a body before any
+// inference runs.
+//
+//   ./gateway_bench --benchmark_format=json --benchmark_out=gateway.json
+//
+// The argument is the token count of the body, spanning the trace's small to xl
+// requests after tokenization.
+#include "infer_request.h"
+#include "../../junctiond/metrics.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+using json = nlohmann::json;
+
+namespace {
+// Body as test/latency_test.py sends it.
+std::string make_body(int64_t tokens) {
+    json body;
+    std::vector<int64_t> ids(static_cast<size_t>(tokens)), mask(static_cast<size_t>(tokens), 1);
+    for (int64_t i = 0; i < tokens; ++i) ids[static_cast<size_t>(i)] = 1000 + (i * 7919) % 29000;
+    ids.front() = 101;
+    ids.back() = 102;
+    body["input_ids"] = ids;
+    body["attention_mask"] = mask;
+    body["bucket"] = "medium";
+    body["timestamp"] = "2024-05-12 00:00:00.041683+00:00";
+    return body.dump();
+}
+
+void BM_ParseBody(benchmark::State& state) {
+    const std::string body = make_body(state.range(0));
+    for (auto _ : state) {
+        json j = json::parse(body);
+        benchmark::DoNotOptimize(j);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(body.size()));
+}
+
+// Parse, validate and copy out: everything the handler does before dispatching.
+void BM_ParseAndReadTokens(benchmark::State& state) {
+    const std::string body = make_body(state.range(0));
+    std::vector<int64_t> ids, mask;
+    for (auto _ : state) {
+        json j = json::parse(body);
+        if (check_token_arrays(j)) state.SkipWithError("body rejected");
+        read_token_arrays(j, ids, mask);
+        benchmark::DoNotOptimize(ids.data());
+        benchmark::DoNotOptimize(mask.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Cold path only: token arrays to the command-line form distilbert_infer takes.
+void BM_ToSpaceSeparated(benchmark::State& state) {
+    const json j = json::parse(make_body(state.range(0)));
+    std::vector<int64_t> ids, mask;
+    read_token_arrays(j, ids, mask);
+    for (auto _ : state) {
+        std::string ids_str = to_space_separated(ids);
+        std::string mask_str = to_space_separated(mask);
+        benchmark::DoNotOptimize(ids_str.data());
+        benchmark::DoNotOptimize(mask_str.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+
+// The response the gateway re-serializes after a run.
+void BM_DumpResponse(benchmark::State& state) {
+    json resp{{"logits", {-2.1875, 2.3671875}}, {"probs", {0.0111, 0.9889}}, {"label", "positive"}};
+    for (auto _ : state) {
+        std::string out = resp.dump();
+        benchmark::DoNotOptimize(out.data());
+    }
+}
+// What every /infer pays for /metrics: the request scope (in-flight up and down,
+// duration, status counter) plus one histogram observation. The scope's two
+// steady_clock reads dominate; each counter or histogram update is a single
+// relaxed add on the thread's own shard, which the thread range checks.
+void BM_RecordMetrics(benchmark::State& state) {
+    static metrics::RequestMetrics request_metrics(metrics::Registry::global(), "bench");
+    static metrics::Histogram& latency = metrics::Registry::global().histogram("bench_exec_seconds", "bench");
+    int status = 200;
+    double v = 1e-4;
+    for (auto _ : state) {
+        metrics::RequestMetrics::Scope measured(request_metrics, status);
+        latency.observe(v);
+        v += 1e-7;
+    }
+}
+}  // namespace
+
+BENCHMARK(BM_ParseBody)->Arg(64)->Arg(256)->Arg(512)->Arg(2048)->Arg(8000);
+BENCHMARK(BM_ParseAndReadTokens)->Arg(64)->Arg(256)->Arg(512)->Arg(2048)->Arg(8000);
+BENCHMARK(BM_ToSpaceSeparated)->Arg(64)->Arg(256)->Arg(512)->Arg(2048)->Arg(8000);
+BENCHMARK(BM_DumpResponse);
+BENCHMARK(BM_RecordMetrics)->ThreadRange(1, 8);
+
+BENCHMARK_MAIN();
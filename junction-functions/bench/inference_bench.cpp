@@ -0,0 +1,147 @@
+// Model-level microbenchmarks: one DistilBERT classification per length bucket and
+// one GPT-2 decode step at several context lengths.
+//
+//   export DISTILBERT_ONNX=distilbert.onnx GPT2_ONNX=gpt2.onnx
+//   ./inference_bench --benchmark_format=json --benchmark_out=inference.json
+//
+// A model whose variable is unset is reported as skipped rather than failing the
+// run. ORT is limited to one intra-op thread so the numbers track kernel cost, not
+// how many cores the runner happened to have.
+#include <onnxruntime_cxx_api.h>
+
+#include "../common/gpt2_decoder.h"
+#include "../common/model_cache.h"
+#include "../common/sampling.h"
+#include "../distilbert/infer_arena.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+Ort::Env& env() {
+    static Ort::Env instance(ORT_LOGGING_LEVEL_WARNING, "inference_bench");
+    return instance;
+}
+
+// Session for $var, created on first use; nullptr if the variable is unset.
+Ort::Session* session_from_env(const char* var) {
+    static std::vector<std::pair<std::string, std::unique_ptr<Ort::Session>>> sessions;
+    for (auto& [name, s] : sessions) {
+        if (name == var) return s.get();
+    }
+    const char* path = std::getenv(var);
+    std::unique_ptr<Ort::Session> session;
+    if (path) {
+        Ort::SessionOptions opts;
+        opts.SetIntraOpNumThreads(1);
+        opts.SetInterOpNumThreads(1);
+        configure_model_load(opts, path);
+        session = std::make_unique<Ort::Session>(env(), path, opts);
+    }
+    sessions.emplace_back(var, std::move(session));
+    return sessions.back().second.get();
+}
+
+void fill_tokens(int64_t* ids, int64_t* mask, int64_t len) {
+    for (int64_t t = 0; t < len; ++t) {
+        ids[t] = 1000 + (t * 7919) % 29000;
+        mask[t] = 1;
+    }
+    ids[0] = 101;
+    ids[len - 1] = 102;
+}
+
+// The warm path: distilbert_service's per-worker arena (pre-bound buffers).
+void BM_DistilbertArena(benchmark::State& state) {
+    Ort::Session* session = session_from_env("DISTILBERT_ONNX");
+    if (!session) {
+        state.SkipWithError("DISTILBERT_ONNX not set");
+        return;
+    }
+    static InferArena arena(*session);
+    const int64_t len = state.range(0);
+    for (auto _ : state) {
+        InferArena::Inputs in = arena.prepare(len);
+        fill_tokens(in.ids, in.mask, len);
+        benchmark::DoNotOptimize(arena.run());
+    }
+    state.SetItemsProcessed(state.iterations() * len);
+}
+
+// The cold path: fresh tensors and ORT-allocated outputs per call, as
+// distilbert_infer does.
+void BM_DistilbertTensorRun(benchmark::State& state) {
+    Ort::Session* session = session_from_env("DISTILBERT_ONNX");
+    if (!session) {
+        state.SkipWithError("DISTILBERT_ONNX not set");
+        return;
+    }
+    static const char* input_names[] = {"input_ids", "attention_mask"};
+    static const char* output_names[] = {"logits"};
+    const int64_t len = state.range(0);
+    std::vector<int64_t> ids(static_cast<size_t>(len)), mask(static_cast<size_t>(len));
+    fill_tokens(ids.data(), mask.data(), len);
+    const std::array<int64_t, 2> shape{1, len};
+    for (auto _ : state) {
+        Ort::MemoryInfo mem = Ort::MemoryInfo::CreateCpu(OrtDeviceAllocator, OrtMemTypeCPU);
+        std::array<Ort::Value, 2> inputs{
+            Ort::Value::CreateTensor<int64_t>(mem, ids.data(), ids.size(), shape.data(), shape.size()),
+            Ort::Value::CreateTensor<int64_t>(mem, mask.data(), mask.size(), shape.data(), shape.size())};
+        auto outputs = session->Run(Ort::RunOptions{nullptr}, input_names, inputs.data(), inputs.size(),
+                                    output_names, 1);
+        benchmark::DoNotOptimize(outputs.front().GetTensorData<float>());
+    }
+    state.SetItemsProcessed(state.iterations() * len);
+}
+
+// One generated token (forward pass + greedy argmax) with `past` tokens already
+// in the KV cache.
+void BM_Gpt2DecodeStep(benchmark::State& state) {
+    Ort::Session* session = session_from_env("GPT2_ONNX");
+    if (!session) {
+        state.SkipWithError("GPT2_ONNX not set");
+        return;
+    }
+    const int64_t past = state.range(0);
+    constexpr int64_t kSteps = 64;  // decoded before the cache is rewound to `past`
+    Gpt2Decoder decoder(*session, past + kSteps + 1);
+    std::vector<int64_t> prompt(static_cast<size_t>(past));
+    for (int64_t t = 0; t < past; ++t) prompt[static_cast<size_t>(t)] = (t * 7919) % 50000;
+    const int64_t vocab = decoder.dims().vocab_size;
+    int64_t token = sampling::argmax(decoder.prefill(prompt), vocab);
+    for (auto _ : state) {
+        if (decoder.cache().length() >= past + kSteps) {
+            state.PauseTiming();
+            decoder.cache().truncate(past);
+            state.ResumeTiming();
+        }
+        token = sampling::argmax(decoder.step(&token, 1), vocab);
+        benchmark::DoNotOptimize(token);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void register_all() {
+    for (auto* b : {benchmark::RegisterBenchmark("distilbert_arena", BM_DistilbertArena),
+                    benchmark::RegisterBenchmark("distilbert_tensor_run", BM_DistilbertTensorRun)}) {
+        for (int64_t len : default_length_buckets()) b->Arg(len);
+        b->ArgName("len")->Unit(benchmark::kMillisecond);
+    }
+    benchmark::RegisterBenchmark("gpt2_decode_step", BM_Gpt2DecodeStep)
+        ->Arg(1)->Arg(128)->Arg(512)->ArgName("past")->Unit(benchmark::kMillisecond);
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    register_all();
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
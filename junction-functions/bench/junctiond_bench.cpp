@@ -0,0 +1,124 @@
+// JunctionD control-path microbenchmark: spawn an instance, collect its output,
+// remove it.
+//
+//   ./junctiond_bench --benchmark_format=json --benchmark_out=junctiond.json
+//
+// No Junction install is needed. JunctionD launches $HOME/junction/build/junction/
+// junction_run, so the benchmark points HOME at a scratch directory where that
+// path is a symlink back to this binary. Invoked that way it drops the config and
+// "--" arguments and execs the function, which is this binary again in
+// --stub-function mode: print READY and a result line, exit. What is left is
+// JunctionD's own cost (config file, pipes, fork, two execs, reaping).
+#include "junctiond.h"
+
+#include <benchmark/benchmark.h>
+
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+// JunctionD logs every spawn to stdout; keep that out of the benchmark report.
+class QuietCout {
+public:
+    QuietCout() : saved_(std::cout.rdbuf(&null_)) {}
+    ~QuietCout() { std::cout.rdbuf(saved_); }
+
+private:
+    struct NullBuf : std::streambuf {
+        int overflow(int c) override { return c; }
+    } null_;
+    std::streambuf* saved_;
+};
+
+JunctionD& daemon() {
+    static JunctionD jd;
+    return jd;
+}
+
+void BM_SpawnCollect(benchmark::State& state) {
+    QuietCout quiet;
+    FunctionData func{};
+    func.execpath = fs::read_symlink("/proc/self/exe").string();
+    func.args = "--stub-function";
+    func.cpu = 1;
+    func.memoryMB = 128;
+    uint64_t n = 0;
+    for (auto _ : state) {
+        func.name = "bench" + std::to_string(n++);
+        if (!daemon().spawn(func)) {
+            state.SkipWithError("spawn failed");
+            break;
+        }
+        JobResult result = daemon().collect(func.name);
+        state.PauseTiming();
+        daemon().remove(func.name);
+        if (result.output.find("READY") == std::string::npos) {
+            state.SkipWithError(("unexpected instance output: " + result.output).c_str());
+            break;
+        }
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_SpawnCollect)->Unit(benchmark::kMillisecond)->UseRealTime();
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc >= 2 && std::strcmp(argv[1], "--stub-function") == 0) {
+        std::cout << "READY\n{\"label\":\"positive\"}" << std::endl;
+        return 0;
+    }
+    if (argc >= 4 && std::strcmp(argv[2], "--") == 0) {
+        // Standing in for junction_run: argv = [junction_run, config, --, function, args...].
+        execv(argv[3], argv + 3);
+        std::cerr << "junctiond_bench: exec " << argv[3] << " failed: " << std::strerror(errno) << "\n";
+        return 127;
+    }
+
+    char dir_template[] = "/tmp/junctiond_bench.XXXXXX";
+    const char* scratch = mkdtemp(dir_template);
+    if (!scratch) {
+        std::cerr << "junctiond_bench: mkdtemp failed: " << std::strerror(errno) << "\n";
+        return 1;
+    }
+    const fs::path run_dir = fs::path(scratch) / "junction/build/junction";
+    fs::create_directories(run_dir);
+    fs::create_symlink(fs::read_symlink("/proc/self/exe"), run_dir / "junction_run");
+    setenv("HOME", scratch, 1);
+    // JunctionD writes its per-instance config directories into the cwd, so run
+    // from the scratch directory; a relative --benchmark_out must not follow us.
+    const fs::path cwd = fs::current_path();
+    std::vector<std::string> args(argv, argv + argc);
+    std::vector<char*> arg_ptrs;
+    for (std::string& a : args) {
+        const std::string flag = "--benchmark_out=";
+        if (a.compare(0, flag.size(), flag) == 0) a = flag + fs::absolute(a.substr(flag.size())).string();
+        arg_ptrs.push_back(a.data());
+    }
+    argc = static_cast<int>(arg_ptrs.size());
+    argv = arg_ptrs.data();
+    fs::current_path(scratch);
+
+    benchmark::Initialize(&argc, argv);
+    int rc = 0;
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        rc = 1;
+    } else {
+        benchmark::RunSpecifiedBenchmarks();
+    }
+    benchmark::Shutdown();
+    fs::current_path(cwd);
+    fs::remove_all(scratch);
+    return rc;
+}
@@ -0,0 +1,347 @@
+// Offline sweep of serverless keep-alive, pre-warming and replica policies.
+//
+// Replays an invocation trace (the Azure trace as data/preprocess_trace.py writes
+// it, see common/trace_file.h) through the discrete-event model in
+// common/serverless_sim.h once per policy configuration. Every combination of
+// the list-valued flags is one configuration, and they run in parallel. Each row
+// of the output CSV is one configuration with its cold-start rate, latency
+// percentiles and memory-seconds. The configurations that no other beats on both
+// p99 and memory are printed at the end.
+//
+// The cost model comes from measurements:
+//   --calibrate-warm  test/results CSVs of warm runs (latency_test_warm.py,
+//                     trace_replay): per-bucket service time samples.
+//   --calibrate-cold  CSVs of cold runs (latency_test.py): latency minus the
+//                     bucket's median warm service time gives cold start samples.
+// Without them --service and --cold-start set fixed values. The defaults are
+// placeholders, not measurements.
+#include "../common/serverless_sim.h"
+#include "../common/trace_file.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+struct Config {
+    std::string trace_path;
+    double scale_time = 1.0;
+    long limit = -1;
+    std::string out_path = "policy_sweep.csv";
+    std::vector<std::string> warm_csvs;
+    std::vector<std::string> cold_csvs;
+    bool include_errors = false;
+    std::map<std::string, double> service = {{"small", 0.03}, {"medium", 0.05}, {"large", 0.1}, {"xl", 0.2}};
+    double cold_start = 0.7;
+    double instance_memory_mb = 400.0;
+    double host_memory_mb = 0.0;
+    int threads = 0;
+    uint64_t seed = 1;
+
+    // Swept: every combination is one run.
+    std::vector<std::string> modes = {"fixed"};
+    std::vector<double> keep_alive = {0, 10, 60, 300, 600};
+    std::vector<double> idle_percentile = {99};
+    std::vector<double> min_warm = {0, 1};
+    std::vector<double> max_replicas = {0};
+    std::vector<double> concurrency = {1};
+    std::vector<double> cores = {8};
+    std::vector<double> cores_per_instance = {1};
+};
+
+std::vector<std::string> split(const std::string& text, char sep) {
+    std::vector<std::string> out;
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, sep)) {
+        if (!item.empty()) out.push_back(item);
+    }
+    return out;
+}
+
+std::vector<double> parse_list(const std::string& text, const std::string& flag) {
+    std::vector<double> out;
+    for (const std::string& item : split(text, ',')) out.push_back(std::stod(item));
+    if (out.empty()) throw std::runtime_error(flag + " needs a comma separated list of numbers");
+    return out;
+}
+
+Config parse_args(int argc, char* argv[]) {
+    Config cfg;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--trace" && i + 1 < argc) {
+            cfg.trace_path = argv[++i];
+        } else if (arg == "--scale-time" && i + 1 < argc) {
+            cfg.scale_time = std::stod(argv[++i]);
+        } else if (arg == "--limit" && i + 1 < argc) {
+            cfg.limit = std::stol(argv[++i]);
+        } else if (arg == "--out" && i + 1 < argc) {
+            cfg.out_path = argv[++i];
+        } else if (arg == "--calibrate-warm" && i + 1 < argc) {
+            cfg.warm_csvs = split(argv[++i], ',');
+        } else if (arg == "--calibrate-cold" && i + 1 < argc) {
+            cfg.cold_csvs = split(argv[++i], ',');
+        } else if (arg == "--include-errors") {
+            cfg.include_errors = true;
+        } else if (arg == "--service" && i + 1 < argc) {
+            cfg.service.clear();
+            for (const std::string& kv : split(argv[++i], ',')) {
+                const size_t eq = kv.find('=');
+                if (eq == std::string::npos) throw std::runtime_error("--service takes bucket=seconds pairs");
+                cfg.service[kv.substr(0, eq)] = std::stod(kv.substr(eq + 1));
+            }
+        } else if (arg == "--cold-start" && i + 1 < argc) {
+            cfg.cold_start = std::stod(argv[++i]);
+        } else if (arg == "--instance-mem-mb" && i + 1 < argc) {
+            cfg.instance_memory_mb = std::stod(argv[++i]);
+        } else if (arg == "--host-mem-mb" && i + 1 < argc) {
+            cfg.host_memory_mb = std::stod(argv[++i]);
+        } else if (arg == "--threads" && i + 1 < argc) {
+            cfg.threads = std::stoi(argv[++i]);
+        } else if (arg == "--seed" && i + 1 < argc) {
+            cfg.seed = std::stoull(argv[++i]);
+        } else if (arg == "--keep-alive-mode" && i + 1 < argc) {
+            cfg.modes = split(argv[++i], ',');
+            for (const std::string& m : cfg.modes) {
+                if (m != "fixed" && m != "adaptive") throw std::runtime_error("--keep-alive-mode: fixed or adaptive");
+            }
+        } else if (arg == "--keep-alive" && i + 1 < argc) {
+            cfg.keep_alive = parse_list(argv[++i], arg);
+        } else if (arg == "--idle-percentile" && i + 1 < argc) {
+            cfg.idle_percentile = parse_list(argv[++i], arg);
+        } else if (arg == "--min-warm" && i + 1 < argc) {
+            cfg.min_warm = parse_list(argv[++i], arg);
+        } else if (arg == "--max-replicas" && i + 1 < argc) {
+            cfg.max_replicas = parse_list(argv[++i], arg);
+        } else if (arg == "--concurrency" && i + 1 < argc) {
+            cfg.concurrency = parse_list(argv[++i], arg);
+        } else if (arg == "--cores" && i + 1 < argc) {
+            cfg.cores = parse_list(argv[++i], arg);
+        } else if (arg == "--cores-per-instance" && i + 1 < argc) {
+            cfg.cores_per_instance = parse_list(argv[++i], arg);
+        } else {
+            throw std::runtime_error("Unknown or incomplete argument: " + arg);
+        }
+    }
+    if (cfg.trace_path.empty()) throw std::runtime_error("--trace is required");
+    if (!cfg.cold_csvs.empty() && cfg.warm_csvs.empty() && cfg.service.empty()) {
+        throw std::runtime_error("--calibrate-cold needs --calibrate-warm or --service to subtract");
+    }
+    return cfg;
+}
+
+// bucket -> latency_s of the usable rows of test/results-style CSVs.
+std::map<std::string, std::vector<double>> read_latencies(const std::vector<std::string>& paths, bool include_errors) {
+    std::map<std::string, std::vector<double>> out;
+    for (const std::string& path : paths) {
+        std::ifstream in(path);
+        if (!in) throw std::runtime_error("cannot open " + path);
+        std::string line;
+        if (!std::getline(in, line)) throw std::runtime_error(path + " is empty");
+        const std::vector<std::string> header = split_csv_line(line);
+        auto column = [&](const char* name) {
+            auto it = std::find(header.begin(), header.end(), name);
+            if (it == header.end()) throw std::runtime_error(path + " has no " + name + " column");
+            return static_cast<size_t>(it - header.begin());
+        };
+        const size_t bucket_col = column("bucket"), status_col = column("status"), latency_col = column("latency_s");
+        size_t used = 0, skipped = 0;
+        while (std::getline(in, line)) {
+            const std::vector<std::string> f = split_csv_line(line);
+            if (f.size() <= std::max({bucket_col, status_col, latency_col}) || f[latency_col].empty()) continue;
+            const bool ok = f[status_col].size() == 3 && f[status_col][0] == '2';
+            if (!ok && !include_errors) {
+                ++skipped;
+                continue;
+            }
+            out[f[bucket_col]].push_back(std::stod(f[latency_col]));
+            ++used;
+        }
+        std::cout << "policy_sim: " << path << ": " << used << " rows";
+        if (skipped) std::cout << " (" << skipped << " non-2xx skipped; --include-errors keeps them)";
+        std::cout << "\n";
+    }
+    return out;
+}
+
+double median(std::vector<double> v) {
+    std::nth_element(v.begin(), v.begin() + static_cast<long>(v.size() / 2), v.end());
+    return v[v.size() / 2];
+}
+
+SimModel build_model(const Config& cfg) {
+    SimModel model;
+    model.instance_memory_mb = cfg.instance_memory_mb;
+    std::map<std::string, std::vector<double>> service;
+    if (!cfg.warm_csvs.empty()) {
+        service = read_latencies(cfg.warm_csvs, cfg.include_errors);
+    } else {
+        for (const auto& [bucket, s] : cfg.service) service[bucket] = {s};
+    }
+    for (auto& [bucket, samples] : service) {
+        if (samples.empty()) continue;
+        model.buckets.push_back(bucket);
+        model.service_s.push_back(std::move(samples));
+    }
+
+    if (cfg.cold_csvs.empty()) {
+        model.cold_start_s = {cfg.cold_start};
+        return model;
+    }
+    for (const auto& [bucket, samples] : read_latencies(cfg.cold_csvs, cfg.include_errors)) {
+        auto it = std::find(model.buckets.begin(), model.buckets.end(), bucket);
+        if (it == model.buckets.end()) {
+            std::cerr << "policy_sim: no warm service time for bucket '" << bucket << "'; its cold rows are unused\n";
+            continue;
+        }
+        const double warm = median(model.service_s[static_cast<size_t>(it - model.buckets.begin())]);
+        for (double s : samples) model.cold_start_s.push_back(std::max(0.0, s - warm));
+    }
+    if (model.cold_start_s.empty()) throw std::runtime_error("no usable cold start rows");
+    return model;
+}
+
+struct Run {
+    SimHost host;
+    SimPolicy policy;
+    int cores_per_instance = 1;
+    SimResult result;
+};
+
+std::vector<Run> expand(const Config& cfg) {
+    std::vector<Run> runs;
+    for (const std::string& mode : cfg.modes) {
+        const bool adaptive = mode == "adaptive";
+        const std::vector<double> percentiles = adaptive ? cfg.idle_percentile : std::vector<double>{0};
+        for (double ka : cfg.keep_alive)
+            for (double pct : percentiles)
+                for (double warm : cfg.min_warm)
+                    for (double replicas : cfg.max_replicas)
+                        for (double conc : cfg.concurrency)
+                            for (double cores : cfg.cores)
+                                for (double cpi : cfg.cores_per_instance) {
+                                    Run r;
+                                    r.policy.keep_alive = adaptive ? KeepAlive::Adaptive : KeepAlive::Fixed;
+                                    r.policy.keep_alive_s = ka;
+                                    r.policy.idle_percentile = pct;
+                                    r.policy.min_warm = static_cast<int>(warm);
+                                    r.policy.max_replicas = static_cast<int>(replicas);
+                                    r.policy.concurrency = static_cast<int>(conc);
+                                    r.host.cores = static_cast<int>(cores);
+                                    r.host.memory_mb = cfg.host_memory_mb;
+                                    r.cores_per_instance = static_cast<int>(cpi);
+                                    runs.push_back(r);
+                                }
+    }
+    return runs;
+}
+
+void write_row(std::ostream& out, const Run& r) {
+    const SimResult& s = r.result;
+    char line[512];
+    std::snprintf(line, sizeof(line),
+                  "%s,%g,%g,%d,%d,%d,%d,%d,%llu,%llu,%.6f,%llu,%llu,%d,%.6f,%.6f,%.6f,%.6f,%.6f,%.3f,%.3f\n",
+                  r.policy.keep_alive == KeepAlive::Adaptive ? "adaptive" : "fixed", r.policy.keep_alive_s,
+                  r.policy.keep_alive == KeepAlive::Adaptive ? r.policy.idle_percentile : 0.0, r.policy.min_warm,
+                  r.policy.max_replicas, r.policy.concurrency, r.host.cores, r.cores_per_instance,
+                  static_cast<unsigned long long>(s.requests), static_cast<unsigned long long>(s.cold_requests),
+                  s.cold_rate(), static_cast<unsigned long long>(s.queued_requests),
+                  static_cast<unsigned long long>(s.instance_starts), s.peak_instances, s.mean_s, s.p50_s, s.p99_s,
+                  s.p999_s, s.max_s, s.memory_mb_s / 1024.0, s.idle_instance_s);
+    out << line;
+}
+
+const char* kHeader =
+    "mode,keep_alive_s,idle_percentile,min_warm,max_replicas,concurrency,cores,cores_per_instance,requests,"
+    "cold_requests,cold_rate,queued_requests,instance_starts,peak_instances,mean_s,p50_s,p99_s,p999_s,max_s,"
+    "memory_gb_s,idle_instance_s\n";
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    Config cfg;
+    try {
+        cfg = parse_args(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << "Usage: " << argv[0] << " --trace trace.{csv,jsonl} [--scale-time 1.0] [--limit N]"
+                  << " [--out policy_sweep.csv]"
+                  << " [--calibrate-warm a.csv,b.csv] [--calibrate-cold cold_1.csv,...] [--include-errors]"
+                  << " [--service small=0.03,medium=0.05,large=0.1,xl=0.2] [--cold-start 0.7]"
+                  << " [--instance-mem-mb 400] [--host-mem-mb 0] [--threads N] [--seed 1]"
+                  << " [--keep-alive-mode fixed,adaptive] [--keep-alive 0,10,60,300,600] [--idle-percentile 99]"
+                  << " [--min-warm 0,1] [--max-replicas 0] [--concurrency 1] [--cores 8]"
+                  << " [--cores-per-instance 1]\n"
+                  << "Error: " << e.what() << "\n";
+        return 1;
+    }
+
+    try {
+        const std::vector<TraceRow> rows = load_trace(cfg.trace_path, cfg.scale_time, cfg.limit);
+        const SimModel model = build_model(cfg);
+        const std::vector<SimRequest> requests = make_requests(rows, model, cfg.seed);
+        std::cout << "policy_sim: " << requests.size() << " requests over " << rows.back().ts_seconds << " s, "
+                  << model.buckets.size() << " buckets, " << model.cold_start_s.size() << " cold start samples\n";
+        for (size_t b = 0; b < model.buckets.size(); ++b) {
+            std::vector<double> s = model.service_s[b];
+            std::cout << "  " << model.buckets[b] << ": median service " << median(s) << " s over " << s.size()
+                      << " samples\n";
+        }
+        std::cout << "  median cold start " << median(model.cold_start_s) << " s\n";
+
+        std::vector<Run> runs = expand(cfg);
+        const int threads = std::max(1, cfg.threads > 0 ? cfg.threads
+                                                        : static_cast<int>(std::thread::hardware_concurrency()));
+        const auto t0 = std::chrono::steady_clock::now();
+        std::atomic<size_t> next{0};
+        std::vector<std::thread> pool;
+        for (int t = 0; t < std::min<int>(threads, static_cast<int>(runs.size())); ++t) {
+            pool.emplace_back([&] {
+                SimModel local = model;
+                for (size_t i = next.fetch_add(1); i < runs.size(); i = next.fetch_add(1)) {
+                    local.cores_per_instance = runs[i].cores_per_instance;
+                    runs[i].result = simulate(requests, local, runs[i].host, runs[i].policy, cfg.seed);
+                }
+            });
+        }
+        for (auto& t : pool) t.join();
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        std::cout << "policy_sim: " << runs.size() << " configurations in " << elapsed << " s ("
+                  << runs.size() / std::max(elapsed, 1e-9) << "/s on " << pool.size() << " threads)\n";
+
+        std::ofstream out(cfg.out_path);
+        if (!out) throw std::runtime_error("cannot write " + cfg.out_path);
+        out << kHeader;
+        for (const Run& r : runs) write_row(out, r);
+        std::cout << "Wrote " << cfg.out_path << "\n";
+
+        // Pareto frontier on (p99, memory): sorted by memory, keep each run that
+        // beats every cheaper one on p99.
+        std::vector<const Run*> order;
+        for (const Run& r : runs) order.push_back(&r);
+        std::sort(order.begin(), order.end(), [](const Run* a, const Run* b) {
+            if (a->result.memory_mb_s != b->result.memory_mb_s) return a->result.memory_mb_s < b->result.memory_mb_s;
+            return a->result.p99_s < b->result.p99_s;
+        });
+        std::cout << "\nPareto frontier (p99 vs memory):\n" << kHeader;
+        double best_p99 = 1e300;
+        for (const Run* r : order) {
+            if (r->result.p99_s < best_p99) {
+                best_p99 = r->result.p99_s;
+                write_row(std::cout, *r);
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Fatal error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
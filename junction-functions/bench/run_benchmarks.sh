@@ -0,0 +1,39 @@
+#!/usr/bin/env bash
+# Run every microbenchmark that was built and write one JSON file per suite under
+# <out>/<commit>/, tagged with the commit so runs can be compared across history
+# (e.g. with Google Benchmark's tools/compare.py).
+#
+#   bench/run_benchmarks.sh [build_dir] [out_dir]
+#
+# inference_bench needs DISTILBERT_ONNX and/or GPT2_ONNX; its benchmarks are
+# reported as skipped without them.
+set -euo pipefail
+
+BUILD_DIR=${1:-build}
+OUT_DIR=${2:-bench-results}
+REPO_DIR=$(cd "$(dirname "$0")/.." && pwd)
+COMMIT=$(git -C "$REPO_DIR" rev-parse --short HEAD 2>/dev/null || echo unknown)
+if [[ -n "$(git -C "$REPO_DIR" status --porcelain --untracked-files=no 2>/dev/null)" ]]; then
+  COMMIT="${COMMIT}-dirty"
+fi
+
+mkdir -p "$OUT_DIR/$COMMIT"
+ran=0
+for suite in sampling_bench gateway_bench inference_bench junctiond_bench; do
+  bin="$BUILD_DIR/$suite"
+  if [[ ! -x "$bin" ]]; then
+    echo "skip $suite: $bin not built (is Google Benchmark installed?)" >&2
+    continue
+  fi
+  echo "== $suite"
+  "$bin" --benchmark_out="$OUT_DIR/$COMMIT/$suite.json" --benchmark_out_format=json \
+    --benchmark_context=git_commit="$COMMIT" --benchmark_repetitions="${REPETITIONS:-3}" \
+    --benchmark_report_aggregates_only=true
+  ran=$((ran + 1))
+done
+
+if [[ $ran -eq 0 ]]; then
+  echo "no benchmarks found in $BUILD_DIR" >&2
+  exit 1
+fi
+echo "Wrote $OUT_DIR/$COMMIT/*.json"
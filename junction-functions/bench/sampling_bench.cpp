@@ -0,0 +1,107 @@
+// Sampling kernel microbenchmarks over a GPT-2 sized vocab.
+//
+//   ./sampling_bench --benchmark_format=json --benchmark_out=sampling.json
+//
+// Every benchmark is registered once per ISA the CPU supports, so scalar/AVX2/
+// AVX-512 numbers come out of the same run. The batch argument is the number of
+// logit rows processed per iteration, matching a continuous-batching decode step.
+#include "sampling.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+constexpr int64_t kVocab = 50257;
+
+std::vector<float> make_logits(int64_t rows) {
+    std::mt19937 gen(42);
+    std::normal_distribution<float> dist(0.0f, 3.0f);
+    std::vector<float> logits(rows * kVocab);
+    for (float& v : logits) v = dist(gen);
+    return logits;
+}
+
+void BM_Argmax(benchmark::State& state, sampling::Isa isa) {
+    sampling::force_isa(isa);
+    const int64_t rows = state.range(0);
+    auto logits = make_logits(rows);
+    for (auto _ : state) {
+        for (int64_t r = 0; r < rows; ++r) {
+            benchmark::DoNotOptimize(sampling::argmax(logits.data() + r * kVocab, kVocab));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * rows * kVocab);
+}
+
+void BM_Softmax(benchmark::State& state, sampling::Isa isa) {
+    sampling::force_isa(isa);
+    const int64_t rows = state.range(0);
+    auto logits = make_logits(rows);
+    std::vector<float> probs(kVocab);
+    for (auto _ : state) {
+        for (int64_t r = 0; r < rows; ++r) {
+            sampling::softmax(logits.data() + r * kVocab, kVocab, 0.8f, probs.data());
+            benchmark::DoNotOptimize(probs.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * rows * kVocab);
+}
+
+void BM_TopK(benchmark::State& state, sampling::Isa isa) {
+    sampling::force_isa(isa);
+    const int64_t rows = state.range(0);
+    auto logits = make_logits(rows);
+    std::vector<std::pair<float, int64_t>> out;
+    for (auto _ : state) {
+        for (int64_t r = 0; r < rows; ++r) {
+            sampling::top_k(logits.data() + r * kVocab, kVocab, 50, out);
+            benchmark::DoNotOptimize(out.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * rows * kVocab);
+}
+
+// Full per-token path as the decode scheduler runs it (temperature + top-p).
+void BM_SampleTopP(benchmark::State& state, sampling::Isa isa) {
+    sampling::force_isa(isa);
+    const int64_t rows = state.range(0);
+    auto logits = make_logits(rows);
+    sampling::Sampler sampler(kVocab);
+    sampling::SamplingParams params{0.8f, 0, 0.9f};
+    std::mt19937_64 rng(7);
+    for (auto _ : state) {
+        for (int64_t r = 0; r < rows; ++r) {
+            benchmark::DoNotOptimize(sampler.sample(logits.data() + r * kVocab, kVocab, params, rng));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+
+void register_all() {
+    const sampling::Isa best = sampling::active_isa();
+    for (sampling::Isa isa : {sampling::Isa::Scalar, sampling::Isa::Avx2, sampling::Isa::Avx512}) {
+        if (isa > best) break;
+        const std::string suffix = std::string("/") + sampling::isa_name(isa);
+        for (auto* b : {
+                 benchmark::RegisterBenchmark(("argmax" + suffix).c_str(), BM_Argmax, isa),
+                 benchmark::RegisterBenchmark(("softmax" + suffix).c_str(), BM_Softmax, isa),
+                 benchmark::RegisterBenchmark(("top_k50" + suffix).c_str(), BM_TopK, isa),
+                 benchmark::RegisterBenchmark(("sample_top_p" + suffix).c_str(), BM_SampleTopP, isa),
+             }) {
+            b->Arg(1)->Arg(8)->Arg(32)->ArgName("batch");
+        }
+    }
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    register_all();
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,308 @@
+// Open-loop trace replay: the C++ counterpart of test/latency_test.py.
+//
+// Every trace row is sent at its own scheduled time, whatever happened to the
+// rows before it. A pool of sender threads, each holding one keep-alive
+// connection, takes rows in timestamp order and sleeps until the row is due. If
+// every sender is still waiting on a slow response the row goes out late, and
+// its latency is measured from when it was *due*, not from when it was sent: a
+// slow server then shows up as the queueing delay its clients would have seen
+// rather than silently stretching the schedule (coordinated omission). Both
+// figures are kept, and the summary prints them side by side.
+//
+// Input is any trace common/trace_file.h reads (CSV as written by
+// data/preprocess_trace.py, or JSONL). Request bodies come from a
+// bucket -> JSON file, pre-tokenized by test/make_payloads.py, since there is no
+// tokenizer on this side.
+//
+// --backend picks how a payload becomes a request (common/backend_adapter.h), so
+// the same trace and payloads can be replayed against the Junction gateway,
+// OpenFaaS or OpenWhisk; test/compare_backends.py runs it once per backend and
+// reports them side by side.
+//
+// Output has the columns of test/results/*.csv (latency_s measured from the
+// scheduled time) and the trace_id the gateway returned in its traceparent header
+// when it runs with --trace-file, plus whether the backend reported a cold start
+// (1/0, empty if it did not say). <out>_summary.csv has per-bucket percentiles.
+// Requests that got no response (refused, reset, timed out) have status "error"
+// and are kept in the percentiles at their elapsed time, but never less than
+// --timeout: dropping them would make an overloaded backend look faster.
+// test/trace_breakdown.py joins the two to break an outlier down by stage.
+#include "../../junctiond/httplib.h"
+#include "../../junctiond/json.hpp"
+#include "../common/backend_adapter.h"
+#include "../common/hdr_histogram.h"
+#include "../common/trace_file.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using json = nlohmann::json;
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+struct Config {
+    std::string trace_path;
+    std::string payloads_path;
+    std::string url;
+    std::string backend = "junction";
+    BackendOptions backend_options;
+    std::string out_path = "trace_replay.csv";
+    std::string summary_path;  // default: <out>_summary.csv
+    int connections = 32;
+    double timeout_s = 10.0;
+    double scale_time = 1.0;
+    long limit = -1;
+};
+
+struct Outcome {
+    Clock::time_point sent{};
+    Clock::time_point done{};
+    int status = 0;  // 0: transport error, see `error`
+    int cold = -1;
+    std::string error;
+    std::string trace_id;
+};
+
+Config parse_args(int argc, char* argv[]) {
+    Config cfg;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--trace" && i + 1 < argc) {
+            cfg.trace_path = argv[++i];
+        } else if (arg == "--payloads" && i + 1 < argc) {
+            cfg.payloads_path = argv[++i];
+        } else if (arg == "--url" && i + 1 < argc) {
+            cfg.url = argv[++i];
+        } else if (arg == "--backend" && i + 1 < argc) {
+            cfg.backend = argv[++i];
+        } else if (arg == "--auth" && i + 1 < argc) {
+            cfg.backend_options.auth = argv[++i];
+        } else if (arg == "--out" && i + 1 < argc) {
+            cfg.out_path = argv[++i];
+        } else if (arg == "--summary" && i + 1 < argc) {
+            cfg.summary_path = argv[++i];
+        } else if (arg == "--connections" && i + 1 < argc) {
+            cfg.connections = std::stoi(argv[++i]);
+        } else if (arg == "--timeout" && i + 1 < argc) {
+            cfg.timeout_s = std::stod(argv[++i]);
+        } else if (arg == "--scale-time" && i + 1 < argc) {
+            cfg.scale_time = std::stod(argv[++i]);
+        } else if (arg == "--limit" && i + 1 < argc) {
+            cfg.limit = std::stol(argv[++i]);
+        } else {
+            throw std::runtime_error("Unknown or incomplete argument: " + arg);
+        }
+    }
+    if (cfg.trace_path.empty() || cfg.payloads_path.empty() || cfg.url.empty()) {
+        throw std::runtime_error("--trace, --payloads and --url are required");
+    }
+    if (cfg.connections < 1) throw std::runtime_error("--connections must be at least 1");
+    if (cfg.limit == 0 || cfg.limit < -1) throw std::runtime_error("--limit must be at least 1");
+    if (cfg.summary_path.empty()) {
+        const size_t dot = cfg.out_path.rfind('.');
+        const size_t slash = cfg.out_path.rfind('/');
+        const bool has_ext = dot != std::string::npos && (slash == std::string::npos || dot > slash);
+        cfg.summary_path = (has_ext ? cfg.out_path.substr(0, dot) : cfg.out_path) + "_summary.csv";
+    }
+    return cfg;
+}
+
+// Bucket -> request body for `backend`. Buckets without an entry fall back to
+// "small", as latency_test.py does with prompts.
+std::map<std::string, std::string> load_payloads(const std::string& path, const std::vector<TraceRow>& rows,
+                                                 const BackendAdapter& backend) {
+    std::ifstream in(path);
+    if (!in) throw std::runtime_error("cannot open payloads " + path);
+    const json j = json::parse(in);
+    std::map<std::string, std::string> bodies;
+    for (auto it = j.begin(); it != j.end(); ++it) bodies[it.key()] = backend.body(it.value());
+    for (const TraceRow& r : rows) {
+        if (!bodies.count(r.bucket) && !bodies.count("small")) {
+            throw std::runtime_error("no payload for bucket '" + r.bucket + "' (and no 'small' fallback)");
+        }
+    }
+    return bodies;
+}
+
+// http://host[:port]/path into "http://host:port" and "/path".
+std::pair<std::string, std::string> split_url(const std::string& url) {
+    const size_t scheme = url.find("://");
+    const size_t path = url.find('/', scheme == std::string::npos ? 0 : scheme + 3);
+    if (path == std::string::npos) return {url, "/"};
+    return {url.substr(0, path), url.substr(path)};
+}
+
+std::string csv_escape(const std::string& s) {
+    if (s.find_first_of(",\"\n") == std::string::npos) return s;
+    std::string out = "\"";
+    for (char c : s) out += c == '"' ? std::string("\"\"") : std::string(1, c);
+    return out + "\"";
+}
+
+double seconds(Clock::duration d) { return std::chrono::duration<double>(d).count(); }
+
+int64_t micros(Clock::duration d) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(d).count();
+}
+
+struct BucketStats {
+    HdrHistogram corrected;  // from scheduled time
+    HdrHistogram service;    // from actual send
+    HdrHistogram send_lag;   // actual send - scheduled
+    int64_t errors = 0;
+    int64_t non_2xx = 0;
+    int64_t cold = 0;
+};
+
+void write_summary(std::ostream& out, const std::map<std::string, BucketStats>& stats) {
+    out << "bucket,measure,count,errors,non_2xx,mean_s,p50_s,p90_s,p99_s,p999_s,max_s,cold\n";
+    for (const auto& [bucket, s] : stats) {
+        const std::pair<const char*, const HdrHistogram*> measures[] = {
+            {"corrected", &s.corrected}, {"service", &s.service}, {"send_lag", &s.send_lag}};
+        for (const auto& [name, h] : measures) {
+            char line[256];
+            std::snprintf(line, sizeof(line), "%s,%s,%lld,%lld,%lld,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f,%lld\n", bucket.c_str(), name,
+                          static_cast<long long>(h->count()), static_cast<long long>(s.errors),
+                          static_cast<long long>(s.non_2xx), h->mean() / 1e6, h->value_at_percentile(50) / 1e6,
+                          h->value_at_percentile(90) / 1e6, h->value_at_percentile(99) / 1e6,
+                          h->value_at_percentile(99.9) / 1e6, h->max() / 1e6, static_cast<long long>(s.cold));
+            out << line;
+        }
+    }
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    Config cfg;
+    try {
+        cfg = parse_args(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << "Usage: " << argv[0]
+                  << " --trace trace.{csv,jsonl} --payloads payloads.json --url http://host:8080/infer"
+                  << " [--backend junction|openfaas|openwhisk] [--auth uuid:key]"
+                  << " [--out results/replay.csv] [--summary results/replay_summary.csv]"
+                  << " [--connections 32] [--timeout 10] [--scale-time 1.0] [--limit N]\n"
+                  << "Error: " << e.what() << "\n";
+        return 1;
+    }
+
+    try {
+        const std::vector<TraceRow> rows = load_trace(cfg.trace_path, cfg.scale_time, cfg.limit);
+        const std::unique_ptr<BackendAdapter> backend = make_backend(cfg.backend, cfg.backend_options);
+        const std::map<std::string, std::string> bodies = load_payloads(cfg.payloads_path, rows, *backend);
+        const std::pair<std::string, std::string> target = split_url(cfg.url);
+        const std::string& base = target.first;
+        const std::string path = backend->path(target.second);
+        const httplib::Headers headers = backend->headers();
+        std::vector<Outcome> outcomes(rows.size());
+        std::atomic<size_t> next{0};
+
+        const int senders = static_cast<int>(std::min<size_t>(static_cast<size_t>(cfg.connections), rows.size()));
+        std::cout << "trace_replay: " << rows.size() << " requests over " << rows.back().ts_seconds << " s to "
+                  << cfg.url << " (" << backend->name() << ") from " << senders << " connections\n";
+
+        // A short lead so every sender is connected-ready before the first row is due.
+        const Clock::time_point start = Clock::now() + std::chrono::milliseconds(200);
+        auto due = [&](size_t i) {
+            return start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(rows[i].ts_seconds));
+        };
+        const auto timeout = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::duration<double>(cfg.timeout_s));
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < senders; ++t) {
+            threads.emplace_back([&] {
+                httplib::Client cli(base);
+                cli.set_keep_alive(true);
+                cli.set_connection_timeout(timeout.count() / 1000000, timeout.count() % 1000000);
+                cli.set_read_timeout(timeout.count() / 1000000, timeout.count() % 1000000);
+                cli.set_write_timeout(timeout.count() / 1000000, timeout.count() % 1000000);
+                for (size_t i = next.fetch_add(1); i < rows.size(); i = next.fetch_add(1)) {
+                    std::this_thread::sleep_until(due(i));
+                    auto body = bodies.find(rows[i].bucket);
+                    if (body == bodies.end()) body = bodies.find("small");
+                    Outcome& o = outcomes[i];
+                    o.sent = Clock::now();
+                    auto res = cli.Post(path, headers, body->second, "application/json");
+                    o.done = Clock::now();
+                    if (res) {
+                        o.status = res->status;
+                        BackendReply reply = backend->inspect(*res);
+                        o.cold = reply.cold;
+                        o.error = std::move(reply.error);
+                        // "00-<trace id>-<span id>-01"
+                        const std::string traceparent = res->get_header_value("traceparent");
+                        if (traceparent.size() >= 35) o.trace_id = traceparent.substr(3, 32);
+                    } else {
+                        o.error = httplib::to_string(res.error());
+                    }
+                }
+            });
+        }
+        for (auto& t : threads) t.join();
+
+        std::ofstream out(cfg.out_path);
+        if (!out) throw std::runtime_error("cannot write " + cfg.out_path);
+        out << "ts_seconds,bucket,status,latency_s,error,trace_id,cold\n";
+        std::map<std::string, BucketStats> stats;
+        for (size_t i = 0; i < rows.size(); ++i) {
+            const Outcome& o = outcomes[i];
+            BucketStats& b = stats[rows[i].bucket];
+            BucketStats& all = stats["all"];
+            char ts[32];
+            std::snprintf(ts, sizeof(ts), "%.6f", rows[i].ts_seconds);
+            out << ts << ',' << csv_escape(rows[i].bucket) << ',';
+            Clock::duration corrected = o.done - due(i);
+            Clock::duration service = o.done - o.sent;
+            if (o.status == 0) {
+                corrected = std::max<Clock::duration>(corrected, timeout);
+                service = std::max<Clock::duration>(service, timeout);
+            }
+            char latency[32];
+            std::snprintf(latency, sizeof(latency), "%.6f", seconds(corrected));
+            if (o.status == 0) out << "error";
+            else out << o.status;
+            out << ',' << latency << ',' << csv_escape(o.error) << ',' << o.trace_id << ','
+                << (o.cold < 0 ? "" : std::to_string(o.cold)) << '\n';
+            for (BucketStats* s : {&b, &all}) {
+                s->corrected.record(micros(corrected));
+                s->service.record(micros(service));
+                s->send_lag.record(micros(o.sent - due(i)));
+                // Only answered requests count as cold starts: a rejected one started nothing.
+                if (o.status == 0) ++s->errors;
+                else if (o.status < 200 || o.status >= 300 || !o.error.empty()) ++s->non_2xx;
+                else if (o.cold == 1) ++s->cold;
+            }
+        }
+        std::cout << "Wrote " << cfg.out_path << " with " << rows.size() << " rows\n";
+
+        std::ofstream summary(cfg.summary_path);
+        if (!summary) throw std::runtime_error("cannot write " + cfg.summary_path);
+        write_summary(summary, stats);
+        write_summary(std::cout, stats);
+        std::cout << "Wrote " << cfg.summary_path << "\n";
+
+        const BucketStats& all = stats["all"];
+        if (all.send_lag.value_at_percentile(99) > 10000) {
+            std::cout << "note: p99 send lag is " << all.send_lag.value_at_percentile(99) / 1000
+                      << " ms; the server (or too few --connections) held requests back, so the corrected"
+                         " figures are the ones to quote\n";
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Fatal error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
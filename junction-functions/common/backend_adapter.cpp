@@ -0,0 +1,138 @@
+#include "backend_adapter.h"
+
+#include <cstdint>
+#include <stdexcept>
+
+using json = nlohmann::json;
+
+namespace {
+std::string base64(const std::string& in) {
+    static const char kAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string out;
+    size_t i = 0;
+    for (; i + 2 < in.size(); i += 3) {
+        const uint32_t v = (uint8_t(in[i]) << 16) | (uint8_t(in[i + 1]) << 8) | uint8_t(in[i + 2]);
+        out += {kAlphabet[v >> 18], kAlphabet[(v >> 12) & 63], kAlphabet[(v >> 6) & 63], kAlphabet[v & 63]};
+    }
+    if (i + 1 == in.size()) {
+        const uint32_t v = uint8_t(in[i]) << 16;
+        out += {kAlphabet[v >> 18], kAlphabet[(v >> 12) & 63], '=', '='};
+    } else if (i + 2 == in.size()) {
+        const uint32_t v = (uint8_t(in[i]) << 16) | (uint8_t(in[i + 1]) << 8);
+        out += {kAlphabet[v >> 18], kAlphabet[(v >> 12) & 63], kAlphabet[(v >> 6) & 63], '='};
+    }
+    return out;
+}
+
+const std::string& text_of(const json& payload) {
+    auto it = payload.find("text");
+    if (it == payload.end() || !it->is_string()) {
+        throw std::runtime_error("payload has no \"text\"; regenerate it with test/make_payloads.py");
+    }
+    return it->get_ref<const std::string&>();
+}
+
+size_t tokens_of(const json& payload) {
+    auto it = payload.find("input_ids");
+    return it != payload.end() && it->is_array() ? it->size() : 0;
+}
+
+// Parsed body, or null when it is not JSON.
+json parse_body(const httplib::Response& res) {
+    return json::parse(res.body, nullptr, false);
+}
+
+class JunctionBackend : public BackendAdapter {
+public:
+    const char* name() const override { return "junction"; }
+
+    std::string body(const json& payload) const override {
+        json out = payload;
+        out.erase("text");
+        return out.dump();
+    }
+
+    BackendReply inspect(const httplib::Response& res) const override {
+        BackendReply r;
+        const std::string cold = res.get_header_value("X-Cold-Start");
+        if (!cold.empty()) r.cold = cold == "1" ? 1 : 0;
+        return r;
+    }
+};
+
+class OpenFaasBackend : public BackendAdapter {
+public:
+    const char* name() const override { return "openfaas"; }
+
+    std::string body(const json& payload) const override {
+        json out{{"text", text_of(payload)}};
+        // The handler pads to max_length (128 by default): match the tokenized length instead.
+        if (const size_t n = tokens_of(payload)) out["max_length"] = n;
+        return out.dump();
+    }
+
+    BackendReply inspect(const httplib::Response& res) const override {
+        BackendReply r;
+        const json body = parse_body(res);
+        if (body.is_object() && body.contains("cold") && body["cold"].is_boolean()) r.cold = body["cold"].get<bool>();
+        return r;
+    }
+};
+
+class OpenWhiskBackend : public BackendAdapter {
+public:
+    explicit OpenWhiskBackend(const std::string& auth) {
+        if (auth.find(':') == std::string::npos) throw std::runtime_error("openwhisk needs --auth uuid:key");
+        authorization_ = "Basic " + base64(auth);
+    }
+
+    const char* name() const override { return "openwhisk"; }
+
+    std::string body(const json& payload) const override {
+        json out{{"prompt", text_of(payload)}, {"context_tokens", tokens_of(payload)}};
+        if (payload.contains("bucket")) out["bucket_id"] = payload["bucket"];
+        return out.dump();
+    }
+
+    httplib::Headers headers() const override {
+        httplib::Headers h;
+        h.emplace("Authorization", authorization_);
+        return h;
+    }
+
+    // Latency includes the action's result, so the invocation has to block.
+    std::string path(const std::string& url_path) const override {
+        if (url_path.find("blocking=") != std::string::npos) return url_path;
+        return url_path + (url_path.find('?') == std::string::npos ? "?" : "&") + "blocking=true";
+    }
+
+    BackendReply inspect(const httplib::Response& res) const override {
+        BackendReply r;
+        // 202: still running when the controller's blocking wait ran out; only an
+        // activation id came back.
+        if (res.status == 202) {
+            r.error = "activation outlived the blocking wait";
+            return r;
+        }
+        const json activation = parse_body(res);
+        if (!activation.is_object()) return r;
+        r.cold = 0;
+        if (activation.contains("annotations") && activation["annotations"].is_array()) {
+            for (const json& a : activation["annotations"]) {
+                if (a.is_object() && a.value("key", "") == "initTime") r.cold = 1;
+            }
+        }
+        return r;
+    }
+
+private:
+    std::string authorization_;
+};
+}  // namespace
+
+std::unique_ptr<BackendAdapter> make_backend(const std::string& kind, const BackendOptions& options) {
+    if (kind == "junction") return std::make_unique<JunctionBackend>();
+    if (kind == "openfaas") return std::make_unique<OpenFaasBackend>();
+    if (kind == "openwhisk") return std::make_unique<OpenWhiskBackend>(options.auth);
+    throw std::runtime_error("unknown backend '" + kind + "' (junction, openfaas or openwhisk)");
+}
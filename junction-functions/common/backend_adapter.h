@@ -0,0 +1,55 @@
+#ifndef BACKEND_ADAPTER_H
+#define BACKEND_ADAPTER_H
+
+// What it takes to send one benchmark request to each deployment path, so that
+// trace_replay drives all of them from the same trace and the same payloads:
+//
+//   junction   the gateway's /infer or /infer_warm: token arrays as they are.
+//   openfaas   openfaas-functions/model-inference: {"text", "max_length"}, with
+//              max_length set to the token count so it runs the same sequence.
+//   openwhisk  a blocking action invocation (invocation/owsetup.sh):
+//              {"prompt", "bucket_id", "context_tokens"} as invokepattern.py
+//              sends, with basic auth. The values differ from invokepattern.py's:
+//              bucket_id is the payload's bucket name (small, medium, large, xl)
+//              rather than a ContextTokens quartile "1".."4", and context_tokens
+//              is the length of the tokenized prompt actually sent rather than
+//              the trace's ContextTokens.
+//
+// Payloads are the per-bucket objects of test/make_payloads.py; the OpenFaaS and
+// OpenWhisk bodies need its "text" field. Each adapter also reads whether the
+// request hit a cold start from what its platform reports: the gateway's
+// X-Cold-Start header, the handler's "cold" field, or the activation's initTime
+// annotation.
+
+#include "../../junctiond/httplib.h"
+#include "../../junctiond/json.hpp"
+
+#include <memory>
+#include <string>
+
+struct BackendOptions {
+    std::string auth;  // openwhisk: "uuid:key"
+};
+
+struct BackendReply {
+    int cold = -1;      // 1 cold start, 0 warm, -1 the platform did not say
+    std::string error;  // set when a 2xx response still carries no result
+};
+
+class BackendAdapter {
+public:
+    virtual ~BackendAdapter() = default;
+
+    virtual const char* name() const = 0;
+    // Request body for one bucket's payload; built once per bucket, not per request.
+    virtual std::string body(const nlohmann::json& payload) const = 0;
+    virtual httplib::Headers headers() const { return {}; }
+    // Path to post to, given the path of --url.
+    virtual std::string path(const std::string& url_path) const { return url_path; }
+    virtual BackendReply inspect(const httplib::Response& res) const = 0;
+};
+
+// "junction", "openfaas" or "openwhisk"; throws on anything else.
+std::unique_ptr<BackendAdapter> make_backend(const std::string& kind, const BackendOptions& options);
+
+#endif // BACKEND_ADAPTER_H
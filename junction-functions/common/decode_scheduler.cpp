@@ -0,0 +1,343 @@
+#include "decode_scheduler.h"
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+
+namespace {
+double ms_between(std::chrono::steady_clock::time_point a, std::chrono::steady_clock::time_point b) {
+    return std::chrono::duration<double, std::milli>(b - a).count();
+}
+}  // namespace
+
+DecodeScheduler::DecodeScheduler(Ort::Session& session, const SchedulerConfig& cfg)
+    : cfg_(cfg),
+      cache_(discover_gpt2_dims(session), cfg.block_tokens, cfg.num_blocks),
+      decoder_(session, cache_, cfg.max_seq_len, cfg.prefill_chunk),
+      sampler_(decoder_.dims().vocab_size) {
+    if (cfg_.prefix_cache_blocks > 0) {
+        prefix_ = std::make_unique<PrefixCache>(cache_.pool(), cfg_.prefix_cache_blocks);
+        cache_.set_prefix_cache(prefix_.get());
+    }
+    batch_ids_.reserve(cfg_.max_batch);
+    batch_tokens_.reserve(cfg_.max_batch);
+}
+
+DecodeScheduler::~DecodeScheduler() {
+    stop();
+    profiled_decoder_.reset();
+    profiled_.reset();
+    cache_.set_prefix_cache(nullptr);
+}
+
+void DecodeScheduler::enable_profiling(OpProfiler& profiler, ProfiledSession::Factory make) {
+    profiler_ = &profiler;
+    profiled_ = std::make_unique<ProfiledSession>(profiler, "decode", std::move(make));
+}
+
+std::future<GenerationResult> DecodeScheduler::submit(GenerationRequest req) {
+    auto seq = std::make_unique<Sequence>();
+    seq->req = std::move(req);
+    seq->rng.seed(seq->req.seed);
+    seq->submitted = Clock::now();
+    auto fut = seq->promise.get_future();
+
+    if (seq->req.prompt.empty() || static_cast<int64_t>(seq->req.prompt.size()) >= cfg_.max_seq_len) {
+        GenerationResult r;
+        r.error = "prompt must have between 1 and " + std::to_string(cfg_.max_seq_len - 1) + " tokens";
+        seq->promise.set_value(std::move(r));
+        return fut;
+    }
+
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        seq->id = next_id_++;
+        incoming_.push_back(std::move(seq));
+    }
+    {
+        std::lock_guard<std::mutex> lk(stats_mtx_);
+        ++stats_.submitted;
+    }
+    cv_.notify_one();
+    return fut;
+}
+
+void DecodeScheduler::stop() {
+    stop_ = true;
+    cv_.notify_all();
+}
+
+SchedulerStats DecodeScheduler::stats() {
+    std::lock_guard<std::mutex> lk(stats_mtx_);
+    return stats_;
+}
+
+int64_t DecodeScheduler::sample(Sequence& seq, const float* logits) {
+    const int64_t vocab = decoder_.dims().vocab_size;
+    return sampler_.sample(logits, vocab, seq.req.params, seq.rng);
+}
+
+bool DecodeScheduler::finished(const Sequence& seq) const {
+    if (seq.generated.empty()) return false;
+    if (static_cast<int64_t>(seq.generated.size()) >= seq.req.max_new_tokens) return true;
+    if (seq.req.eos_token >= 0 && seq.generated.back() == seq.req.eos_token) return true;
+    return static_cast<int64_t>(seq.req.prompt.size() + seq.generated.size()) >= cfg_.max_seq_len;
+}
+
+void DecodeScheduler::finish(SeqPtr seq, const std::string& error) {
+    auto now = Clock::now();
+    GenerationResult r;
+    r.tokens = std::move(seq->generated);
+    r.queue_ms = seq->started ? ms_between(seq->submitted, seq->admitted) : 0.0;
+    r.ttft_ms = r.tokens.empty() ? 0.0 : ms_between(seq->submitted, seq->first_token);
+    r.total_ms = ms_between(seq->submitted, now);
+    r.preemptions = seq->preemptions;
+    r.error = error;
+    seq->promise.set_value(std::move(r));
+
+    std::lock_guard<std::mutex> lk(stats_mtx_);
+    ++stats_.completed;
+}
+
+// Reserve blocks for the sequence's prompt (plus any tokens generated before a
+// preemption) and prefill them. Returns false when the pool has no room yet.
+bool DecodeScheduler::admit(Sequence& seq) {
+    // A resumed sequence recomputes everything but its last token, which becomes the
+    // next decode input just like a freshly sampled one.
+    std::vector<int64_t> feed = seq.req.prompt;
+    if (!seq.generated.empty()) {
+        feed.insert(feed.end(), seq.generated.begin(), seq.generated.end() - 1);
+    }
+
+    const int64_t feed_len = static_cast<int64_t>(feed.size());
+    cache_.add_sequence(seq.id);
+    int64_t cached = 0;
+    if (prefix_) {
+        // Leave at least the last token to run: its logits pick the next token.
+        prefix_blocks_.clear();
+        cached = prefix_->match(feed.data(), feed_len - 1, prefix_blocks_);
+        if (cached > 0) cache_.attach_prefix(seq.id, prefix_blocks_, cached);
+    }
+    if (!cache_.reserve(seq.id, feed_len - cached)) {
+        cache_.remove_sequence(seq.id);
+        return false;
+    }
+
+    const float* logits = nullptr;
+    int64_t last = 0;
+    try {
+        for (int64_t pos = cached; pos < feed_len; pos += last) {
+            last = std::min<int64_t>(active_->max_step_tokens(), feed_len - pos);
+            logits = active_->step(seq.id, feed.data() + pos, last);
+            ++active_runs_;
+        }
+    } catch (...) {
+        cache_.remove_sequence(seq.id);
+        throw;
+    }
+
+    if (prefix_) {
+        prefix_->insert(feed.data(), feed_len, cache_.table(seq.id).blocks);
+        std::lock_guard<std::mutex> lk(stats_mtx_);
+        ++stats_.prefix_lookups;
+        if (cached > 0) ++stats_.prefix_hits;
+        stats_.prefix_lookup_tokens += static_cast<uint64_t>(feed_len);
+        stats_.prefix_reused_tokens += static_cast<uint64_t>(cached);
+    }
+
+    if (!seq.started) {
+        seq.started = true;
+        seq.admitted = Clock::now();
+    }
+    if (seq.generated.empty()) {
+        seq.generated.push_back(sample(seq, logits + (last - 1) * decoder_.dims().vocab_size));
+        seq.first_token = Clock::now();
+        std::lock_guard<std::mutex> lk(stats_mtx_);
+        ++stats_.generated_tokens;
+    }
+    return true;
+}
+
+void DecodeScheduler::requeue_preempted() {
+    cache_.take_preempted();  // membership in the cache is the source of truth
+
+    std::vector<SeqPtr> keep;
+    std::vector<SeqPtr> evicted;
+    for (auto& s : running_) {
+        (cache_.contains(s->id) ? keep : evicted).push_back(std::move(s));
+    }
+    running_.swap(keep);
+
+    // Oldest preempted sequence ends up at the very front of the queue.
+    for (auto it = evicted.rbegin(); it != evicted.rend(); ++it) {
+        ++(*it)->preemptions;
+        waiting_.push_front(std::move(*it));
+    }
+    if (!evicted.empty()) {
+        std::lock_guard<std::mutex> lk(stats_mtx_);
+        stats_.preemptions += evicted.size();
+    }
+}
+
+void DecodeScheduler::decode_running() {
+    // Older sequences reserve first, so under pressure the newest ones give way.
+    for (auto& s : running_) {
+        if (!cache_.contains(s->id)) continue;
+        if (!cache_.reserve(s->id, 1)) cache_.remove_sequence(s->id);
+    }
+    requeue_preempted();
+    if (running_.empty()) return;
+
+    batch_ids_.clear();
+    batch_tokens_.clear();
+    for (auto& s : running_) {
+        batch_ids_.push_back(s->id);
+        batch_tokens_.push_back(s->generated.back());
+    }
+
+    const int64_t vocab = decoder_.dims().vocab_size;
+    auto sample_row = [&](size_t row, const float* logits) {
+        running_[row]->generated.push_back(sample(*running_[row], logits));
+    };
+
+    if (active_->supports_batching()) {
+        const float* logits = active_->decode(batch_ids_, batch_tokens_.data());
+        ++active_runs_;
+        for (size_t r = 0; r < running_.size(); ++r) sample_row(r, logits + r * vocab);
+    } else {
+        for (size_t r = 0; r < running_.size(); ++r) {
+            std::vector<PagedKvCache::SeqId> one{batch_ids_[r]};
+            sample_row(r, active_->decode(one, &batch_tokens_[r]));
+            ++active_runs_;
+        }
+    }
+
+    std::lock_guard<std::mutex> lk(stats_mtx_);
+    ++stats_.decode_iterations;
+    stats_.batched_rows += running_.size();
+    stats_.generated_tokens += running_.size();
+}
+
+void DecodeScheduler::begin_iteration() {
+    active_ = &decoder_;
+    active_runs_ = 0;
+    if (!profiler_) return;
+    auto wants = [](const SeqPtr& s) { return s->req.profile; };
+    if (!profiler_->sample("") && std::none_of(running_.begin(), running_.end(), wants) &&
+        std::none_of(waiting_.begin(), waiting_.end(), wants)) {
+        return;
+    }
+    if (!profiled_decoder_) {
+        // Built here, so the loop stalls for one session build per trace.
+        try {
+            profiled_decoder_ = std::make_unique<PagedDecoder>(profiled_->session(), cache_, cfg_.max_seq_len,
+                                                               cfg_.prefill_chunk);
+            profiled_->skip_runs(1);  // a fresh session's first Run is not representative
+        } catch (const std::exception& e) {
+            std::cerr << "DecodeScheduler: profiling session: " << e.what() << "\n";
+            profiled_decoder_.reset();
+            flush_profile();
+            return;
+        }
+    }
+    active_ = profiled_decoder_.get();
+}
+
+void DecodeScheduler::end_iteration() {
+    if (active_ == &decoder_) return;
+    active_ = &decoder_;
+    if (profiled_->finish_run(active_runs_)) {
+        profiled_decoder_.reset();
+        flush_profile();
+    }
+}
+
+void DecodeScheduler::flush_profile() {
+    try {
+        profiled_->flush();
+    } catch (const std::exception& e) {
+        std::cerr << "DecodeScheduler: ORT profile: " << e.what() << "\n";
+    }
+}
+
+void DecodeScheduler::run() {
+    while (!stop_) {
+        {
+            std::unique_lock<std::mutex> lk(mtx_);
+            cv_.wait(lk, [&] {
+                return stop_ || !incoming_.empty() || !waiting_.empty() || !running_.empty();
+            });
+            if (stop_) break;
+            while (!incoming_.empty()) {
+                waiting_.push_back(std::move(incoming_.front()));
+                incoming_.pop_front();
+            }
+        }
+
+        begin_iteration();
+        try {
+            // Admit between decode steps while there is a batch slot and KV room.
+            while (static_cast<int64_t>(running_.size()) < cfg_.max_batch && !waiting_.empty()) {
+                bool admitted = false;
+                std::string error;
+                try {
+                    admitted = admit(*waiting_.front());
+                    // Nothing will free blocks for it: the prompt alone is too big.
+                    if (!admitted && running_.empty()) error = "prompt does not fit in the KV block pool";
+                } catch (const std::exception& e) {
+                    error = e.what();
+                }
+                if (!admitted && error.empty()) break;
+
+                SeqPtr s = std::move(waiting_.front());
+                waiting_.pop_front();
+                if (admitted) {
+                    running_.push_back(std::move(s));
+                } else {
+                    finish(std::move(s), error);
+                }
+            }
+
+            // Retire before decoding so finished rows never take a batch slot.
+            auto retire = [&] {
+                for (size_t i = 0; i < running_.size();) {
+                    if (finished(*running_[i])) {
+                        cache_.remove_sequence(running_[i]->id);
+                        finish(std::move(running_[i]));
+                        running_.erase(running_.begin() + i);
+                    } else {
+                        ++i;
+                    }
+                }
+            };
+            retire();
+            if (!running_.empty()) decode_running();
+            retire();
+        } catch (const std::exception& e) {
+            // A failed Run leaves every in-flight sequence in an unknown state.
+            for (auto& s : running_) {
+                cache_.remove_sequence(s->id);
+                finish(std::move(s), e.what());
+            }
+            running_.clear();
+        }
+        end_iteration();
+
+        std::lock_guard<std::mutex> lk(stats_mtx_);
+        stats_.waiting = waiting_.size();
+        stats_.running = running_.size();
+        stats_.free_blocks = cache_.pool().free_count();
+        if (prefix_) {
+            stats_.prefix_cached_blocks = prefix_->cached_blocks();
+            stats_.prefix_evicted_blocks = prefix_->evicted_blocks();
+        }
+    }
+
+    std::lock_guard<std::mutex> lk(mtx_);
+    for (auto& s : incoming_) waiting_.push_back(std::move(s));
+    incoming_.clear();
+    for (auto& s : running_) finish(std::move(s), "scheduler stopped");
+    for (auto& s : waiting_) finish(std::move(s), "scheduler stopped");
+    running_.clear();
+    waiting_.clear();
+}
@@ -0,0 +1,154 @@
+#ifndef DECODE_SCHEDULER_H
+#define DECODE_SCHEDULER_H
+
+#include "op_profile.h"
+#include "paged_kv_cache.h"
+#include "prefix_cache.h"
+#include "sampling.h"
+
+#include <onnxruntime_cxx_api.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+
+struct GenerationRequest {
+    std::vector<int64_t> prompt;
+    int64_t max_new_tokens = 16;
+    int64_t eos_token = 50256;  // stop early on this id; -1 disables
+    sampling::SamplingParams params{0.0f};  // greedy unless the caller asks otherwise
+    uint64_t seed = 0;
+    bool profile = false;  // ORT-profile every iteration this request takes part in
+};
+
+struct GenerationResult {
+    std::vector<int64_t> tokens;  // generated ids, prompt excluded
+    double queue_ms = 0.0;        // submit -> first admitted
+    double ttft_ms = 0.0;         // submit -> first generated token
+    double total_ms = 0.0;        // submit -> finished
+    int preemptions = 0;
+    std::string error;
+};
+
+struct SchedulerConfig {
+    int64_t max_batch = 8;        // sequences decoded together per iteration
+    int64_t max_seq_len = 1024;   // prompt + generated tokens per sequence
+    int block_tokens = 16;
+    int num_blocks = 512;
+    int64_t prefill_chunk = 32;
+    int prefix_cache_blocks = 128;  // KV blocks kept for shared prompt prefixes; 0 disables
+};
+
+struct SchedulerStats {
+    uint64_t submitted = 0;
+    uint64_t completed = 0;
+    uint64_t generated_tokens = 0;
+    uint64_t decode_iterations = 0;
+    uint64_t batched_rows = 0;    // sum of batch sizes over decode iterations
+    uint64_t preemptions = 0;
+    size_t waiting = 0;
+    size_t running = 0;
+    int free_blocks = 0;
+    // Prefix cache, counted once per admission.
+    uint64_t prefix_lookups = 0;
+    uint64_t prefix_hits = 0;          // admissions that reused at least one block
+    uint64_t prefix_lookup_tokens = 0;
+    uint64_t prefix_reused_tokens = 0; // prompt positions not prefilled thanks to the cache
+    int prefix_cached_blocks = 0;
+    uint64_t prefix_evicted_blocks = 0;
+};
+
+// Iteration-level ("continuous") batching for GPT-2 family decoding.
+//
+// Instead of batching whole requests, the loop re-forms the batch before every
+// decode step: finished sequences retire immediately and waiting ones are admitted
+// as soon as there is a batch slot and KV blocks for their prompt, so short
+// generations never wait behind long ones. Sequences preempted by the paged cache
+// go back to the front of the queue and are recomputed from prompt + output.
+// Prompts are looked up in a prefix cache first, so only the uncached suffix is
+// prefilled.
+class DecodeScheduler {
+public:
+    DecodeScheduler(Ort::Session& session, const SchedulerConfig& cfg);
+    ~DecodeScheduler();
+
+    std::future<GenerationResult> submit(GenerationRequest req);
+
+    // Run sampled iterations on a second, ORT-profiling session from `make` (see
+    // op_profile.h): a profiler.rate() fraction of them, plus every iteration with
+    // a `profile` request in it. Both decoders share the paged KV cache, so
+    // sequences move between them freely. Call before run().
+    void enable_profiling(OpProfiler& profiler, ProfiledSession::Factory make);
+
+    // Runs the scheduling loop on the calling thread until stop().
+    void run();
+    void stop();
+
+    SchedulerStats stats();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Sequence {
+        PagedKvCache::SeqId id = 0;
+        GenerationRequest req;
+        std::vector<int64_t> generated;
+        std::mt19937_64 rng;
+        std::promise<GenerationResult> promise;
+        Clock::time_point submitted;
+        Clock::time_point admitted;
+        Clock::time_point first_token;
+        bool started = false;
+        int preemptions = 0;
+    };
+    using SeqPtr = std::unique_ptr<Sequence>;
+
+    bool admit(Sequence& seq);
+    int64_t sample(Sequence& seq, const float* logits);
+    bool finished(const Sequence& seq) const;
+    void finish(SeqPtr seq, const std::string& error = "");
+    void requeue_preempted();
+    void decode_running();
+    void begin_iteration();
+    void end_iteration();
+    void flush_profile();
+
+    SchedulerConfig cfg_;
+    PagedKvCache cache_;
+    PagedDecoder decoder_;
+    sampling::Sampler sampler_;
+    std::unique_ptr<PrefixCache> prefix_;
+    std::vector<int> prefix_blocks_;
+
+    // The decoder this iteration runs on: decoder_, or the profiling one.
+    PagedDecoder* active_ = &decoder_;
+    int active_runs_ = 0;  // Session::Run calls this iteration
+    OpProfiler* profiler_ = nullptr;
+    std::unique_ptr<ProfiledSession> profiled_;
+    std::unique_ptr<PagedDecoder> profiled_decoder_;
+
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    std::deque<SeqPtr> incoming_;
+    std::atomic<bool> stop_{false};
+    uint64_t next_id_ = 1;
+
+    // Owned by the scheduling thread.
+    std::deque<SeqPtr> waiting_;
+    std::vector<SeqPtr> running_;
+    std::vector<PagedKvCache::SeqId> batch_ids_;
+    std::vector<int64_t> batch_tokens_;
+
+    std::mutex stats_mtx_;
+    SchedulerStats stats_;
+};
+
+#endif // DECODE_SCHEDULER_H
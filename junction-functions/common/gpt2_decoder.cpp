@@ -0,0 +1,141 @@
+#include "gpt2_decoder.h"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+namespace {
+// Returns dimension `axis` of the named input, or 0 if the input does not exist.
+int64_t input_dim(Ort::Session& session, const std::string& name, size_t axis) {
+    Ort::AllocatorWithDefaultOptions allocator;
+    for (size_t i = 0; i < session.GetInputCount(); ++i) {
+        auto n = session.GetInputNameAllocated(i, allocator);
+        if (name != n.get()) continue;
+        auto shape = session.GetInputTypeInfo(i).GetTensorTypeAndShapeInfo().GetShape();
+        return axis < shape.size() ? shape[axis] : 0;
+    }
+    return 0;
+}
+
+bool has_input(Ort::Session& session, const std::string& name) {
+    Ort::AllocatorWithDefaultOptions allocator;
+    for (size_t i = 0; i < session.GetInputCount(); ++i) {
+        if (name == session.GetInputNameAllocated(i, allocator).get()) return true;
+    }
+    return false;
+}
+}  // namespace
+
+Gpt2Runner::Gpt2Runner(Ort::Session& session)
+    : session_(session),
+      mem_(Ort::MemoryInfo::CreateCpu(OrtDeviceAllocator, OrtMemTypeCPU)),
+      binding_(session),
+      dims_(discover_gpt2_dims(session)) {
+    for (int layer = 0; layer < dims_.num_layers; ++layer) {
+        for (const char* kv : {"key", "value"}) {
+            past_names_.push_back("past." + std::to_string(layer) + "." + kv);
+            present_names_.push_back("present." + std::to_string(layer) + "." + kv);
+        }
+    }
+
+    // The original exports pin input_ids/attention_mask to one position; newer ones
+    // leave the sequence axis dynamic so prompts can be prefilled in one Run.
+    dynamic_sequence_ = input_dim(session, "input_ids", 1) <= 0;
+    int64_t mask_len = input_dim(session, "attention_mask", 1);
+    if (mask_len > 0) static_mask_len_ = mask_len;
+    has_position_ids_ = has_input(session, "position_ids");
+}
+
+void Gpt2Runner::run(const Step& s) {
+    const int64_t total_len = s.past_len + s.count;
+    const int64_t mask_len = static_mask_len_ > 0 ? static_mask_len_ : total_len;
+
+    std::array<int64_t, 2> ids_shape{s.batch, s.count};
+    std::array<int64_t, 2> mask_shape{s.batch, mask_len};
+    std::array<int64_t, 3> logits_shape{s.batch, s.count, dims_.vocab_size};
+    std::array<int64_t, 4> past_shape{s.batch, dims_.num_heads, s.past_len, dims_.head_dim};
+    std::array<int64_t, 4> present_shape{s.batch, dims_.num_heads, total_len, dims_.head_dim};
+
+    binding_.BindInput("input_ids", Ort::Value::CreateTensor<int64_t>(
+        mem_, const_cast<int64_t*>(s.ids), static_cast<size_t>(s.batch * s.count),
+        ids_shape.data(), ids_shape.size()));
+    binding_.BindInput("attention_mask", Ort::Value::CreateTensor<int64_t>(
+        mem_, const_cast<int64_t*>(s.mask), static_cast<size_t>(s.batch * mask_len),
+        mask_shape.data(), mask_shape.size()));
+    if (has_position_ids_) {
+        if (!s.positions) throw std::runtime_error("Gpt2Runner: model needs position_ids");
+        binding_.BindInput("position_ids", Ort::Value::CreateTensor<int64_t>(
+            mem_, const_cast<int64_t*>(s.positions), static_cast<size_t>(s.batch * s.count),
+            ids_shape.data(), ids_shape.size()));
+    }
+
+    const size_t past_elems = static_cast<size_t>(s.batch * dims_.token_stride() * s.past_len);
+    const size_t present_elems = static_cast<size_t>(s.batch * dims_.token_stride() * total_len);
+    for (size_t slot = 0; slot < past_names_.size(); ++slot) {
+        binding_.BindInput(past_names_[slot].c_str(), Ort::Value::CreateTensor<float>(
+            mem_, s.past[slot], past_elems, past_shape.data(), past_shape.size()));
+        binding_.BindOutput(present_names_[slot].c_str(), Ort::Value::CreateTensor<float>(
+            mem_, s.present[slot], present_elems, present_shape.data(), present_shape.size()));
+    }
+    binding_.BindOutput("logits", Ort::Value::CreateTensor<float>(
+        mem_, s.logits, static_cast<size_t>(s.batch * s.count * dims_.vocab_size),
+        logits_shape.data(), logits_shape.size()));
+
+    session_.Run(Ort::RunOptions{nullptr}, binding_);
+}
+
+Gpt2Decoder::Gpt2Decoder(Ort::Session& session, int64_t max_seq_len, int64_t max_step_tokens)
+    : runner_(session),
+      cache_(runner_.dims(), max_seq_len),
+      max_step_tokens_(runner_.dynamic_sequence() ? max_step_tokens : 1) {
+    max_step_tokens_ = std::max<int64_t>(1, std::min(max_step_tokens_, max_seq_len));
+    const int64_t static_mask = runner_.static_mask_len();
+    mask_.assign(static_mask > 0 ? static_mask : max_seq_len, 1);
+    positions_.resize(static_cast<size_t>(max_step_tokens_));
+    logits_.resize(static_cast<size_t>(max_step_tokens_ * runner_.dims().vocab_size));
+    past_.resize(static_cast<size_t>(runner_.dims().num_layers) * 2);
+    present_.resize(past_.size());
+}
+
+const float* Gpt2Decoder::step(const int64_t* ids, int64_t count) {
+    if (count <= 0 || count > max_step_tokens_) {
+        throw std::runtime_error("Gpt2Decoder::step: bad token count " + std::to_string(count));
+    }
+    if (cache_.length() + count > cache_.capacity()) {
+        throw std::runtime_error("Gpt2Decoder::step: sequence exceeds max length");
+    }
+
+    for (int layer = 0; layer < dims().num_layers; ++layer) {
+        for (int kv = 0; kv < 2; ++kv) {
+            past_[layer * 2 + kv] = cache_.past(layer, kv);
+            present_[layer * 2 + kv] = cache_.present(layer, kv);
+        }
+    }
+
+    for (int64_t i = 0; i < count; ++i) positions_[i] = cache_.length() + i;
+
+    Gpt2Runner::Step s;
+    s.count = count;
+    s.past_len = cache_.length();
+    s.ids = ids;
+    s.mask = mask_.data();
+    s.positions = positions_.data();
+    s.past = past_.data();
+    s.present = present_.data();
+    s.logits = logits_.data();
+    runner_.run(s);
+
+    cache_.commit(count);
+    return logits_.data();
+}
+
+const float* Gpt2Decoder::prefill(const std::vector<int64_t>& ids) {
+    if (ids.empty()) throw std::runtime_error("Gpt2Decoder::prefill: empty prompt");
+    const float* logits = nullptr;
+    int64_t last = 0;
+    for (size_t pos = 0; pos < ids.size(); pos += static_cast<size_t>(last)) {
+        last = std::min<int64_t>(max_step_tokens_, static_cast<int64_t>(ids.size() - pos));
+        logits = step(ids.data() + pos, last);
+    }
+    return logits + (last - 1) * dims().vocab_size;
+}
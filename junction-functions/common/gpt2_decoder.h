@@ -0,0 +1,86 @@
+#ifndef GPT2_DECODER_H
+#define GPT2_DECODER_H
+
+#include "kv_cache.h"
+
+#include <onnxruntime_cxx_api.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Binds caller-owned buffers to a GPT-2 family session through an IoBinding and runs
+// one forward pass. Owners of the KV memory (contiguous or paged) build on this.
+class Gpt2Runner {
+public:
+    explicit Gpt2Runner(Ort::Session& session);
+
+    struct Step {
+        int64_t batch = 1;
+        int64_t count = 1;               // new tokens per row
+        int64_t past_len = 0;            // (padded) past length shared by all rows
+        const int64_t* ids = nullptr;    // [batch, count]
+        const int64_t* mask = nullptr;   // [batch, past_len + count], or [batch, static_mask_len()]
+        const int64_t* positions = nullptr; // [batch, count]; only read if has_position_ids()
+        float* const* past = nullptr;    // layers * 2 tensors of [batch, heads, past_len, head_dim]
+        float* const* present = nullptr; // layers * 2 tensors of [batch, heads, past_len + count, head_dim]
+        float* logits = nullptr;         // [batch, count, vocab]
+    };
+
+    void run(const Step& step);
+
+    const Gpt2Dims& dims() const { return dims_; }
+    // False for exports that pin input_ids to one position per row.
+    bool dynamic_sequence() const { return dynamic_sequence_; }
+    // Non-zero for exports that pin attention_mask to a fixed length.
+    int64_t static_mask_len() const { return static_mask_len_; }
+    // True for exports with an explicit position_ids input (needed for left padding).
+    bool has_position_ids() const { return has_position_ids_; }
+
+private:
+    Ort::Session& session_;
+    Ort::MemoryInfo mem_;
+    Ort::IoBinding binding_;
+    Gpt2Dims dims_;
+    std::vector<std::string> past_names_;     // [layer * 2 + kv]
+    std::vector<std::string> present_names_;  // [layer * 2 + kv]
+    bool dynamic_sequence_ = true;
+    int64_t static_mask_len_ = 0;
+    bool has_position_ids_ = false;
+};
+
+// Incremental decoder for one sequence on top of a GPT-2 family session.
+//
+// All tensors (input ids, attention mask, KV cache, logits) live in buffers sized
+// once at construction and are handed to ORT through an IoBinding, so present.*
+// outputs land directly in the cache instead of in fresh ORT allocations.
+class Gpt2Decoder {
+public:
+    // max_step_tokens caps how many tokens one step() may feed (prefill chunk size).
+    // Models exported with a static sequence axis are always stepped one token at a time.
+    Gpt2Decoder(Ort::Session& session, int64_t max_seq_len, int64_t max_step_tokens = 32);
+
+    // Append `count` tokens to the sequence. Returns logits laid out as
+    // [count, vocab_size]; the pointer stays valid until the next step().
+    const float* step(const int64_t* ids, int64_t count);
+
+    // Feed a whole prompt in max_step_tokens chunks; returns the last token's logits.
+    const float* prefill(const std::vector<int64_t>& ids);
+
+    KvCache& cache() { return cache_; }
+    const Gpt2Dims& dims() const { return cache_.dims(); }
+    int64_t max_step_tokens() const { return max_step_tokens_; }
+
+private:
+    Gpt2Runner runner_;
+    KvCache cache_;
+    int64_t max_step_tokens_;
+
+    std::vector<int64_t> mask_;
+    std::vector<int64_t> positions_;
+    std::vector<float> logits_;
+    std::vector<float*> past_;
+    std::vector<float*> present_;
+};
+
+#endif // GPT2_DECODER_H
@@ -0,0 +1,136 @@
+#include "hdr_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+int floor_log2(int64_t v) {
+    return 63 - __builtin_clzll(static_cast<unsigned long long>(v));
+}
+}  // namespace
+
+HdrHistogram::HdrHistogram(int64_t lowest, int64_t highest, int significant_figures)
+    : lowest_(std::max<int64_t>(lowest, 1)), highest_(highest) {
+    if (significant_figures < 1 || significant_figures > 5) {
+        throw std::runtime_error("HdrHistogram: significant figures must be 1..5");
+    }
+    if (highest_ < 2 * lowest_) throw std::runtime_error("HdrHistogram: highest must be at least 2 * lowest");
+
+    // Sub-buckets per power of two needed to resolve 1 part in 10^figures.
+    const int64_t resolution = 2 * static_cast<int64_t>(std::pow(10, significant_figures));
+    const int sub_bucket_count_magnitude = static_cast<int>(std::ceil(std::log2(static_cast<double>(resolution))));
+    sub_bucket_half_count_magnitude_ = std::max(sub_bucket_count_magnitude, 1) - 1;
+    unit_magnitude_ = floor_log2(lowest_);
+    sub_bucket_count_ = int64_t{1} << (sub_bucket_half_count_magnitude_ + 1);
+    sub_bucket_half_count_ = sub_bucket_count_ / 2;
+    sub_bucket_mask_ = (sub_bucket_count_ - 1) << unit_magnitude_;
+
+    int buckets = 1;
+    int64_t smallest_untrackable = sub_bucket_count_ << unit_magnitude_;
+    while (smallest_untrackable <= highest_) {
+        if (smallest_untrackable > INT64_MAX / 2) {
+            ++buckets;
+            break;
+        }
+        smallest_untrackable <<= 1;
+        ++buckets;
+    }
+    counts_.assign(static_cast<size_t>((buckets + 1) * sub_bucket_half_count_), 0);
+}
+
+int HdrHistogram::bucket_index(int64_t value) const {
+    const int pow2_ceiling = 64 - __builtin_clzll(static_cast<unsigned long long>(value | sub_bucket_mask_));
+    return pow2_ceiling - unit_magnitude_ - (sub_bucket_half_count_magnitude_ + 1);
+}
+
+int HdrHistogram::sub_bucket_index(int64_t value, int bucket) const {
+    return static_cast<int>(value >> (bucket + unit_magnitude_));
+}
+
+size_t HdrHistogram::counts_index(int64_t value) const {
+    const int bucket = bucket_index(value);
+    const int sub = sub_bucket_index(value, bucket);
+    return static_cast<size_t>(((int64_t{bucket} + 1) << sub_bucket_half_count_magnitude_) +
+                               (sub - sub_bucket_half_count_));
+}
+
+int64_t HdrHistogram::value_from_index(size_t index) const {
+    int64_t bucket = (static_cast<int64_t>(index) >> sub_bucket_half_count_magnitude_) - 1;
+    int64_t sub = (static_cast<int64_t>(index) & (sub_bucket_half_count_ - 1)) + sub_bucket_half_count_;
+    if (bucket < 0) {
+        sub -= sub_bucket_half_count_;
+        bucket = 0;
+    }
+    return sub << (bucket + unit_magnitude_);
+}
+
+int64_t HdrHistogram::highest_equivalent(int64_t value) const {
+    const int bucket = bucket_index(value);
+    const int sub = sub_bucket_index(value, bucket);
+    const int64_t lowest_equivalent = int64_t{sub} << (bucket + unit_magnitude_);
+    const int adjusted = sub >= sub_bucket_count_ ? bucket + 1 : bucket;
+    return lowest_equivalent + (int64_t{1} << (unit_magnitude_ + adjusted)) - 1;
+}
+
+void HdrHistogram::record(int64_t value, int64_t count) {
+    if (count <= 0) return;
+    value = std::max<int64_t>(value, 0);
+    if (value > highest_) {
+        value = highest_;
+        saturated_ += count;
+    }
+    counts_[counts_index(value)] += count;
+    total_ += count;
+    min_ = std::min(min_, value);
+    max_ = std::max(max_, value);
+    sum_ += static_cast<double>(value) * static_cast<double>(count);
+}
+
+void HdrHistogram::record_corrected(int64_t value, int64_t expected_interval) {
+    record(value);
+    if (expected_interval <= 0) return;
+    for (int64_t missing = value - expected_interval; missing >= expected_interval; missing -= expected_interval) {
+        record(missing);
+    }
+}
+
+void HdrHistogram::merge(const HdrHistogram& other) {
+    if (other.counts_.size() != counts_.size() || other.unit_magnitude_ != unit_magnitude_ ||
+        other.sub_bucket_count_ != sub_bucket_count_) {
+        throw std::runtime_error("HdrHistogram: cannot merge histograms with different layouts");
+    }
+    for (size_t i = 0; i < counts_.size(); ++i) counts_[i] += other.counts_[i];
+    total_ += other.total_;
+    saturated_ += other.saturated_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+    sum_ += other.sum_;
+}
+
+void HdrHistogram::reset() {
+    std::fill(counts_.begin(), counts_.end(), 0);
+    total_ = saturated_ = 0;
+    min_ = INT64_MAX;
+    max_ = 0;
+    sum_ = 0.0;
+}
+
+int64_t HdrHistogram::min() const { return total_ ? min_ : 0; }
+
+int64_t HdrHistogram::max() const { return max_; }
+
+double HdrHistogram::mean() const { return total_ ? sum_ / static_cast<double>(total_) : 0.0; }
+
+int64_t HdrHistogram::value_at_percentile(double percentile) const {
+    if (total_ == 0) return 0;
+    percentile = std::min(std::max(percentile, 0.0), 100.0);
+    const int64_t wanted =
+        std::max<int64_t>(1, static_cast<int64_t>(std::llround(percentile / 100.0 * static_cast<double>(total_))));
+    int64_t seen = 0;
+    for (size_t i = 0; i < counts_.size(); ++i) {
+        seen += counts_[i];
+        if (seen >= wanted) return std::min(highest_equivalent(value_from_index(i)), max_);
+    }
+    return max_;
+}
@@ -0,0 +1,50 @@
+#ifndef INFER_REQUEST_H
+#define INFER_REQUEST_H
+
+#include "../../junctiond/json.hpp"
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Body handling shared by the gateway's /infer routes (and their benchmarks).
+
+// Check the input_ids/attention_mask arrays of a parsed /infer body. Returns the
+// message to answer 400 with, or nullptr if the body is usable.
+inline const char* check_token_arrays(const nlohmann::json& body) {
+    if (!body.contains("input_ids") || !body.contains("attention_mask")) {
+        return "input_ids and attention_mask required";
+    }
+    const auto& ids = body["input_ids"];
+    const auto& mask = body["attention_mask"];
+    if (!ids.is_array() || !mask.is_array()) return "input_ids and attention_mask must be arrays";
+    if (ids.size() != mask.size() || ids.empty()) return "input_ids and attention_mask length mismatch or empty";
+    return nullptr;
+}
+
+// Copy the arrays of a body that passed check_token_arrays().
+inline void read_token_arrays(const nlohmann::json& body, std::vector<int64_t>& ids, std::vector<int64_t>& mask) {
+    const auto& ids_j = body["input_ids"];
+    const auto& mask_j = body["attention_mask"];
+    ids.clear();
+    mask.clear();
+    ids.reserve(ids_j.size());
+    mask.reserve(mask_j.size());
+    for (size_t i = 0; i < ids_j.size(); ++i) {
+        ids.push_back(ids_j.at(i).get<int64_t>());
+        mask.push_back(mask_j.at(i).get<int64_t>());
+    }
+}
+
+// "101 2023 102": the form distilbert_infer takes its inputs in on the command line.
+inline std::string to_space_separated(const std::vector<int64_t>& vals) {
+    std::ostringstream os;
+    for (size_t i = 0; i < vals.size(); ++i) {
+        if (i) os << ' ';
+        os << vals[i];
+    }
+    return os.str();
+}
+
+#endif // INFER_REQUEST_H
@@ -0,0 +1,85 @@
+#include "kv_cache.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+Gpt2Dims discover_gpt2_dims(Ort::Session& session) {
+    Ort::AllocatorWithDefaultOptions allocator;
+    Gpt2Dims dims;
+
+    size_t num_inputs = session.GetInputCount();
+    for (size_t i = 0; i < num_inputs; ++i) {
+        auto name = session.GetInputNameAllocated(i, allocator);
+        std::string n = name.get();
+        if (n.rfind("past.", 0) != 0) continue;
+        if (n.size() > 4 && n.compare(n.size() - 4, 4, ".key") == 0) {
+            ++dims.num_layers;
+        }
+        if (dims.num_heads == 0) {
+            auto shape = session.GetInputTypeInfo(i).GetTensorTypeAndShapeInfo().GetShape();
+            if (shape.size() != 4 || shape[1] <= 0 || shape[3] <= 0) {
+                throw std::runtime_error("Unexpected past tensor shape for " + n);
+            }
+            dims.num_heads = static_cast<int>(shape[1]);
+            dims.head_dim = static_cast<int>(shape[3]);
+        }
+    }
+
+    size_t num_outputs = session.GetOutputCount();
+    for (size_t i = 0; i < num_outputs; ++i) {
+        auto name = session.GetOutputNameAllocated(i, allocator);
+        if (std::string(name.get()) != "logits") continue;
+        auto shape = session.GetOutputTypeInfo(i).GetTensorTypeAndShapeInfo().GetShape();
+        if (shape.size() != 3 || shape[2] <= 0) {
+            throw std::runtime_error("Unexpected logits shape");
+        }
+        dims.vocab_size = shape[2];
+    }
+
+    if (dims.num_layers == 0 || dims.vocab_size == 0) {
+        throw std::runtime_error("Model does not look like a GPT-2 decoder with past inputs");
+    }
+    return dims;
+}
+
+KvCache::KvCache(const Gpt2Dims& dims, int64_t max_seq_len)
+    : dims_(dims),
+      max_seq_len_(max_seq_len),
+      slot_floats_(static_cast<size_t>(dims.token_stride() * max_seq_len)) {
+    if (max_seq_len <= 0) {
+        throw std::runtime_error("KvCache max_seq_len must be positive");
+    }
+    const size_t total = slot_floats_ * dims.num_layers * 2;
+    storage_[0].assign(total, 0.0f);
+    storage_[1].assign(total, 0.0f);
+}
+
+void KvCache::commit(int64_t new_tokens) {
+    if (length_ + new_tokens > max_seq_len_) {
+        throw std::runtime_error("KvCache overflow: " + std::to_string(length_ + new_tokens) +
+                                 " > " + std::to_string(max_seq_len_));
+    }
+    length_ += new_tokens;
+    cur_ ^= 1;
+}
+
+void KvCache::truncate(int64_t len) {
+    if (len >= length_) return;
+    if (len < 0) len = 0;
+
+    // Tensors are [1, heads, length, head_dim]; shrinking the seq axis changes every
+    // head's offset, so slide heads 1..H-1 down. dst never passes src, so memmove is safe.
+    const size_t row = static_cast<size_t>(dims_.head_dim);
+    for (int layer = 0; layer < dims_.num_layers; ++layer) {
+        for (int kv = 0; kv < 2; ++kv) {
+            float* base = past(layer, kv);
+            for (int h = 1; h < dims_.num_heads; ++h) {
+                std::memmove(base + h * len * row,
+                             base + h * length_ * row,
+                             static_cast<size_t>(len) * row * sizeof(float));
+            }
+        }
+    }
+    length_ = len;
+}
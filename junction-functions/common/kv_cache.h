@@ -0,0 +1,65 @@
+#ifndef KV_CACHE_H
+#define KV_CACHE_H
+
+#include <onnxruntime_cxx_api.h>
+
+#include <cstdint>
+#include <vector>
+
+// Shape of a GPT-2 family decoder as exported by models/export_*gpt2_onnx.py:
+// inputs  input_ids, attention_mask, past.{i}.key, past.{i}.value
+// outputs logits, present.{i}.key, present.{i}.value
+// with every past/present tensor laid out as [batch, heads, seq, head_dim].
+struct Gpt2Dims {
+    int num_layers = 0;
+    int num_heads = 0;
+    int head_dim = 0;
+    int64_t vocab_size = 0;
+
+    // Floats held by one key (or value) tensor for a single token.
+    int64_t token_stride() const { return static_cast<int64_t>(num_heads) * head_dim; }
+};
+
+// Read layer count, heads, head_dim and vocab size from the session's metadata.
+Gpt2Dims discover_gpt2_dims(Ort::Session& session);
+
+// Preallocated, max-length KV cache for one sequence.
+//
+// ORT needs each past/present tensor to be contiguous, and because the layout is
+// [1, heads, seq, head_dim] the present for step t cannot alias the past for step t
+// in place (every head's row shifts by one token). Instead the cache keeps two
+// max-length buffers per layer and ping-pongs between them: step t reads past from
+// one and the model writes present straight into the other. Nothing is allocated or
+// copied by us after construction, so per-step cost no longer grows with reallocs.
+class KvCache {
+public:
+    KvCache(const Gpt2Dims& dims, int64_t max_seq_len);
+
+    int64_t length() const { return length_; }
+    int64_t capacity() const { return max_seq_len_; }
+    const Gpt2Dims& dims() const { return dims_; }
+
+    // kv: 0 = key, 1 = value.
+    float* past(int layer, int kv) { return slot(cur_, layer, kv); }
+    float* present(int layer, int kv) { return slot(cur_ ^ 1, layer, kv); }
+
+    // Call after a successful Run that appended `new_tokens` positions.
+    void commit(int64_t new_tokens);
+    // Drop everything past `len` tokens (used to roll back rejected tokens).
+    void truncate(int64_t len);
+    void reset() { length_ = 0; }
+
+private:
+    float* slot(int buf, int layer, int kv) {
+        return storage_[buf].data() + (static_cast<size_t>(layer) * 2 + kv) * slot_floats_;
+    }
+
+    Gpt2Dims dims_;
+    int64_t max_seq_len_;
+    size_t slot_floats_;
+    std::vector<float> storage_[2];
+    int cur_ = 0;
+    int64_t length_ = 0;
+};
+
+#endif // KV_CACHE_H
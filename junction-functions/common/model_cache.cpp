@@ -0,0 +1,91 @@
+#include "model_cache.h"
+
+#include <onnxruntime_session_options_config_keys.h>
+
+#include <cinttypes>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+const char* level_name(GraphOptimizationLevel level) {
+    switch (level) {
+        case GraphOptimizationLevel::ORT_DISABLE_ALL: return "none";
+        case GraphOptimizationLevel::ORT_ENABLE_BASIC: return "basic";
+        case GraphOptimizationLevel::ORT_ENABLE_EXTENDED: return "extended";
+        default: return "all";
+    }
+}
+
+// FNV-1a over the model bytes. Not cryptographic; it only has to tell exports apart.
+uint64_t hash_file(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) throw std::runtime_error("cannot open model " + path);
+    uint64_t h = 1469598103934665603ull;
+    std::vector<char> buf(1 << 20);
+    while (in) {
+        in.read(buf.data(), static_cast<std::streamsize>(buf.size()));
+        for (std::streamsize i = 0; i < in.gcount(); ++i) {
+            h ^= static_cast<unsigned char>(buf[i]);
+            h *= 1099511628211ull;
+        }
+    }
+    return h;
+}
+}  // namespace
+
+bool is_optimized_model(const std::string& path) {
+    return fs::path(path).extension() == ".ort";
+}
+
+void configure_model_load(Ort::SessionOptions& opts, const std::string& model_path) {
+    if (is_optimized_model(model_path)) {
+        opts.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_DISABLE_ALL);
+        opts.AddConfigEntry(kOrtSessionOptionsConfigLoadModelFormat, "ORT");
+    } else {
+        opts.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_ENABLE_ALL);
+    }
+}
+
+std::string optimized_model_path(const std::string& model_path, const std::string& cache_dir,
+                                  GraphOptimizationLevel level) {
+    char hash[17];
+    std::snprintf(hash, sizeof(hash), "%016" PRIx64, hash_file(model_path));
+    const std::string stem = fs::path(model_path).stem().string();
+    const std::string name = std::string(hash) + "-ort" + Ort::GetVersionString() + "-" + level_name(level) + ".ort";
+    return (fs::path(cache_dir) / stem / name).string();
+}
+
+CompiledModel compile_optimized_model(Ort::Env& env, const std::string& model_path,
+                                      const std::string& cache_dir, GraphOptimizationLevel level,
+                                      bool force) {
+    if (is_optimized_model(model_path)) {
+        throw std::runtime_error(model_path + " is already an optimized artifact");
+    }
+    const fs::path out = optimized_model_path(model_path, cache_dir, level);
+    const bool cached = !force && fs::exists(out);
+
+    if (!cached) {
+        fs::create_directories(out.parent_path());
+        // Write next to the final name and rename, so a crashed compile never
+        // leaves a truncated artifact that a later run would treat as a hit.
+        const fs::path tmp = out.string() + ".tmp";
+        Ort::SessionOptions opts;
+        opts.SetGraphOptimizationLevel(level);
+        opts.SetOptimizedModelFilePath(tmp.c_str());
+        opts.AddConfigEntry(kOrtSessionOptionsConfigSaveModelFormat, "ORT");
+        Ort::Session session(env, model_path.c_str(), opts);
+        fs::rename(tmp, out);
+    }
+
+    const fs::path current = out.parent_path() / "current.ort";
+    const fs::path staged = out.parent_path() / "current.ort.tmp";
+    fs::remove(staged);
+    fs::create_symlink(out.filename(), staged);
+    fs::rename(staged, current);
+    return {out.string(), cached};
+}
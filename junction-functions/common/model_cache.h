@@ -0,0 +1,47 @@
+#ifndef MODEL_CACHE_H
+#define MODEL_CACHE_H
+
+#include <onnxruntime_cxx_api.h>
+
+#include <string>
+
+// Pre-optimized model artifacts.
+//
+// Creating a session from a raw .onnx export runs ORT's graph optimizer every
+// time, which dominates cold start for the function binaries. model_compile runs
+// that optimizer once and saves the result in ORT format under a versioned cache:
+//
+//   <cache_dir>/<model stem>/<fingerprint>.ort   one artifact per input version
+//   <cache_dir>/<model stem>/current.ort         symlink to the latest compile
+//
+// The fingerprint covers the model bytes, the ORT version and the optimization
+// level, so a re-exported model or an ORT upgrade gets a fresh artifact instead of
+// silently loading a stale one. Artifacts compiled at ORT_ENABLE_ALL may contain
+// layout transforms for the compiling CPU's ISA; compile on the hardware the
+// functions run on, or use ORT_ENABLE_EXTENDED for portable artifacts.
+
+// True for ORT-format artifacts (".ort"), which are loaded as already optimized.
+bool is_optimized_model(const std::string& path);
+
+// Set the optimization level and load format `opts` should use for `model_path`:
+// the full optimizer for a raw .onnx export, none at all for a compiled artifact.
+void configure_model_load(Ort::SessionOptions& opts, const std::string& model_path);
+
+// Cache path the artifact for `model_path` compiled at `level` would have. Reads
+// the whole model to fingerprint it.
+std::string optimized_model_path(const std::string& model_path, const std::string& cache_dir,
+                                 GraphOptimizationLevel level);
+
+struct CompiledModel {
+    std::string path;   // versioned artifact
+    bool cached;        // true if it already existed and nothing was compiled
+};
+
+// Optimize `model_path` at `level` into the cache unless an artifact with the same
+// fingerprint exists (or `force`), then point current.ort at it.
+CompiledModel compile_optimized_model(Ort::Env& env, const std::string& model_path,
+                                      const std::string& cache_dir,
+                                      GraphOptimizationLevel level = GraphOptimizationLevel::ORT_ENABLE_ALL,
+                                      bool force = false);
+
+#endif // MODEL_CACHE_H
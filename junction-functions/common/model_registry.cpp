@@ -0,0 +1,85 @@
+#include "model_registry.h"
+
+#include "../../junctiond/json.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+using json = nlohmann::json;
+
+struct ModelRegistry::Data {
+    json models;
+};
+
+namespace {
+std::string join_keys(const json& obj) {
+    std::string out;
+    for (auto it = obj.begin(); it != obj.end(); ++it) {
+        if (!out.empty()) out += ", ";
+        out += it.key();
+    }
+    return out;
+}
+}  // namespace
+
+ModelRegistry::ModelRegistry(const std::string& path) : data_(std::make_unique<Data>()) {
+    std::ifstream in(path);
+    if (!in) throw std::runtime_error("cannot open model registry " + path);
+    json doc = json::parse(in);
+    if (!doc.contains("models") || !doc["models"].is_object()) {
+        throw std::runtime_error(path + " has no \"models\" object");
+    }
+    data_->models = std::move(doc["models"]);
+
+    const std::filesystem::path base = std::filesystem::path(path).parent_path();
+    for (auto& [model, entry] : data_->models.items()) {
+        if (!entry.contains("variants") || !entry["variants"].is_object() || entry["variants"].empty()) {
+            throw std::runtime_error("registry model '" + model + "' has no variants");
+        }
+        for (auto& [name, variant] : entry["variants"].items()) {
+            std::filesystem::path p = variant.at("path").get<std::string>();
+            if (p.is_relative()) variant["path"] = (base / p).lexically_normal().string();
+        }
+    }
+}
+
+ModelRegistry::~ModelRegistry() = default;
+
+ModelVariant ModelRegistry::resolve(const std::string& model, const std::string& variant) const {
+    auto m = data_->models.find(model);
+    if (m == data_->models.end()) {
+        throw std::runtime_error("unknown model '" + model + "' (registered: " + join_keys(data_->models) + ")");
+    }
+    const json& variants = (*m)["variants"];
+    std::string name = variant;
+    if (name.empty()) name = m->value("default", variants.begin().key());
+
+    auto v = variants.find(name);
+    if (v == variants.end()) {
+        throw std::runtime_error("model '" + model + "' has no variant '" + name + "' (available: " +
+                                 join_keys(variants) + ")");
+    }
+    return {model, name, (*v)["path"].get<std::string>(), v->value("precision", name)};
+}
+
+std::vector<std::string> ModelRegistry::models() const {
+    std::vector<std::string> out;
+    for (auto it = data_->models.begin(); it != data_->models.end(); ++it) out.push_back(it.key());
+    return out;
+}
+
+std::vector<std::string> ModelRegistry::variants(const std::string& model) const {
+    std::vector<std::string> out;
+    auto m = data_->models.find(model);
+    if (m == data_->models.end()) return out;
+    const json& variants = (*m)["variants"];
+    for (auto it = variants.begin(); it != variants.end(); ++it) out.push_back(it.key());
+    return out;
+}
+
+std::string ModelRegistry::describe(const std::string& model) const {
+    auto m = data_->models.find(model);
+    if (m == data_->models.end()) throw std::runtime_error("unknown model '" + model + "'");
+    return m->dump();
+}
@@ -0,0 +1,46 @@
+#ifndef MODEL_REGISTRY_H
+#define MODEL_REGISTRY_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// One precision variant of a registered model.
+struct ModelVariant {
+    std::string model;      // registry key, e.g. "distilbert"
+    std::string name;       // variant key, e.g. "fp32" or "int8"
+    std::string path;       // absolute, or relative to the working directory
+    std::string precision;
+};
+
+// Read-only view of the registry written by models/quantize_onnx.py:
+//
+//   {"models": {"distilbert": {"task": "classification", "default": "fp32",
+//     "variants": {"fp32": {"path": "distilbert.onnx", "precision": "fp32",
+//                           "size_mb": ..., "latency_ms_p50": {...}, "accuracy": {...}},
+//                  "int8": {...}}}}}
+//
+// Variant paths are stored relative to the registry file and resolved against
+// its directory on load. Everything besides path and precision is metadata that
+// describe() passes through untouched.
+class ModelRegistry {
+public:
+    explicit ModelRegistry(const std::string& path);
+    ~ModelRegistry();
+
+    // `variant` of `model`, or the model's default variant when `variant` is
+    // empty. Throws std::runtime_error naming the known choices otherwise.
+    ModelVariant resolve(const std::string& model, const std::string& variant = "") const;
+
+    std::vector<std::string> models() const;
+    std::vector<std::string> variants(const std::string& model) const;
+
+    // The registry entry for `model` (all variants and their metadata) as JSON.
+    std::string describe(const std::string& model) const;
+
+private:
+    struct Data;
+    std::unique_ptr<Data> data_;
+};
+
+#endif // MODEL_REGISTRY_H
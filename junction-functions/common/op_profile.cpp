@@ -0,0 +1,189 @@
+#include "op_profile.h"
+
+#include "../../junctiond/json.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include <unistd.h>
+
+using json = nlohmann::json;
+
+namespace {
+const std::string kKernelSuffix = "_kernel_time";
+}  // namespace
+
+OpProfiler::OpProfiler(std::string service, OpProfileConfig cfg) : service_(std::move(service)), cfg_(std::move(cfg)) {
+    cfg_.runs_per_file = std::max(1, cfg_.runs_per_file);
+}
+
+void OpProfiler::set_rate(double rate) {
+    rate_.store(std::min(1.0, std::max(0.0, rate)), std::memory_order_relaxed);
+}
+
+bool OpProfiler::sample(const std::string& header) {
+    if (header == "1") return true;
+    if (header == "0") return false;
+    const double r = rate();
+    if (r <= 0.0) return false;
+    // Request n is sampled when n * rate crosses an integer: exactly rate of them,
+    // evenly spaced, with no shared RNG.
+    const uint64_t n = seen_.fetch_add(1, std::memory_order_relaxed);
+    return std::floor(static_cast<double>(n + 1) * r) > std::floor(static_cast<double>(n) * r);
+}
+
+void OpProfiler::collect(Ort::Session& session, int skip_runs) {
+    Ort::AllocatorWithDefaultOptions allocator;
+    Ort::AllocatedStringPtr file = session.EndProfilingAllocated(allocator);
+    const std::string path = file.get();
+    std::ifstream in(path);
+    std::stringstream text;
+    text << in.rdbuf();
+    try {
+        add_trace(text.str(), skip_runs);
+    } catch (const std::exception& e) {
+        std::cerr << service_ << ": cannot read ORT profile " << path << ": " << e.what() << "\n";
+    }
+    std::remove(path.c_str());
+}
+
+int OpProfiler::add_trace(const std::string& text, int skip_runs) {
+    const json events = json::parse(text);
+
+    // Runs are the Session "model_run" events; node events before the end of the
+    // last skipped run belong to warm-up.
+    std::vector<std::pair<int64_t, int64_t>> runs;  // ts, dur (us)
+    for (const auto& e : events) {
+        if (e.value("cat", "") == "Session" && e.value("name", "") == "model_run") {
+            runs.emplace_back(e.value("ts", int64_t{0}), e.value("dur", int64_t{0}));
+        }
+    }
+    std::sort(runs.begin(), runs.end());
+    const size_t skipped = std::min(runs.size(), static_cast<size_t>(std::max(0, skip_runs)));
+    const int64_t counted_from = skipped ? runs[skipped - 1].first + runs[skipped - 1].second : INT64_MIN;
+
+    std::lock_guard<std::mutex> lk(mtx_);
+    for (const auto& e : events) {
+        if (e.value("cat", "") != "Node") continue;
+        const std::string name = e.value("name", "");
+        if (name.size() <= kKernelSuffix.size() ||
+            name.compare(name.size() - kKernelSuffix.size(), kKernelSuffix.size(), kKernelSuffix) != 0) {
+            continue;  // fences and thread-pool stats
+        }
+        if (e.value("ts", int64_t{0}) < counted_from) continue;
+        const double us = static_cast<double>(e.value("dur", int64_t{0}));
+        std::string op = "?";
+        if (e.contains("args") && e["args"].contains("op_name")) op = e["args"]["op_name"].get<std::string>();
+
+        Totals& t = by_op_[op];
+        ++t.calls;
+        t.us += us;
+        auto& node = by_node_[name.substr(0, name.size() - kKernelSuffix.size())];
+        node.first = op;
+        ++node.second.calls;
+        node.second.us += us;
+    }
+    for (size_t i = skipped; i < runs.size(); ++i) run_us_ += static_cast<double>(runs[i].second);
+    runs_ += runs.size() - skipped;
+    ++traces_;
+    return static_cast<int>(runs.size() - skipped);
+}
+
+std::string OpProfiler::report(size_t top) const {
+    std::lock_guard<std::mutex> lk(mtx_);
+    double kernel_us = 0;
+    for (const auto& [op, t] : by_op_) kernel_us += t.us;
+
+    auto entry = [&](const Totals& t) {
+        return json{{"calls", t.calls},
+                    {"total_ms", t.us / 1e3},
+                    {"mean_us", t.calls ? t.us / static_cast<double>(t.calls) : 0.0},
+                    {"per_run_ms", runs_ ? t.us / 1e3 / static_cast<double>(runs_) : 0.0},
+                    {"share", kernel_us > 0 ? t.us / kernel_us : 0.0}};
+    };
+
+    std::vector<std::pair<double, json>> ops;
+    for (const auto& [op, t] : by_op_) {
+        json j = entry(t);
+        j["op"] = op;
+        ops.emplace_back(t.us, std::move(j));
+    }
+    std::vector<std::pair<double, json>> nodes;
+    for (const auto& [node, v] : by_node_) {
+        json j = entry(v.second);
+        j["node"] = node;
+        j["op"] = v.first;
+        nodes.emplace_back(v.second.us, std::move(j));
+    }
+    auto top_of = [top](std::vector<std::pair<double, json>>& items) {
+        std::sort(items.begin(), items.end(),
+                  [](const auto& a, const auto& b) { return a.first > b.first; });
+        json out = json::array();
+        for (size_t i = 0; i < items.size() && i < top; ++i) out.push_back(std::move(items[i].second));
+        return out;
+    };
+
+    json r{{"service", service_},
+           {"rate", rate()},
+           {"profiled_runs", runs_},
+           {"pending_runs", pending_.load(std::memory_order_relaxed)},
+           {"traces", traces_},
+           {"run_ms", run_us_ / 1e3},
+           {"kernel_ms", kernel_us / 1e3},
+           {"ops", top_of(ops)},
+           {"nodes", top_of(nodes)}};
+    return r.dump();
+}
+
+void OpProfiler::reset() {
+    std::lock_guard<std::mutex> lk(mtx_);
+    by_op_.clear();
+    by_node_.clear();
+    runs_ = 0;
+    traces_ = 0;
+    run_us_ = 0;
+}
+
+ProfiledSession::ProfiledSession(OpProfiler& profiler, const std::string& owner, Factory make)
+    : profiler_(profiler),
+      // ORT appends only a timestamp, so instances of one service need the pid.
+      prefix_(profiler.config().dir + "/" + profiler.service() + "-" + std::to_string(getpid()) + "-" + owner),
+      make_(std::move(make)) {}
+
+ProfiledSession::~ProfiledSession() {
+    try {
+        flush();
+    } catch (const std::exception& e) {
+        std::cerr << profiler_.service() << ": " << e.what() << "\n";
+    }
+}
+
+Ort::Session& ProfiledSession::session() {
+    if (!session_) {
+        session_ = make_(prefix_);
+        runs_ = 0;
+        skip_ = 0;
+    }
+    return *session_;
+}
+
+bool ProfiledSession::finish_run(int runs) {
+    const int counted = std::max(0, runs_ - skip_);
+    runs_ += runs;
+    profiler_.add_pending(std::max(0, runs_ - skip_) - counted);
+    return runs_ - skip_ >= profiler_.config().runs_per_file;
+}
+
+void ProfiledSession::flush() {
+    if (!session_) return;
+    std::unique_ptr<Ort::Session> done = std::move(session_);
+    profiler_.add_pending(-std::max(0, runs_ - skip_));
+    // Always ended here: ORT would otherwise write the trace when the session is freed.
+    profiler_.collect(*done, skip_);
+}
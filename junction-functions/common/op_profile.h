@@ -0,0 +1,115 @@
+#ifndef OP_PROFILE_H
+#define OP_PROFILE_H
+
+// Per-operator time from ONNX Runtime's profiler, for a sampled fraction of
+// requests, switched on and off while the service runs.
+//
+// ORT (1.16) profiles whole sessions: profiling is fixed when a session is built
+// and the trace is written only when it ends, after which that session cannot
+// profile again. So the normal sessions are never profiled. A sampled request runs
+// on a second session built with profiling on (ProfiledSession). Every
+// runs_per_file profiled runs, that session's trace is ended, folded into the
+// OpProfiler's per-operator totals, deleted, and the session is rebuilt on the
+// next sampled request. Requests that are not sampled never touch it, and a rate
+// of 0 (the default) costs one relaxed load per request.
+
+#include <onnxruntime_cxx_api.h>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+// Request header that overrides sampling: "1" profiles the request, "0" never does.
+constexpr const char* kOrtProfileHeader = "X-Ort-Profile";
+
+struct OpProfileConfig {
+    std::string dir = "/tmp";  // where ORT writes its traces before they are folded in
+    int runs_per_file = 16;    // profiled runs per profiling session
+};
+
+class OpProfiler {
+public:
+    explicit OpProfiler(std::string service, OpProfileConfig cfg = {});
+
+    // Fraction of requests to profile, 0 to 1; 0 turns sampling off.
+    void set_rate(double rate);
+    double rate() const { return rate_.load(std::memory_order_relaxed); }
+
+    // Whether to profile one request, given its kOrtProfileHeader value (empty if
+    // absent). Sampling is deterministic: exactly every 1/rate-th request.
+    bool sample(const std::string& header);
+
+    // End `session`'s profiling and fold its trace into the totals, leaving out the
+    // first `skip_runs` runs (warm-up). The trace file is deleted.
+    void collect(Ort::Session& session, int skip_runs);
+    // Fold in an ORT trace (the JSON array ORT writes). Returns the runs counted.
+    int add_trace(const std::string& text, int skip_runs);
+
+    // Runs profiled but still held by a profiling session.
+    void add_pending(int n) { pending_.fetch_add(n, std::memory_order_relaxed); }
+
+    // Top `top` operator types and nodes by total kernel time, as JSON.
+    std::string report(size_t top) const;
+    void reset();
+
+    const OpProfileConfig& config() const { return cfg_; }
+    const std::string& service() const { return service_; }
+
+private:
+    struct Totals {
+        uint64_t calls = 0;
+        double us = 0;
+    };
+
+    std::string service_;
+    OpProfileConfig cfg_;
+    std::atomic<double> rate_{0.0};
+    std::atomic<uint64_t> seen_{0};
+    std::atomic<int64_t> pending_{0};
+
+    mutable std::mutex mtx_;
+    std::map<std::string, Totals> by_op_;
+    std::map<std::string, std::pair<std::string, Totals>> by_node_;  // node -> op type, totals
+    uint64_t runs_ = 0;
+    uint64_t traces_ = 0;
+    double run_us_ = 0;
+};
+
+// The profiling session of one thread (a worker, the decode loop): built on first
+// use and handed to the profiler every runs_per_file runs. Not thread-safe.
+class ProfiledSession {
+public:
+    // `make` builds a session whose options have EnableProfiling(prefix) applied.
+    using Factory = std::function<std::unique_ptr<Ort::Session>(const std::string& prefix)>;
+
+    ProfiledSession(OpProfiler& profiler, const std::string& owner, Factory make);
+    ~ProfiledSession();
+    ProfiledSession(const ProfiledSession&) = delete;
+    ProfiledSession& operator=(const ProfiledSession&) = delete;
+
+    bool built() const { return session_ != nullptr; }
+    Ort::Session& session();
+    // Leave the next `n` runs out of the totals (warm-up after a build).
+    void skip_runs(int n) { skip_ += n; }
+
+    // Call after each profiled request with the number of Session::Run calls it
+    // made. True when the trace is due: release anything that refers to
+    // session(), then call flush().
+    bool finish_run(int runs = 1);
+    // Fold in what has been profiled so far and drop the session.
+    void flush();
+
+private:
+    OpProfiler& profiler_;
+    std::string prefix_;
+    Factory make_;
+    std::unique_ptr<Ort::Session> session_;
+    int runs_ = 0;
+    int skip_ = 0;
+};
+
+#endif // OP_PROFILE_H
@@ -0,0 +1,300 @@
+#include "paged_kv_cache.h"
+
+#include "prefix_cache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+KvBlockPool::KvBlockPool(const Gpt2Dims& dims, int block_tokens, int num_blocks)
+    : dims_(dims),
+      block_tokens_(block_tokens),
+      num_blocks_(num_blocks),
+      head_floats_(static_cast<size_t>(block_tokens) * dims.head_dim),
+      block_floats_(head_floats_ * dims.num_heads * dims.num_layers * 2) {
+    if (block_tokens <= 0 || num_blocks <= 0) {
+        throw std::runtime_error("KvBlockPool needs positive block_tokens and num_blocks");
+    }
+    storage_.assign(block_floats_ * num_blocks, 0.0f);
+    free_list_.reserve(num_blocks);
+    refs_.assign(num_blocks, 0);
+    // Hand out low ids first so a lightly loaded pool stays in few pages.
+    for (int b = num_blocks - 1; b >= 0; --b) free_list_.push_back(b);
+}
+
+int KvBlockPool::allocate() {
+    if (free_list_.empty()) return -1;
+    int b = free_list_.back();
+    free_list_.pop_back();
+    refs_[b] = 1;
+    return b;
+}
+
+void KvBlockPool::release(int block) {
+    if (block < 0 || block >= num_blocks_ || refs_[block] <= 0) {
+        throw std::runtime_error("KvBlockPool::release: bad block " + std::to_string(block));
+    }
+    if (--refs_[block] == 0) free_list_.push_back(block);
+}
+
+PagedKvCache::PagedKvCache(const Gpt2Dims& dims, int block_tokens, int num_blocks)
+    : pool_(dims, block_tokens, num_blocks) {}
+
+void PagedKvCache::add_sequence(SeqId id) {
+    if (!tables_.emplace(id, BlockTable{}).second) {
+        throw std::runtime_error("PagedKvCache: sequence " + std::to_string(id) + " already exists");
+    }
+    admission_order_.push_back(id);
+}
+
+void PagedKvCache::remove_sequence(SeqId id) {
+    auto it = tables_.find(id);
+    if (it == tables_.end()) return;
+    free_blocks(it->second);
+    tables_.erase(it);
+    admission_order_.erase(std::find(admission_order_.begin(), admission_order_.end(), id));
+}
+
+void PagedKvCache::attach_prefix(SeqId id, const std::vector<int>& blocks, int64_t tokens) {
+    BlockTable& t = tables_.at(id);
+    if (!t.blocks.empty() || tokens != static_cast<int64_t>(blocks.size()) * pool_.block_tokens()) {
+        throw std::runtime_error("PagedKvCache::attach_prefix: sequence must be empty and prefix block aligned");
+    }
+    for (int b : blocks) pool_.retain(b);
+    t.blocks = blocks;
+    t.length = tokens;
+}
+
+int PagedKvCache::blocks_needed(const BlockTable& t, int64_t tokens) const {
+    const int64_t bt = pool_.block_tokens();
+    const int64_t want = (t.length + tokens + bt - 1) / bt;
+    return std::max<int>(0, static_cast<int>(want) - static_cast<int>(t.blocks.size()));
+}
+
+void PagedKvCache::free_blocks(BlockTable& t) {
+    for (int b : t.blocks) pool_.release(b);
+    t.blocks.clear();
+    t.length = 0;
+}
+
+bool PagedKvCache::reserve(SeqId id, int64_t tokens) {
+    BlockTable& t = tables_.at(id);
+    const int needed = blocks_needed(t, tokens);
+    if (needed == 0) return true;
+
+    if (needed > pool_.free_count()) {
+        // A block comes back only once every holder lets go of it. The holders we may
+        // drop are the prefix cache and sequences admitted after `id`.
+        auto self = std::find(admission_order_.begin(), admission_order_.end(), id);
+        std::unordered_map<int, int> droppable;
+        for (auto it = self + 1; it != admission_order_.end(); ++it) {
+            for (int b : tables_.at(*it).blocks) ++droppable[b];
+        }
+        if (prefix_) {
+            for (int b : prefix_->blocks()) ++droppable[b];
+        }
+        int reclaimable = pool_.free_count();
+        for (const auto& [b, holders] : droppable) {
+            if (holders == pool_.refcount(b)) ++reclaimable;
+        }
+        if (reclaimable < needed) return false;
+
+        if (prefix_) prefix_->evict(needed - pool_.free_count(), true);
+        while (needed > pool_.free_count()) {
+            SeqId victim = admission_order_.back();
+            free_blocks(tables_.at(victim));
+            tables_.erase(victim);
+            admission_order_.pop_back();
+            preempted_.push_back(victim);
+            // The victim may have been the last user of some cached blocks.
+            if (prefix_ && needed > pool_.free_count()) prefix_->evict(needed - pool_.free_count(), true);
+        }
+    }
+
+    for (int i = 0; i < needed; ++i) t.blocks.push_back(pool_.allocate());
+    return true;
+}
+
+std::vector<PagedKvCache::SeqId> PagedKvCache::take_preempted() {
+    std::vector<SeqId> out;
+    out.swap(preempted_);
+    return out;
+}
+
+void PagedKvCache::gather(SeqId id, int layer, int kv, float* dst, int64_t dst_len, int64_t dst_offset) {
+    const BlockTable& t = tables_.at(id);
+    const Gpt2Dims& d = pool_.dims();
+    const int64_t bt = pool_.block_tokens();
+    for (int h = 0; h < d.num_heads; ++h) {
+        float* out = dst + (h * dst_len + dst_offset) * d.head_dim;
+        for (int64_t pos = 0; pos < t.length;) {
+            const int64_t within = pos % bt;
+            const int64_t n = std::min(bt - within, t.length - pos);
+            const float* src = pool_.rows(t.blocks[pos / bt], layer, kv, h) + within * d.head_dim;
+            std::memcpy(out + pos * d.head_dim, src, static_cast<size_t>(n * d.head_dim) * sizeof(float));
+            pos += n;
+        }
+    }
+}
+
+void PagedKvCache::scatter(SeqId id, int layer, int kv, const float* src, int64_t src_len,
+                           int64_t src_pos, int64_t dst_pos, int64_t count) {
+    const BlockTable& t = tables_.at(id);
+    const Gpt2Dims& d = pool_.dims();
+    const int64_t bt = pool_.block_tokens();
+    if ((dst_pos + count + bt - 1) / bt > static_cast<int64_t>(t.blocks.size())) {
+        throw std::runtime_error("PagedKvCache::scatter: blocks not reserved");
+    }
+    for (int h = 0; h < d.num_heads; ++h) {
+        const float* in = src + (h * src_len + src_pos) * d.head_dim;
+        for (int64_t i = 0; i < count;) {
+            const int64_t pos = dst_pos + i;
+            const int64_t within = pos % bt;
+            const int64_t n = std::min(bt - within, count - i);
+            float* out = pool_.rows(t.blocks[pos / bt], layer, kv, h) + within * d.head_dim;
+            std::memcpy(out, in + i * d.head_dim, static_cast<size_t>(n * d.head_dim) * sizeof(float));
+            i += n;
+        }
+    }
+}
+
+PagedDecoder::PagedDecoder(Ort::Session& session, PagedKvCache& cache, int64_t max_seq_len,
+                           int64_t max_step_tokens)
+    : runner_(session),
+      cache_(cache),
+      max_seq_len_(max_seq_len),
+      max_step_tokens_(runner_.dynamic_sequence() ? max_step_tokens : 1) {
+    max_step_tokens_ = std::max<int64_t>(1, std::min(max_step_tokens_, max_seq_len));
+    past_.resize(static_cast<size_t>(runner_.dims().num_layers) * 2);
+    present_.resize(past_.size());
+}
+
+void PagedDecoder::ensure_staging(int64_t batch, int64_t past_len, int64_t count) {
+    const Gpt2Dims& d = runner_.dims();
+    const int64_t total_len = past_len + count;
+    const size_t slot = static_cast<size_t>(batch * d.token_stride() * total_len);
+    if (slot > slot_floats_) {
+        slot_floats_ = slot;
+        past_staging_.assign(slot * past_.size(), 0.0f);
+        present_staging_.assign(slot * past_.size(), 0.0f);
+    }
+    for (size_t i = 0; i < past_.size(); ++i) {
+        past_[i] = past_staging_.data() + i * slot_floats_;
+        present_[i] = present_staging_.data() + i * slot_floats_;
+    }
+
+    const int64_t static_mask = runner_.static_mask_len();
+    const size_t mask_len = static_cast<size_t>(batch * (static_mask > 0 ? static_mask : total_len));
+    if (mask_.size() < mask_len) mask_.resize(mask_len);
+    if (ids_.size() < static_cast<size_t>(batch * count)) ids_.resize(batch * count);
+    if (positions_.size() < ids_.size()) positions_.resize(ids_.size());
+    const size_t logits = static_cast<size_t>(batch * count * d.vocab_size);
+    if (logits_.size() < logits) logits_.resize(logits);
+}
+
+void PagedDecoder::scatter_new(PagedKvCache::SeqId id, int64_t row, int64_t padded_past,
+                               int64_t row_past, int64_t count) {
+    const Gpt2Dims& d = runner_.dims();
+    const int64_t total_len = padded_past + count;
+    const size_t row_floats = static_cast<size_t>(d.token_stride() * total_len);
+    for (int layer = 0; layer < d.num_layers; ++layer) {
+        for (int kv = 0; kv < 2; ++kv) {
+            const float* src = present_[layer * 2 + kv] + row * row_floats;
+            cache_.scatter(id, layer, kv, src, total_len, padded_past, row_past, count);
+        }
+    }
+}
+
+const float* PagedDecoder::step(PagedKvCache::SeqId id, const int64_t* ids, int64_t count) {
+    const int64_t past_len = cache_.length(id);
+    if (count <= 0 || count > max_step_tokens_ || past_len + count > max_seq_len_) {
+        throw std::runtime_error("PagedDecoder::step: bad token count " + std::to_string(count));
+    }
+
+    ensure_staging(1, past_len, count);
+    const Gpt2Dims& d = runner_.dims();
+    for (int layer = 0; layer < d.num_layers; ++layer) {
+        for (int kv = 0; kv < 2; ++kv) {
+            cache_.gather(id, layer, kv, past_[layer * 2 + kv], past_len, 0);
+        }
+    }
+    const int64_t static_mask = runner_.static_mask_len();
+    std::fill(mask_.begin(), mask_.begin() + (static_mask > 0 ? static_mask : past_len + count), 1);
+    for (int64_t i = 0; i < count; ++i) positions_[i] = past_len + i;
+
+    Gpt2Runner::Step s;
+    s.count = count;
+    s.past_len = past_len;
+    s.ids = ids;
+    s.mask = mask_.data();
+    s.positions = positions_.data();
+    s.past = past_.data();
+    s.present = present_.data();
+    s.logits = logits_.data();
+    runner_.run(s);
+
+    scatter_new(id, 0, past_len, past_len, count);
+    cache_.advance(id, count);
+    return logits_.data();
+}
+
+const float* PagedDecoder::decode(const std::vector<PagedKvCache::SeqId>& seqs, const int64_t* next_ids) {
+    const int64_t batch = static_cast<int64_t>(seqs.size());
+    if (batch == 0) throw std::runtime_error("PagedDecoder::decode: empty batch");
+    if (batch > 1 && !supports_batching()) {
+        throw std::runtime_error("PagedDecoder::decode: model export lacks position_ids/dynamic mask");
+    }
+
+    int64_t padded_past = 0;
+    for (auto id : seqs) padded_past = std::max(padded_past, cache_.length(id));
+    if (padded_past + 1 > max_seq_len_) {
+        throw std::runtime_error("PagedDecoder::decode: sequence exceeds max length");
+    }
+    ensure_staging(batch, padded_past, 1);
+
+    const Gpt2Dims& d = runner_.dims();
+    const int64_t total_len = padded_past + 1;
+    const size_t past_row = static_cast<size_t>(d.token_stride() * padded_past);
+    // A pinned-mask export takes static_mask ones whatever the length; it only
+    // reaches here with batch 1 (supports_batching() is false), so pad is 0.
+    const int64_t static_mask = runner_.static_mask_len();
+    const int64_t mask_stride = static_mask > 0 ? static_mask : total_len;
+    for (int64_t r = 0; r < batch; ++r) {
+        const int64_t len = cache_.length(seqs[r]);
+        const int64_t pad = padded_past - len;
+        for (int layer = 0; layer < d.num_layers; ++layer) {
+            for (int kv = 0; kv < 2; ++kv) {
+                cache_.gather(seqs[r], layer, kv, past_[layer * 2 + kv] + r * past_row, padded_past, pad);
+            }
+        }
+        int64_t* mask_row = mask_.data() + r * mask_stride;
+        if (static_mask > 0) {
+            std::fill(mask_row, mask_row + static_mask, 1);
+        } else {
+            std::fill(mask_row, mask_row + pad, 0);
+            std::fill(mask_row + pad, mask_row + total_len, 1);
+        }
+        ids_[r] = next_ids[r];
+        positions_[r] = len;
+    }
+
+    Gpt2Runner::Step s;
+    s.batch = batch;
+    s.count = 1;
+    s.past_len = padded_past;
+    s.ids = ids_.data();
+    s.mask = mask_.data();
+    s.positions = positions_.data();
+    s.past = past_.data();
+    s.present = present_.data();
+    s.logits = logits_.data();
+    runner_.run(s);
+
+    for (int64_t r = 0; r < batch; ++r) {
+        scatter_new(seqs[r], r, padded_past, cache_.length(seqs[r]), 1);
+        cache_.advance(seqs[r], 1);
+    }
+    return logits_.data();
+}
@@ -0,0 +1,159 @@
+#ifndef PAGED_KV_CACHE_H
+#define PAGED_KV_CACHE_H
+
+#include "gpt2_decoder.h"
+#include "kv_cache.h"
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+class PrefixCache;
+
+// Fixed-size KV blocks carved out of one shared allocation.
+//
+// Each block holds `block_tokens` positions for every layer, key/value and head,
+// laid out as [layer][kv][head][block_tokens][head_dim] so that copying a block's
+// rows for one head into a contiguous [heads, seq, head_dim] tensor is one memcpy.
+class KvBlockPool {
+public:
+    KvBlockPool(const Gpt2Dims& dims, int block_tokens, int num_blocks);
+
+    // Returns a free block id with one reference, or -1 when the pool is exhausted.
+    int allocate();
+    // Blocks are reference counted so a cached prefix can be shared by sequences;
+    // release() drops one reference and frees the block on the last one.
+    void retain(int block) { ++refs_[block]; }
+    void release(int block);
+    int refcount(int block) const { return refs_[block]; }
+
+    int block_tokens() const { return block_tokens_; }
+    int capacity() const { return num_blocks_; }
+    int free_count() const { return static_cast<int>(free_list_.size()); }
+    const Gpt2Dims& dims() const { return dims_; }
+
+    // Start of the [block_tokens, head_dim] rows of `head` for layer/kv in `block`.
+    float* rows(int block, int layer, int kv, int head) {
+        return storage_.data() + static_cast<size_t>(block) * block_floats_ +
+               ((static_cast<size_t>(layer) * 2 + kv) * dims_.num_heads + head) * head_floats_;
+    }
+
+private:
+    Gpt2Dims dims_;
+    int block_tokens_;
+    int num_blocks_;
+    size_t head_floats_;
+    size_t block_floats_;
+    std::vector<float> storage_;
+    std::vector<int> free_list_;
+    std::vector<int> refs_;
+};
+
+// Per-sequence mapping from token positions to pool blocks.
+struct BlockTable {
+    std::vector<int> blocks;
+    int64_t length = 0;  // positions holding valid KV
+};
+
+// Paged KV cache shared by many concurrent generations.
+//
+// Sequences only hold blocks for the tokens they actually have, so the number of
+// live sequences is bounded by total tokens rather than by max length. When the
+// pool runs dry, reserve() preempts the most recently admitted sequences (their
+// blocks are freed and they must be recomputed later), mirroring recompute-style
+// preemption in vLLM. Not thread-safe: owned by a single scheduler thread.
+class PagedKvCache {
+public:
+    using SeqId = uint64_t;
+
+    PagedKvCache(const Gpt2Dims& dims, int block_tokens, int num_blocks);
+
+    void add_sequence(SeqId id);
+    void remove_sequence(SeqId id);
+    // Start a freshly added sequence on shared, already computed blocks covering
+    // its first `tokens` positions (a whole number of blocks).
+    void attach_prefix(SeqId id, const std::vector<int>& blocks, int64_t tokens);
+
+    // Blocks only the prefix cache holds are reclaimed before any sequence is
+    // preempted. The cache must use this cache's pool.
+    void set_prefix_cache(PrefixCache* prefix) { prefix_ = prefix; }
+    bool contains(SeqId id) const { return tables_.count(id) != 0; }
+
+    // Ensure `id` has room for `tokens` more positions, evicting unshared prefix
+    // cache blocks and then preempting newer sequences if needed. Returns false (and preempts nothing) if that still would not fit.
+    bool reserve(SeqId id, int64_t tokens);
+
+    // Sequences preempted since the last call; their KV is gone.
+    std::vector<SeqId> take_preempted();
+
+    const BlockTable& table(SeqId id) const { return tables_.at(id); }
+    int64_t length(SeqId id) const { return tables_.at(id).length; }
+    void advance(SeqId id, int64_t tokens) { tables_.at(id).length += tokens; }
+
+    // Copy the sequence's KV for layer/kv into dst, a contiguous
+    // [heads, dst_len, head_dim] tensor, starting at position dst_offset.
+    void gather(SeqId id, int layer, int kv, float* dst, int64_t dst_len, int64_t dst_offset);
+    // Copy `count` positions starting at src_pos of src ([heads, src_len, head_dim])
+    // into the sequence at position dst_pos. Blocks must already be reserved.
+    void scatter(SeqId id, int layer, int kv, const float* src, int64_t src_len,
+                 int64_t src_pos, int64_t dst_pos, int64_t count);
+
+    KvBlockPool& pool() { return pool_; }
+    size_t num_sequences() const { return tables_.size(); }
+
+private:
+    int blocks_needed(const BlockTable& t, int64_t tokens) const;
+    void free_blocks(BlockTable& t);
+
+    KvBlockPool pool_;
+    PrefixCache* prefix_ = nullptr;
+    std::map<SeqId, BlockTable> tables_;
+    std::vector<SeqId> admission_order_;
+    std::vector<SeqId> preempted_;
+};
+
+// Runs sequences against a PagedKvCache. Their blocks are gathered into a
+// per-worker contiguous staging area, and only the new positions of present.*
+// are scattered back into the pool after the Run. Staging grows to the largest
+// batch x length seen and is then reused, so steady-state steps do not allocate.
+class PagedDecoder {
+public:
+    PagedDecoder(Ort::Session& session, PagedKvCache& cache, int64_t max_seq_len,
+                 int64_t max_step_tokens = 32);
+
+    // Feed `count` tokens for `id`; the caller must have reserved room for them.
+    // Returns [count, vocab] logits valid until the next call.
+    const float* step(PagedKvCache::SeqId id, const int64_t* ids, int64_t count);
+
+    // One decode token for each sequence in `seqs`, whose past lengths may differ.
+    // Rows are left-padded to the longest past; the padding is masked out through
+    // attention_mask and each row keeps its own position_ids. Returns [batch, vocab].
+    const float* decode(const std::vector<PagedKvCache::SeqId>& seqs, const int64_t* next_ids);
+
+    int64_t max_step_tokens() const { return max_step_tokens_; }
+    const Gpt2Dims& dims() const { return runner_.dims(); }
+    // Batched decode of ragged rows needs explicit positions from the export.
+    bool supports_batching() const { return runner_.has_position_ids() && runner_.static_mask_len() == 0; }
+
+private:
+    void ensure_staging(int64_t batch, int64_t past_len, int64_t count);
+    void scatter_new(PagedKvCache::SeqId id, int64_t row, int64_t padded_past,
+                     int64_t row_past, int64_t count);
+
+    Gpt2Runner runner_;
+    PagedKvCache& cache_;
+    int64_t max_seq_len_;
+    int64_t max_step_tokens_;
+
+    size_t slot_floats_ = 0;  // floats per past/present tensor in staging
+    std::vector<float> past_staging_;
+    std::vector<float> present_staging_;
+    std::vector<float*> past_;
+    std::vector<float*> present_;
+    std::vector<int64_t> ids_;
+    std::vector<int64_t> mask_;
+    std::vector<int64_t> positions_;
+    std::vector<float> logits_;
+};
+
+#endif // PAGED_KV_CACHE_H
@@ -0,0 +1,98 @@
+#include "perf_counters.h"
+
+#if JUNCTION_PERF_COUNTERS
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+namespace {
+int open_event(uint64_t config, int group_fd) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = group_fd < 0 ? 1 : 0;  // the leader starts the whole group
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, PERF_FLAG_FD_CLOEXEC));
+}
+
+uint64_t thread_context_switches() {
+    rusage ru;
+    if (getrusage(RUSAGE_THREAD, &ru) != 0) return 0;
+    return static_cast<uint64_t>(ru.ru_nvcsw) + static_cast<uint64_t>(ru.ru_nivcsw);
+}
+}  // namespace
+
+PerfCounters::PerfCounters() {
+    leader_ = open_event(PERF_COUNT_HW_CPU_CYCLES, -1);
+    if (leader_ < 0) {
+        error_ = std::string("perf_event_open(cycles): ") + std::strerror(errno);
+        return;
+    }
+    members_[0] = open_event(PERF_COUNT_HW_INSTRUCTIONS, leader_);
+    members_[1] = open_event(PERF_COUNT_HW_CACHE_MISSES, leader_);
+    if (members_[0] < 0 || members_[1] < 0) {
+        error_ = std::string("perf_event_open(instructions, cache-misses): ") + std::strerror(errno);
+        for (int& fd : members_) {
+            if (fd >= 0) close(fd);
+            fd = -1;
+        }
+        close(leader_);
+        leader_ = -1;
+        return;
+    }
+    ioctl(leader_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+PerfCounters::~PerfCounters() {
+    for (int fd : members_) {
+        if (fd >= 0) close(fd);
+    }
+    if (leader_ >= 0) close(leader_);
+}
+
+bool PerfCounters::read_snapshot(Snapshot& out) const {
+    // PERF_FORMAT_GROUP layout: nr, time_enabled, time_running, value[nr].
+    uint64_t buf[3 + 3];
+    if (read(leader_, buf, sizeof(buf)) != static_cast<ssize_t>(sizeof(buf)) || buf[0] != 3) return false;
+    out.enabled = buf[1];
+    out.running = buf[2];
+    for (int i = 0; i < 3; ++i) out.values[i] = buf[3 + i];
+    out.context_switches = thread_context_switches();
+    return true;
+}
+
+void PerfCounters::start() {
+    if (leader_ < 0 || !read_snapshot(start_)) start_.running = ~uint64_t{0};
+}
+
+bool PerfCounters::stop(PerfReading& delta) {
+    if (leader_ < 0 || start_.running == ~uint64_t{0}) return false;
+    Snapshot end;
+    if (!read_snapshot(end)) return false;
+    const uint64_t enabled = end.enabled - start_.enabled;
+    const uint64_t running = end.running - start_.running;
+    if (running == 0) return false;  // never on a PMU during the region
+    // The group was multiplexed for part of the region: extrapolate.
+    const double scale = static_cast<double>(enabled) / static_cast<double>(running);
+    auto scaled = [&](int i) {
+        return static_cast<uint64_t>(static_cast<double>(end.values[i] - start_.values[i]) * scale);
+    };
+    delta.cycles = scaled(0);
+    delta.instructions = scaled(1);
+    delta.llc_misses = scaled(2);
+    delta.context_switches = end.context_switches - start_.context_switches;
+    return true;
+}
+
+#endif  // JUNCTION_PERF_COUNTERS
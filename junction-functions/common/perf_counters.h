@@ -0,0 +1,80 @@
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+// Hardware counters around a region of the calling thread, to tell whether
+// inference is compute- or memory-bound on a host: cycles and instructions give
+// IPC, LLC misses per kilo-instruction the memory pressure, and context switches
+// show when the region was not running on its core at all.
+//
+// Built only with -DJUNCTION_PERF_COUNTERS=ON (CMake). Otherwise PerfCounters is an
+// empty class whose stop() is constant false, so callers' bookkeeping compiles
+// away. Cycles, instructions and LLC misses are one perf_event_open group on the
+// calling thread, user space only (allowed at perf_event_paranoid 2), scaled if the
+// kernel multiplexed it. Context switches come from getrusage(RUSAGE_THREAD),
+// which needs no permission. Only the calling thread is counted: with more than
+// one ORT intra-op thread the work done on the others is not included.
+
+#include <cstdint>
+#include <string>
+
+#ifndef JUNCTION_PERF_COUNTERS
+#define JUNCTION_PERF_COUNTERS 0
+#endif
+
+struct PerfReading {
+    uint64_t cycles = 0;
+    uint64_t instructions = 0;
+    uint64_t llc_misses = 0;
+    uint64_t context_switches = 0;
+};
+
+#if JUNCTION_PERF_COUNTERS
+
+class PerfCounters {
+public:
+    // Opens the group for the calling thread; use the object on that thread only.
+    PerfCounters();
+    ~PerfCounters();
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    // False if the kernel refused (no PMU in the VM, perf_event_paranoid, a
+    // sandbox without the syscall); error() says why.
+    bool available() const { return leader_ >= 0; }
+    const std::string& error() const { return error_; }
+
+    void start();
+    // Counts since start(); false if they could not be read.
+    bool stop(PerfReading& delta);
+
+private:
+    struct Snapshot {
+        uint64_t values[3];
+        uint64_t enabled;
+        uint64_t running;
+        uint64_t context_switches;
+    };
+    bool read_snapshot(Snapshot& out) const;
+
+    int leader_ = -1;
+    int members_[2] = {-1, -1};
+    std::string error_;
+    Snapshot start_{};
+};
+
+#else
+
+class PerfCounters {
+public:
+    bool available() const { return false; }
+    const std::string& error() const {
+        static const std::string disabled = "built without JUNCTION_PERF_COUNTERS";
+        return disabled;
+    }
+    void start() {}
+    bool stop(PerfReading&) { return false; }
+};
+
+#endif  // JUNCTION_PERF_COUNTERS
+
+#endif  // PERF_COUNTERS_H
@@ -0,0 +1,54 @@
+#include "phase_markers.h"
+
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+
+namespace {
+int64_t now_ns() {
+    timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+int64_t loaded_ns = 0;
+
+// Runs before any shared library's initializers; only take the time here, the
+// environment is read later.
+void record_loaded(int, char**, char**) { loaded_ns = now_ns(); }
+
+__attribute__((section(".preinit_array"), used)) void (*const preinit_loaded)(int, char**, char**) = record_loaded;
+
+void write_mark(int fd, const char* name, int64_t ns) {
+    char line[160];
+    const int n = std::snprintf(line, sizeof(line), "PHASE %s %lld\n", name, static_cast<long long>(ns));
+    // One write per line: shorter than PIPE_BUF, so marks from several threads never interleave.
+    if (n > 0 && n < static_cast<int>(sizeof(line))) (void)!write(fd, line, static_cast<size_t>(n));
+}
+
+int phase_fd() {
+    static const int fd = [] {
+        const char* env = std::getenv(kPhaseFdEnv);
+        if (!env) return -1;
+        const int value = std::atoi(env);
+        return value >= 0 && fcntl(value, F_GETFD) >= 0 ? value : -1;
+    }();
+    return fd;
+}
+}  // namespace
+
+void phase_mark(const char* name) {
+    const int64_t ns = now_ns();
+    const int fd = phase_fd();
+    if (fd < 0) return;
+    static std::once_flag first;
+    std::call_once(first, [&] {
+        if (loaded_ns) write_mark(fd, "loaded", loaded_ns);
+    });
+    write_mark(fd, name, ns);
+}
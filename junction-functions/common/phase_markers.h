@@ -0,0 +1,24 @@
+#ifndef PHASE_MARKERS_H
+#define PHASE_MARKERS_H
+
+// Cold-start phase markers for function binaries.
+//
+// When JunctionD or the gateway's cold path spawns an instance it passes the
+// write end of a pipe in $JUNCTION_PHASE_FD. phase_mark("session") writes
+// "PHASE session <ns>\n" to it, where <ns> is CLOCK_REALTIME in nanoseconds (the
+// one clock Junction's libOS and the host agree on). A mark ends the phase of that
+// name; the phase began at the previous mark on the merged timeline, so a binary
+// only calls phase_mark() after each expensive step.
+//
+// "loaded" comes for free once this file is linked in: it is timed from
+// .preinit_array, after junction_run booted the instance and the dynamic loader
+// mapped and relocated every shared library (libonnxruntime.so included) but
+// before any of their constructors ran, and sent with the first mark. Binaries
+// start main() with phase_mark("static_init") to close the constructors' phase.
+// Without $JUNCTION_PHASE_FD every call is a cheap no-op.
+
+constexpr const char* kPhaseFdEnv = "JUNCTION_PHASE_FD";
+
+void phase_mark(const char* name);
+
+#endif // PHASE_MARKERS_H
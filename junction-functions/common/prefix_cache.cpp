@@ -0,0 +1,159 @@
+#include "prefix_cache.h"
+
+#include <algorithm>
+#include <functional>
+
+PrefixCache::PrefixCache(KvBlockPool& pool, int max_blocks)
+    : pool_(pool), bt_(pool.block_tokens()), max_blocks_(max_blocks) {}
+
+PrefixCache::~PrefixCache() {
+    for (int b : blocks()) pool_.release(b);
+}
+
+std::vector<int64_t> PrefixCache::chunk(const int64_t* tokens, int64_t i) const {
+    return std::vector<int64_t>(tokens + i * bt_, tokens + (i + 1) * bt_);
+}
+
+bool PrefixCache::chunk_equal(const Node& n, size_t j, const int64_t* tokens, int64_t i) const {
+    return std::equal(n.tokens.begin() + j * bt_, n.tokens.begin() + (j + 1) * bt_, tokens + i * bt_);
+}
+
+int64_t PrefixCache::match(const int64_t* tokens, int64_t len, std::vector<int>& blocks) {
+    const int64_t chunks = len / bt_;
+    int64_t pos = 0;
+    Node* n = &root_;
+    while (pos < chunks) {
+        auto it = n->children.find(chunk(tokens, pos));
+        if (it == n->children.end()) break;
+        Node* c = it->second.get();
+        c->last_used = ++tick_;
+        size_t j = 0;
+        while (j < c->blocks.size() && pos < chunks && chunk_equal(*c, j, tokens, pos)) {
+            blocks.push_back(c->blocks[j]);
+            ++j;
+            ++pos;
+        }
+        if (j < c->blocks.size()) break;
+        n = c;
+    }
+    return pos * bt_;
+}
+
+// Cut n's label after j chunks; the rest moves into a new only child.
+void PrefixCache::split(Node* n, size_t j) {
+    auto tail = std::make_unique<Node>();
+    tail->tokens.assign(n->tokens.begin() + j * bt_, n->tokens.end());
+    tail->blocks.assign(n->blocks.begin() + j, n->blocks.end());
+    tail->children = std::move(n->children);
+    for (auto& kv : tail->children) kv.second->parent = tail.get();
+    tail->parent = n;
+    tail->last_used = n->last_used;
+
+    n->tokens.resize(j * bt_);
+    n->blocks.resize(j);
+    n->children.clear();
+    std::vector<int64_t> key(tail->tokens.begin(), tail->tokens.begin() + bt_);
+    n->children.emplace(std::move(key), std::move(tail));
+}
+
+void PrefixCache::insert(const int64_t* tokens, int64_t len, const std::vector<int>& blocks) {
+    const int64_t chunks = std::min<int64_t>(len / bt_, static_cast<int64_t>(blocks.size()));
+    int64_t pos = 0;
+    Node* n = &root_;
+    while (pos < chunks) {
+        auto key = chunk(tokens, pos);
+        auto it = n->children.find(key);
+        if (it == n->children.end()) {
+            auto leaf = std::make_unique<Node>();
+            leaf->tokens.assign(tokens + pos * bt_, tokens + chunks * bt_);
+            leaf->blocks.assign(blocks.begin() + pos, blocks.begin() + chunks);
+            leaf->parent = n;
+            leaf->last_used = ++tick_;
+            for (int b : leaf->blocks) pool_.retain(b);
+            cached_blocks_ += static_cast<int>(leaf->blocks.size());
+            n->children.emplace(std::move(key), std::move(leaf));
+            break;
+        }
+
+        Node* c = it->second.get();
+        c->last_used = ++tick_;
+        size_t j = 0;
+        while (j < c->blocks.size() && pos < chunks && chunk_equal(*c, j, tokens, pos)) {
+            ++j;
+            ++pos;
+        }
+        if (j < c->blocks.size()) {
+            if (pos == chunks) break;  // new prefix ends inside c: already cached
+            split(c, j);
+        }
+        n = c;
+    }
+
+    if (max_blocks_ >= 0 && cached_blocks_ > max_blocks_) evict(cached_blocks_ - max_blocks_, false);
+}
+
+PrefixCache::Node* PrefixCache::lru_leaf(Node* n, bool only_unshared) {
+    if (n->children.empty()) {
+        if (n == &root_ || n->blocks.empty()) return nullptr;
+        if (only_unshared && pool_.refcount(n->blocks.back()) > 1) return nullptr;
+        return n;
+    }
+    Node* best = nullptr;
+    for (auto& kv : n->children) {
+        Node* leaf = lru_leaf(kv.second.get(), only_unshared);
+        if (leaf && (!best || leaf->last_used < best->last_used)) best = leaf;
+    }
+    return best;
+}
+
+// Unlink an emptied leaf; a parent left with a single child absorbs it so the
+// tree stays path-compressed.
+void PrefixCache::remove_leaf(Node* leaf) {
+    Node* parent = leaf->parent;
+    for (auto it = parent->children.begin(); it != parent->children.end(); ++it) {
+        if (it->second.get() == leaf) {
+            parent->children.erase(it);
+            break;
+        }
+    }
+    if (parent == &root_ || parent->children.size() != 1) return;
+
+    std::unique_ptr<Node> child = std::move(parent->children.begin()->second);
+    parent->children.clear();
+    parent->tokens.insert(parent->tokens.end(), child->tokens.begin(), child->tokens.end());
+    parent->blocks.insert(parent->blocks.end(), child->blocks.begin(), child->blocks.end());
+    parent->children = std::move(child->children);
+    for (auto& kv : parent->children) kv.second->parent = parent;
+    parent->last_used = std::max(parent->last_used, child->last_used);
+}
+
+int PrefixCache::evict(int count, bool only_unshared) {
+    int dropped = 0;
+    while (dropped < count) {
+        Node* leaf = lru_leaf(&root_, only_unshared);
+        if (!leaf) break;
+        // Trim from the tail: deeper chunks are the least likely to be shared.
+        while (dropped < count && !leaf->blocks.empty() &&
+               (!only_unshared || pool_.refcount(leaf->blocks.back()) == 1)) {
+            pool_.release(leaf->blocks.back());
+            leaf->blocks.pop_back();
+            leaf->tokens.resize(leaf->blocks.size() * bt_);
+            --cached_blocks_;
+            ++evicted_blocks_;
+            ++dropped;
+        }
+        if (leaf->blocks.empty()) remove_leaf(leaf);
+    }
+    return dropped;
+}
+
+std::vector<int> PrefixCache::blocks() const {
+    std::vector<int> out;
+    out.reserve(static_cast<size_t>(cached_blocks_));
+    std::function<void(const Node&)> walk = [&](const Node& n) {
+        out.insert(out.end(), n.blocks.begin(), n.blocks.end());
+        for (const auto& kv : n.children) walk(*kv.second);
+    };
+    walk(root_);
+    return out;
+}
@@ -0,0 +1,68 @@
+#ifndef PREFIX_CACHE_H
+#define PREFIX_CACHE_H
+
+#include "paged_kv_cache.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+// Radix tree from token prefixes to computed KV blocks.
+//
+// Prefixes are indexed a whole block at a time: each edge is labeled with a run of
+// block-aligned token chunks and carries the pool block holding each chunk's KV.
+// A new request walks the tree, attaches the longest cached prefix to its block
+// table and only prefills the rest. Cached blocks hold a pool reference, so they
+// outlive the request that computed them, and a sequence never writes into one
+// (it only appends after its last full block).
+//
+// The tree holds at most `max_blocks` blocks; past that, chunks are dropped from the
+// least recently used leaves. Not thread-safe: owned by the scheduler thread.
+class PrefixCache {
+public:
+    PrefixCache(KvBlockPool& pool, int max_blocks);
+    ~PrefixCache();
+
+    // Append the blocks of the longest cached prefix of tokens[0, len) to `blocks`
+    // and return how many tokens they cover (a multiple of the block size).
+    int64_t match(const int64_t* tokens, int64_t len, std::vector<int>& blocks);
+
+    // Index the full blocks of tokens[0, len), whose KV lives in `blocks` (a block
+    // table covering at least those positions). Chunks already cached are kept.
+    void insert(const int64_t* tokens, int64_t len, const std::vector<int>& blocks);
+
+    // Drop up to `count` blocks, least recently used leaves first. With
+    // only_unshared, blocks a sequence still uses are left alone so every drop
+    // returns memory to the pool. Returns how many blocks were dropped.
+    int evict(int count, bool only_unshared);
+
+    std::vector<int> blocks() const;
+    int cached_blocks() const { return cached_blocks_; }
+    uint64_t evicted_blocks() const { return evicted_blocks_; }
+
+private:
+    struct Node {
+        std::vector<int64_t> tokens;  // block-aligned label of the edge into this node
+        std::vector<int> blocks;      // one per chunk of `tokens`
+        std::map<std::vector<int64_t>, std::unique_ptr<Node>> children;  // keyed by first chunk
+        Node* parent = nullptr;
+        uint64_t last_used = 0;
+    };
+
+    std::vector<int64_t> chunk(const int64_t* tokens, int64_t i) const;
+    bool chunk_equal(const Node& n, size_t j, const int64_t* tokens, int64_t i) const;
+    void split(Node* n, size_t j);
+    void remove_leaf(Node* leaf);
+    Node* lru_leaf(Node* n, bool only_unshared);
+
+    KvBlockPool& pool_;
+    int64_t bt_;
+    int max_blocks_;
+    Node root_;
+    uint64_t tick_ = 0;
+    int cached_blocks_ = 0;
+    uint64_t evicted_blocks_ = 0;
+};
+
+#endif // PREFIX_CACHE_H
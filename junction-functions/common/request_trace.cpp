@@ -0,0 +1,269 @@
+#include "request_trace.h"
+
+#include <fcntl.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+
+namespace tracing {
+namespace {
+struct SpanRecord {
+    uint64_t trace_hi;
+    uint64_t trace_lo;
+    uint64_t span_id;
+    uint64_t parent_id;
+    const char* name;
+    int64_t start_ns;
+    int64_t end_ns;
+    int32_t tid;
+};
+
+// Bounded multi-producer ring (Vyukov's sequence-numbered cells) with the flush
+// thread as its only consumer. Producers claim a slot with one CAS on `tail` and
+// publish it with a release store of the cell's sequence number.
+class SpanRing {
+public:
+    static constexpr size_t kCapacity = 1 << 14;
+
+    SpanRing() {
+        for (size_t i = 0; i < kCapacity; ++i) cells_[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    bool push(const SpanRecord& rec) {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells_[pos & (kCapacity - 1)];
+            const size_t seq = cell->seq.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;  // full: the consumer has not freed this cell yet
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->rec = rec;
+        cell->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side; one thread only.
+    bool pop(SpanRecord& rec) {
+        Cell& cell = cells_[head_ & (kCapacity - 1)];
+        if (cell.seq.load(std::memory_order_acquire) != head_ + 1) return false;
+        rec = cell.rec;
+        cell.seq.store(head_ + kCapacity, std::memory_order_release);
+        ++head_;
+        return true;
+    }
+
+private:
+    struct alignas(64) Cell {
+        std::atomic<size_t> seq;
+        SpanRecord rec;
+    };
+    Cell cells_[kCapacity];
+    alignas(64) std::atomic<size_t> tail_{0};
+    alignas(64) size_t head_ = 0;
+};
+
+struct Recorder {
+    SpanRing ring;
+    std::atomic<uint64_t> dropped{0};
+    int fd = -1;
+    int pid = 0;
+    std::string service;
+    std::thread flusher;
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool stopping = false;
+
+    // Drain the ring into one write: O_APPEND keeps each batch whole when several
+    // processes share the collector file.
+    void flush() {
+        std::string out;
+        SpanRecord r;
+        char line[512];
+        while (ring.pop(r)) {
+            const int n = std::snprintf(
+                line, sizeof(line),
+                "{\"trace_id\":\"%016llx%016llx\",\"span_id\":\"%016llx\",\"parent_id\":\"%016llx\","
+                "\"name\":\"%s\",\"service\":\"%s\",\"pid\":%d,\"tid\":%d,\"start_ns\":%lld,\"dur_ns\":%lld}\n",
+                static_cast<unsigned long long>(r.trace_hi), static_cast<unsigned long long>(r.trace_lo),
+                static_cast<unsigned long long>(r.span_id), static_cast<unsigned long long>(r.parent_id), r.name,
+                service.c_str(), pid, r.tid, static_cast<long long>(r.start_ns),
+                static_cast<long long>(r.end_ns - r.start_ns));
+            if (n > 0 && n < static_cast<int>(sizeof(line))) out.append(line, static_cast<size_t>(n));
+        }
+        size_t off = 0;
+        while (off < out.size()) {
+            const ssize_t w = write(fd, out.data() + off, out.size() - off);
+            if (w <= 0) break;
+            off += static_cast<size_t>(w);
+        }
+    }
+
+    void run() {
+        std::unique_lock<std::mutex> lk(mtx);
+        while (!stopping) {
+            cv.wait_for(lk, std::chrono::milliseconds(20));
+            lk.unlock();
+            flush();
+            lk.lock();
+        }
+    }
+};
+
+std::atomic<bool> g_enabled{false};
+Recorder* g_recorder = nullptr;  // set once by start(), never freed while spans may be recorded
+
+uint64_t random_id() {
+    thread_local std::mt19937_64 rng([] {
+        std::random_device rd;
+        return (static_cast<uint64_t>(rd()) << 32) ^ rd() ^ static_cast<uint64_t>(now_ns());
+    }());
+    uint64_t id;
+    do {
+        id = rng();
+    } while (id == 0);
+    return id;
+}
+
+int32_t thread_id() {
+    thread_local const int32_t tid = static_cast<int32_t>(syscall(SYS_gettid));
+    return tid;
+}
+
+bool parse_hex(const std::string& s, size_t pos, size_t len, uint64_t& out) {
+    uint64_t v = 0;
+    for (size_t i = pos; i < pos + len; ++i) {
+        const char c = s[i];
+        v <<= 4;
+        if (c >= '0' && c <= '9') v |= static_cast<uint64_t>(c - '0');
+        else if (c >= 'a' && c <= 'f') v |= static_cast<uint64_t>(c - 'a' + 10);
+        else return false;
+    }
+    out = v;
+    return true;
+}
+}  // namespace
+
+std::string TraceContext::trace_id() const {
+    char buf[33];
+    std::snprintf(buf, sizeof(buf), "%016llx%016llx", static_cast<unsigned long long>(trace_hi),
+                  static_cast<unsigned long long>(trace_lo));
+    return buf;
+}
+
+std::string TraceContext::traceparent() const {
+    char buf[56];
+    std::snprintf(buf, sizeof(buf), "00-%016llx%016llx-%016llx-01", static_cast<unsigned long long>(trace_hi),
+                  static_cast<unsigned long long>(trace_lo), static_cast<unsigned long long>(span_id));
+    return buf;
+}
+
+bool parse_traceparent(const std::string& value, TraceContext& out) {
+    // version(2) - trace id(32) - parent id(16) - flags(2)
+    if (value.size() < 55 || value[2] != '-' || value[35] != '-' || value[52] != '-') return false;
+    if (value.compare(0, 2, "ff") == 0) return false;
+    TraceContext ctx;
+    if (!parse_hex(value, 3, 16, ctx.trace_hi) || !parse_hex(value, 19, 16, ctx.trace_lo) ||
+        !parse_hex(value, 36, 16, ctx.span_id) || !ctx.valid()) {
+        return false;
+    }
+    out = ctx;
+    return true;
+}
+
+TraceContext new_trace() {
+    TraceContext ctx;
+    ctx.trace_hi = random_id();
+    ctx.trace_lo = random_id();
+    return ctx;
+}
+
+TraceContext context_from_env() {
+    TraceContext ctx;
+    if (const char* env = std::getenv(kTraceEnv)) parse_traceparent(env, ctx);
+    return ctx;
+}
+
+bool start(const char* service, const std::string& path) {
+    if (g_recorder) return g_enabled.load();
+    std::string file = path;
+    if (file.empty()) {
+        const char* env = std::getenv(kTraceFileEnv);
+        if (!env || !*env) return false;
+        file = env;
+    }
+    const int fd = open(file.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (fd < 0) return false;
+    auto rec = std::make_unique<Recorder>();
+    rec->fd = fd;
+    rec->pid = static_cast<int>(getpid());
+    rec->service = service;
+    g_recorder = rec.release();
+    g_recorder->flusher = std::thread([] { g_recorder->run(); });
+    g_enabled.store(true, std::memory_order_release);
+    return true;
+}
+
+void stop() {
+    if (!g_recorder || !g_enabled.exchange(false)) return;
+    {
+        std::lock_guard<std::mutex> lk(g_recorder->mtx);
+        g_recorder->stopping = true;
+    }
+    g_recorder->cv.notify_one();
+    g_recorder->flusher.join();
+    g_recorder->flush();
+    close(g_recorder->fd);
+    // The recorder itself stays allocated: a thread may still be inside record().
+}
+
+bool enabled() { return g_enabled.load(std::memory_order_relaxed); }
+
+uint64_t dropped() { return g_recorder ? g_recorder->dropped.load(std::memory_order_relaxed) : 0; }
+
+int64_t now_ns() {
+    timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+void record(const TraceContext& parent, uint64_t span_id, const char* name, int64_t start_ns, int64_t end_ns) {
+    if (!enabled() || !parent.valid()) return;
+    const SpanRecord rec{parent.trace_hi, parent.trace_lo, span_id ? span_id : random_id(), parent.span_id, name,
+                         start_ns, end_ns, thread_id()};
+    if (!g_recorder->ring.push(rec)) g_recorder->dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+Span::Span(const char* name, const TraceContext& parent) : name_(name), ctx_(parent) {
+    if (!enabled() || !parent.valid()) return;
+    active_ = true;
+    parent_id_ = parent.span_id;
+    ctx_.span_id = random_id();
+    start_ns_ = now_ns();
+}
+
+void Span::end() {
+    if (!active_) return;
+    active_ = false;
+    TraceContext parent = ctx_;
+    parent.span_id = parent_id_;
+    record(parent, ctx_.span_id, name_, start_ns_, now_ns());
+}
+
+}  // namespace tracing
@@ -0,0 +1,92 @@
+#ifndef REQUEST_TRACE_H
+#define REQUEST_TRACE_H
+
+// End-to-end request tracing across the gateway, JunctionD and the functions.
+//
+// A request carries a W3C trace context ("00-<trace id>-<parent span id>-01"): in
+// the `traceparent` header on the warm path, in $TRACEPARENT for a cold-path
+// instance. Every process records its spans into a fixed-size lock-free ring; a
+// background thread drains it every few milliseconds and appends one JSON line
+// per span to the collector file ($JUNCTION_TRACE_FILE or the gateway's
+// --trace-file). All processes append to the same file, so grouping its lines by
+// trace_id gives one request's spans across every stage (test/trace_breakdown.py).
+//
+// Span timestamps are CLOCK_REALTIME, the clock the host and Junction instances
+// agree on. A span is a few stores into the ring and never blocks; when the ring
+// is full the span is dropped and counted. With tracing not started, or for a
+// request without a trace context, a Span does nothing.
+
+#include <cstdint>
+#include <string>
+
+namespace tracing {
+
+constexpr const char* kTraceHeader = "traceparent";
+constexpr const char* kTraceEnv = "TRACEPARENT";
+constexpr const char* kTraceFileEnv = "JUNCTION_TRACE_FILE";
+
+struct TraceContext {
+    uint64_t trace_hi = 0;
+    uint64_t trace_lo = 0;
+    uint64_t span_id = 0;  // the span new children hang off; 0 at the root
+
+    bool valid() const { return (trace_hi | trace_lo) != 0; }
+    std::string trace_id() const;     // 32 hex digits
+    std::string traceparent() const;  // header / env value
+};
+
+// Parse a traceparent value; false (and `out` untouched) if it is malformed.
+bool parse_traceparent(const std::string& value, TraceContext& out);
+
+// A fresh trace: random trace id, no parent span.
+TraceContext new_trace();
+
+// The context a process was started with ($TRACEPARENT), or an invalid one.
+TraceContext context_from_env();
+
+// Start the recorder for this process, appending to `path`, or to
+// $JUNCTION_TRACE_FILE when `path` is empty. `service` names the process in every
+// span. Returns false (tracing stays off) if there is no path or it cannot be
+// opened. Call once, before any span.
+bool start(const char* service, const std::string& path = "");
+
+// Flush what is left in the ring and stop the background thread. Short-lived
+// processes call this before exiting; servers may simply never stop.
+void stop();
+
+bool enabled();
+
+// Spans lost because the ring was full.
+uint64_t dropped();
+
+int64_t now_ns();
+
+// Record a finished span under `parent` (its trace and span id); `span_id` 0 gets
+// a fresh id. `name` must outlive the process (a string literal): the ring stores
+// the pointer.
+void record(const TraceContext& parent, uint64_t span_id, const char* name, int64_t start_ns, int64_t end_ns);
+
+// A span timed from construction to end() or destruction.
+class Span {
+public:
+    Span(const char* name, const TraceContext& parent);
+    ~Span() { end(); }
+    Span(const Span&) = delete;
+    Span& operator=(const Span&) = delete;
+
+    // The context to hand downstream: this span as the parent. The incoming
+    // context unchanged when the span is not being recorded.
+    const TraceContext& context() const { return ctx_; }
+    void end();
+
+private:
+    const char* name_;
+    TraceContext ctx_;
+    uint64_t parent_id_ = 0;
+    int64_t start_ns_ = 0;
+    bool active_ = false;
+};
+
+}  // namespace tracing
+
+#endif  // REQUEST_TRACE_H
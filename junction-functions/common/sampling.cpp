@@ -0,0 +1,521 @@
+#include "sampling.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SAMPLING_X86 1
+#define SAMPLING_AVX2 __attribute__((target("avx2,fma")))
+#define SAMPLING_AVX512 __attribute__((target("avx512f")))
+#endif
+
+namespace sampling {
+namespace {
+
+using Candidates = std::vector<std::pair<float, int64_t>>;
+
+// Min-heap of the k best (value, index) pairs seen so far.
+struct TopKHeap {
+    Candidates& h;
+    int64_t k;
+
+    static bool worse(const std::pair<float, int64_t>& a, const std::pair<float, int64_t>& b) {
+        return a.first > b.first;
+    }
+    float threshold() const {
+        return static_cast<int64_t>(h.size()) < k ? -std::numeric_limits<float>::infinity() : h.front().first;
+    }
+    void offer(float v, int64_t i) {
+        if (static_cast<int64_t>(h.size()) < k) {
+            h.emplace_back(v, i);
+            std::push_heap(h.begin(), h.end(), worse);
+        } else if (v > h.front().first) {
+            std::pop_heap(h.begin(), h.end(), worse);
+            h.back() = {v, i};
+            std::push_heap(h.begin(), h.end(), worse);
+        }
+    }
+};
+
+// ---- Scalar kernels -------------------------------------------------------
+
+int64_t argmax_scalar(const float* x, int64_t n) {
+    int64_t best = 0;
+    for (int64_t i = 1; i < n; ++i) {
+        if (x[i] > x[best]) best = i;
+    }
+    return best;
+}
+
+float max_scalar(const float* x, int64_t n) {
+    return x[argmax_scalar(x, n)];
+}
+
+// out[i] = exp((x[i] - shift) * scale); returns the sum.
+float exp_sum_scalar(const float* x, int64_t n, float shift, float scale, float* out) {
+    float sum = 0.0f;
+    for (int64_t i = 0; i < n; ++i) {
+        out[i] = std::exp((x[i] - shift) * scale);
+        sum += out[i];
+    }
+    return sum;
+}
+
+void scale_scalar(float* x, int64_t n, float s) {
+    for (int64_t i = 0; i < n; ++i) x[i] *= s;
+}
+
+// Sum of the entries >= t.
+float mass_above_scalar(const float* x, int64_t n, float t) {
+    float sum = 0.0f;
+    for (int64_t i = 0; i < n; ++i) {
+        if (x[i] >= t) sum += x[i];
+    }
+    return sum;
+}
+
+void top_k_scalar(const float* x, int64_t n, TopKHeap& heap) {
+    for (int64_t i = 0; i < n; ++i) {
+        if (x[i] > heap.threshold()) heap.offer(x[i], i);
+    }
+}
+
+#ifdef SAMPLING_X86
+
+// ---- AVX2 kernels ---------------------------------------------------------
+
+// Cephes-style expf: range-reduce by ln2, degree-6 polynomial, rebuild 2^n.
+SAMPLING_AVX2 inline __m256 exp_avx2(__m256 x) {
+    x = _mm256_min_ps(_mm256_max_ps(x, _mm256_set1_ps(-87.3365447504f)), _mm256_set1_ps(88.3762626647949f));
+    __m256 fx = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(1.44269504088896341f)),
+                                _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    x = _mm256_fnmadd_ps(fx, _mm256_set1_ps(0.693359375f), x);
+    x = _mm256_fnmadd_ps(fx, _mm256_set1_ps(-2.12194440e-4f), x);
+    __m256 y = _mm256_set1_ps(1.9875691500e-4f);
+    y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(1.3981999507e-3f));
+    y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(8.3334519073e-3f));
+    y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(4.1665795894e-2f));
+    y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(1.6666665459e-1f));
+    y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(5.0000001201e-1f));
+    y = _mm256_fmadd_ps(y, _mm256_mul_ps(x, x), _mm256_add_ps(x, _mm256_set1_ps(1.0f)));
+    __m256i e = _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(fx), _mm256_set1_epi32(127)), 23);
+    return _mm256_mul_ps(y, _mm256_castsi256_ps(e));
+}
+
+SAMPLING_AVX2 inline float hsum_avx2(__m256 v) {
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    s = _mm_add_ss(s, _mm_movehdup_ps(s));
+    return _mm_cvtss_f32(s);
+}
+
+SAMPLING_AVX2 int64_t argmax_avx2(const float* x, int64_t n) {
+    if (n < 8) return argmax_scalar(x, n);
+    __m256 best = _mm256_loadu_ps(x);
+    __m256i best_idx = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i idx = best_idx;
+    const __m256i step = _mm256_set1_epi32(8);
+    int64_t i = 8;
+    for (; i + 8 <= n; i += 8) {
+        idx = _mm256_add_epi32(idx, step);
+        __m256 v = _mm256_loadu_ps(x + i);
+        __m256 gt = _mm256_cmp_ps(v, best, _CMP_GT_OQ);
+        best = _mm256_blendv_ps(best, v, gt);
+        best_idx = _mm256_castps_si256(_mm256_blendv_ps(
+            _mm256_castsi256_ps(best_idx), _mm256_castsi256_ps(idx), gt));
+    }
+
+    alignas(32) float vals[8];
+    alignas(32) int32_t idxs[8];
+    _mm256_store_ps(vals, best);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(idxs), best_idx);
+    int64_t result = idxs[0];
+    float result_v = vals[0];
+    for (int lane = 1; lane < 8; ++lane) {
+        if (vals[lane] > result_v || (vals[lane] == result_v && idxs[lane] < result)) {
+            result_v = vals[lane];
+            result = idxs[lane];
+        }
+    }
+    for (; i < n; ++i) {
+        if (x[i] > result_v) {
+            result_v = x[i];
+            result = i;
+        }
+    }
+    return result;
+}
+
+SAMPLING_AVX2 float max_avx2(const float* x, int64_t n) {
+    if (n < 8) return max_scalar(x, n);
+    __m256 m = _mm256_loadu_ps(x);
+    int64_t i = 8;
+    for (; i + 8 <= n; i += 8) m = _mm256_max_ps(m, _mm256_loadu_ps(x + i));
+    __m128 s = _mm_max_ps(_mm256_castps256_ps128(m), _mm256_extractf128_ps(m, 1));
+    s = _mm_max_ps(s, _mm_movehl_ps(s, s));
+    s = _mm_max_ss(s, _mm_movehdup_ps(s));
+    float r = _mm_cvtss_f32(s);
+    for (; i < n; ++i) r = std::max(r, x[i]);
+    return r;
+}
+
+SAMPLING_AVX2 float exp_sum_avx2(const float* x, int64_t n, float shift, float scale, float* out) {
+    const __m256 vshift = _mm256_set1_ps(shift);
+    const __m256 vscale = _mm256_set1_ps(scale);
+    __m256 acc = _mm256_setzero_ps();
+    int64_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 e = exp_avx2(_mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(x + i), vshift), vscale));
+        _mm256_storeu_ps(out + i, e);
+        acc = _mm256_add_ps(acc, e);
+    }
+    return hsum_avx2(acc) + exp_sum_scalar(x + i, n - i, shift, scale, out + i);
+}
+
+SAMPLING_AVX2 void scale_avx2(float* x, int64_t n, float s) {
+    const __m256 vs = _mm256_set1_ps(s);
+    int64_t i = 0;
+    for (; i + 8 <= n; i += 8) _mm256_storeu_ps(x + i, _mm256_mul_ps(_mm256_loadu_ps(x + i), vs));
+    scale_scalar(x + i, n - i, s);
+}
+
+SAMPLING_AVX2 float mass_above_avx2(const float* x, int64_t n, float t) {
+    const __m256 vt = _mm256_set1_ps(t);
+    __m256 acc = _mm256_setzero_ps();
+    int64_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 v = _mm256_loadu_ps(x + i);
+        acc = _mm256_add_ps(acc, _mm256_and_ps(v, _mm256_cmp_ps(v, vt, _CMP_GE_OQ)));
+    }
+    return hsum_avx2(acc) + mass_above_scalar(x + i, n - i, t);
+}
+
+SAMPLING_AVX2 void top_k_avx2(const float* x, int64_t n, TopKHeap& heap) {
+    int64_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 v = _mm256_loadu_ps(x + i);
+        int mask = _mm256_movemask_ps(_mm256_cmp_ps(v, _mm256_set1_ps(heap.threshold()), _CMP_GT_OQ));
+        while (mask) {
+            int lane = __builtin_ctz(mask);
+            mask &= mask - 1;
+            if (x[i + lane] > heap.threshold()) heap.offer(x[i + lane], i + lane);
+        }
+    }
+    for (; i < n; ++i) {
+        if (x[i] > heap.threshold()) heap.offer(x[i], i);
+    }
+}
+
+// ---- AVX-512 kernels ------------------------------------------------------
+
+SAMPLING_AVX512 inline __m512 exp_avx512(__m512 x) {
+    x = _mm512_min_ps(_mm512_max_ps(x, _mm512_set1_ps(-87.3365447504f)), _mm512_set1_ps(88.3762626647949f));
+    __m512 fx = _mm512_roundscale_ps(_mm512_mul_ps(x, _mm512_set1_ps(1.44269504088896341f)),
+                                     _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    x = _mm512_fnmadd_ps(fx, _mm512_set1_ps(0.693359375f), x);
+    x = _mm512_fnmadd_ps(fx, _mm512_set1_ps(-2.12194440e-4f), x);
+    __m512 y = _mm512_set1_ps(1.9875691500e-4f);
+    y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(1.3981999507e-3f));
+    y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(8.3334519073e-3f));
+    y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(4.1665795894e-2f));
+    y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(1.6666665459e-1f));
+    y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(5.0000001201e-1f));
+    y = _mm512_fmadd_ps(y, _mm512_mul_ps(x, x), _mm512_add_ps(x, _mm512_set1_ps(1.0f)));
+    __m512i e = _mm512_slli_epi32(_mm512_add_epi32(_mm512_cvtps_epi32(fx), _mm512_set1_epi32(127)), 23);
+    return _mm512_mul_ps(y, _mm512_castsi512_ps(e));
+}
+
+SAMPLING_AVX512 int64_t argmax_avx512(const float* x, int64_t n) {
+    if (n < 16) return argmax_scalar(x, n);
+    __m512 best = _mm512_loadu_ps(x);
+    __m512i best_idx = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    __m512i idx = best_idx;
+    const __m512i step = _mm512_set1_epi32(16);
+    int64_t i = 16;
+    for (; i + 16 <= n; i += 16) {
+        idx = _mm512_add_epi32(idx, step);
+        __m512 v = _mm512_loadu_ps(x + i);
+        __mmask16 gt = _mm512_cmp_ps_mask(v, best, _CMP_GT_OQ);
+        best = _mm512_mask_mov_ps(best, gt, v);
+        best_idx = _mm512_mask_mov_epi32(best_idx, gt, idx);
+    }
+
+    float result_v = _mm512_reduce_max_ps(best);
+    __mmask16 at_max = _mm512_cmp_ps_mask(best, _mm512_set1_ps(result_v), _CMP_EQ_OQ);
+    int64_t result = _mm512_mask_reduce_min_epi32(at_max, best_idx);
+    for (; i < n; ++i) {
+        if (x[i] > result_v) {
+            result_v = x[i];
+            result = i;
+        }
+    }
+    return result;
+}
+
+SAMPLING_AVX512 float max_avx512(const float* x, int64_t n) {
+    if (n < 16) return max_scalar(x, n);
+    __m512 m = _mm512_loadu_ps(x);
+    int64_t i = 16;
+    for (; i + 16 <= n; i += 16) m = _mm512_max_ps(m, _mm512_loadu_ps(x + i));
+    float r = _mm512_reduce_max_ps(m);
+    for (; i < n; ++i) r = std::max(r, x[i]);
+    return r;
+}
+
+SAMPLING_AVX512 float exp_sum_avx512(const float* x, int64_t n, float shift, float scale, float* out) {
+    const __m512 vshift = _mm512_set1_ps(shift);
+    const __m512 vscale = _mm512_set1_ps(scale);
+    __m512 acc = _mm512_setzero_ps();
+    int64_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512 e = exp_avx512(_mm512_mul_ps(_mm512_sub_ps(_mm512_loadu_ps(x + i), vshift), vscale));
+        _mm512_storeu_ps(out + i, e);
+        acc = _mm512_add_ps(acc, e);
+    }
+    return _mm512_reduce_add_ps(acc) + exp_sum_scalar(x + i, n - i, shift, scale, out + i);
+}
+
+SAMPLING_AVX512 void scale_avx512(float* x, int64_t n, float s) {
+    const __m512 vs = _mm512_set1_ps(s);
+    int64_t i = 0;
+    for (; i + 16 <= n; i += 16) _mm512_storeu_ps(x + i, _mm512_mul_ps(_mm512_loadu_ps(x + i), vs));
+    scale_scalar(x + i, n - i, s);
+}
+
+SAMPLING_AVX512 float mass_above_avx512(const float* x, int64_t n, float t) {
+    const __m512 vt = _mm512_set1_ps(t);
+    __m512 acc = _mm512_setzero_ps();
+    int64_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512 v = _mm512_loadu_ps(x + i);
+        acc = _mm512_mask_add_ps(acc, _mm512_cmp_ps_mask(v, vt, _CMP_GE_OQ), acc, v);
+    }
+    return _mm512_reduce_add_ps(acc) + mass_above_scalar(x + i, n - i, t);
+}
+
+SAMPLING_AVX512 void top_k_avx512(const float* x, int64_t n, TopKHeap& heap) {
+    int64_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512 v = _mm512_loadu_ps(x + i);
+        unsigned mask = _mm512_cmp_ps_mask(v, _mm512_set1_ps(heap.threshold()), _CMP_GT_OQ);
+        while (mask) {
+            int lane = __builtin_ctz(mask);
+            mask &= mask - 1;
+            if (x[i + lane] > heap.threshold()) heap.offer(x[i + lane], i + lane);
+        }
+    }
+    for (; i < n; ++i) {
+        if (x[i] > heap.threshold()) heap.offer(x[i], i);
+    }
+}
+
+#endif  // SAMPLING_X86
+
+struct Kernels {
+    Isa isa;
+    int64_t (*argmax)(const float*, int64_t);
+    float (*max)(const float*, int64_t);
+    float (*exp_sum)(const float*, int64_t, float, float, float*);
+    void (*scale)(float*, int64_t, float);
+    float (*mass_above)(const float*, int64_t, float);
+    void (*top_k)(const float*, int64_t, TopKHeap&);
+};
+
+const Kernels kScalar{Isa::Scalar, argmax_scalar, max_scalar, exp_sum_scalar, scale_scalar, mass_above_scalar, top_k_scalar};
+#ifdef SAMPLING_X86
+const Kernels kAvx2{Isa::Avx2, argmax_avx2, max_avx2, exp_sum_avx2, scale_avx2, mass_above_avx2, top_k_avx2};
+const Kernels kAvx512{Isa::Avx512, argmax_avx512, max_avx512, exp_sum_avx512, scale_avx512, mass_above_avx512, top_k_avx512};
+#endif
+
+Isa best_supported() {
+#ifdef SAMPLING_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return Isa::Avx512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return Isa::Avx2;
+#endif
+    return Isa::Scalar;
+}
+
+const Kernels* kernels_for(Isa isa) {
+#ifdef SAMPLING_X86
+    if (isa == Isa::Avx512) return &kAvx512;
+    if (isa == Isa::Avx2) return &kAvx2;
+#endif
+    (void)isa;
+    return &kScalar;
+}
+
+const Kernels*& active() {
+    static const Kernels* k = kernels_for(best_supported());
+    return k;
+}
+
+}  // namespace
+
+Isa active_isa() {
+    return active()->isa;
+}
+
+const char* isa_name(Isa isa) {
+    switch (isa) {
+        case Isa::Avx512: return "avx512";
+        case Isa::Avx2: return "avx2";
+        default: return "scalar";
+    }
+}
+
+void force_isa(Isa isa) {
+    active() = kernels_for(std::min(isa, best_supported()));
+}
+
+int64_t argmax(const float* logits, int64_t n) {
+    return active()->argmax(logits, n);
+}
+
+float max_value(const float* logits, int64_t n) {
+    return active()->max(logits, n);
+}
+
+void softmax(const float* logits, int64_t n, float temperature, float* out) {
+    const Kernels* k = active();
+    const float m = k->max(logits, n);
+    const float sum = k->exp_sum(logits, n, m, 1.0f / temperature, out);
+    k->scale(out, n, 1.0f / sum);
+}
+
+void top_k(const float* values, int64_t n, int64_t k, Candidates& out) {
+    out.clear();
+    k = std::min(k, n);
+    if (k <= 0) return;
+    TopKHeap heap{out, k};
+    active()->top_k(values, n, heap);
+    std::sort(out.begin(), out.end(), [](const auto& a, const auto& b) {
+        return a.first > b.first || (a.first == b.first && a.second < b.second);
+    });
+}
+
+Sampler::Sampler(int64_t vocab_size) {
+    probs_.reserve(vocab_size);
+    cands_.reserve(256);
+}
+
+int64_t Sampler::draw(const Candidates& cands, size_t count, float total, std::mt19937_64& rng) {
+    std::uniform_real_distribution<float> uni(0.0f, total);
+    float r = uni(rng);
+    for (size_t i = 0; i < count; ++i) {
+        r -= cands[i].first;
+        if (r <= 0.0f) return cands[i].second;
+    }
+    return cands[count - 1].second;
+}
+
+// Unnormalized softmax over the top-k logits, left in cands_ in descending order.
+// Returns how many of them survive top-p; `total` is their summed weight.
+size_t Sampler::top_k_weights(const float* logits, int64_t n, const SamplingParams& p, float& total) {
+    top_k(logits, n, p.top_k, cands_);
+    const float m = cands_.front().first;
+    total = 0.0f;
+    for (auto& c : cands_) {
+        c.first = std::exp((c.first - m) / p.temperature);
+        total += c.first;
+    }
+    if (p.top_p >= 1.0f) return cands_.size();
+
+    const float limit = p.top_p * total;
+    float cum = 0.0f;
+    size_t count = 0;
+    while (count < cands_.size()) {
+        cum += cands_[count++].first;
+        if (cum >= limit) break;
+    }
+    total = cum;
+    return count;
+}
+
+int64_t Sampler::sample(const float* logits, int64_t n, const SamplingParams& p, std::mt19937_64& rng) {
+    if (p.temperature <= 0.0f || p.top_k == 1) return argmax(logits, n);
+
+    if (p.top_k > 0) {
+        float total = 0.0f;
+        const size_t count = top_k_weights(logits, n, p, total);
+        return draw(cands_, count, total, rng);
+    }
+
+    probs_.resize(n);
+    softmax(logits, n, p.temperature, probs_.data());
+    if (p.top_p >= 1.0f) return sample_from(probs_.data(), n, 1.0f, rng);
+
+    // Nucleus. Draw among the survivors in index order; the nucleus is a set, so it
+    // never needs sorting.
+    const float cutoff = nucleus_cutoff(probs_.data(), n, p.top_p);
+    std::uniform_real_distribution<float> uni(0.0f, active()->mass_above(probs_.data(), n, cutoff));
+    float r = uni(rng);
+    int64_t last = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        if (probs_[i] < cutoff) continue;
+        last = i;
+        r -= probs_[i];
+        if (r <= 0.0f) return i;
+    }
+    return last;
+}
+
+// Highest probability cutoff whose survivors still hold top_p of the mass.
+float Sampler::nucleus_cutoff(const float* probs, int64_t n, float top_p) {
+    // Real distributions are peaked, so the top 64 usually hold top_p already.
+    top_k(probs, n, 64, cands_);
+    float cum = 0.0f;
+    for (const auto& c : cands_) {
+        cum += c.first;
+        if (cum >= top_p) return c.first;
+    }
+    // Flat tail: bisect with a vectorized masked sum instead of sorting the vocab.
+    const Kernels* k = active();
+    float lo = 0.0f;
+    float hi = cands_.back().first;
+    for (int it = 0; it < 24; ++it) {
+        const float mid = 0.5f * (lo + hi);
+        (k->mass_above(probs, n, mid) >= top_p ? lo : hi) = mid;
+    }
+    return lo;
+}
+
+void Sampler::distribution(const float* logits, int64_t n, const SamplingParams& p, float* out) {
+    if (p.temperature <= 0.0f || p.top_k == 1) {
+        std::fill(out, out + n, 0.0f);
+        out[argmax(logits, n)] = 1.0f;
+        return;
+    }
+
+    if (p.top_k > 0) {
+        float total = 0.0f;
+        const size_t count = top_k_weights(logits, n, p, total);
+        std::fill(out, out + n, 0.0f);
+        for (size_t i = 0; i < count; ++i) out[cands_[i].second] = cands_[i].first / total;
+        return;
+    }
+
+    softmax(logits, n, p.temperature, out);
+    if (p.top_p >= 1.0f) return;
+    const Kernels* k = active();
+    const float cutoff = nucleus_cutoff(out, n, p.top_p);
+    const float total = k->mass_above(out, n, cutoff);
+    for (int64_t i = 0; i < n; ++i) out[i] = out[i] < cutoff ? 0.0f : out[i] / total;
+}
+
+int64_t sample_from(const float* weights, int64_t n, float total, std::mt19937_64& rng) {
+    std::uniform_real_distribution<float> uni(0.0f, total);
+    float r = uni(rng);
+    int64_t last = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        if (weights[i] <= 0.0f) continue;
+        last = i;
+        r -= weights[i];
+        if (r <= 0.0f) return i;
+    }
+    return last;
+}
+
+}  // namespace sampling
@@ -0,0 +1,67 @@
+#ifndef SAMPLING_H
+#define SAMPLING_H
+
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+// Post-processing of next-token logits over the vocab (50257 entries for the GPT-2
+// family). Each kernel has AVX-512, AVX2 and scalar versions; the widest one the
+// CPU supports is picked once at startup.
+namespace sampling {
+
+enum class Isa { Scalar, Avx2, Avx512 };
+
+// ISA used by the kernels below. Starts as the best one the CPU supports.
+Isa active_isa();
+const char* isa_name(Isa isa);
+// Pin the kernels to `isa` (benchmarks and tests); it is clamped to what the CPU supports.
+void force_isa(Isa isa);
+
+// Index of the largest logit; ties go to the lowest index.
+int64_t argmax(const float* logits, int64_t n);
+float max_value(const float* logits, int64_t n);
+
+// out = softmax(logits / temperature). `out` may alias `logits`.
+void softmax(const float* logits, int64_t n, float temperature, float* out);
+
+// Draw an index from non-negative weights that sum to `total`.
+int64_t sample_from(const float* weights, int64_t n, float total, std::mt19937_64& rng);
+
+// The k largest entries of `values`, written to `out` in descending order as
+// (value, index) pairs. Uses a size-k min-heap and only leaves SIMD for lanes that
+// beat the current k-th best, so it costs about one vector compare per 8/16 logits.
+void top_k(const float* values, int64_t n, int64_t k, std::vector<std::pair<float, int64_t>>& out);
+
+struct SamplingParams {
+    float temperature = 1.0f;  // <= 0 means greedy
+    int64_t top_k = 0;         // 0 disables
+    float top_p = 1.0f;        // 1 disables
+};
+
+// Stateful sampler that owns its scratch space, so per-token sampling does not
+// allocate once the buffers have grown to the vocab size.
+class Sampler {
+public:
+    explicit Sampler(int64_t vocab_size = 0);
+
+    int64_t sample(const float* logits, int64_t n, const SamplingParams& params, std::mt19937_64& rng);
+
+    // Writes the normalized distribution sample() draws from (temperature, top-k and
+    // top-p applied; dropped tokens get 0) to out[n]. Greedy params give a one-hot.
+    void distribution(const float* logits, int64_t n, const SamplingParams& params, float* out);
+
+private:
+    size_t top_k_weights(const float* logits, int64_t n, const SamplingParams& params, float& total);
+    float nucleus_cutoff(const float* probs, int64_t n, float top_p);
+    int64_t draw(const std::vector<std::pair<float, int64_t>>& cands, size_t count, float total,
+                 std::mt19937_64& rng);
+
+    std::vector<float> probs_;
+    std::vector<std::pair<float, int64_t>> cands_;
+};
+
+}  // namespace sampling
+
+#endif // SAMPLING_H
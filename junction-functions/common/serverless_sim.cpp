@@ -0,0 +1,283 @@
+#include "serverless_sim.h"
+
+#include "hdr_histogram.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+
+namespace {
+uint64_t splitmix64(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+template <typename T>
+const T& pick(const std::vector<T>& samples, uint64_t key) {
+    return samples[static_cast<size_t>(splitmix64(key) % samples.size())];
+}
+
+struct Instance {
+    double started = 0.0;
+    int busy = 0;
+    bool ready = false;
+    bool alive = true;
+    bool listed = false;  // in the free list
+    uint32_t generation = 0;  // bumped whenever it stops being idle: stale expiries are ignored
+    double idle_since = 0.0;
+};
+
+enum class EventType : uint8_t { Ready, Done, Expire };
+
+struct Event {
+    double time;
+    EventType type;
+    uint32_t instance;
+    uint32_t arg;  // Done: request index; Expire: generation
+
+    bool operator>(const Event& other) const { return time > other.time; }
+};
+
+// The last kGaps inter-arrival times; the adaptive keep-alive is recomputed from
+// them every kRecompute arrivals rather than on every idle transition.
+class GapWindow {
+public:
+    static constexpr size_t kGaps = 1024;
+    static constexpr uint64_t kRecompute = 256;
+
+    void add(double gap) {
+        gaps_[next_++ % kGaps] = gap;
+        filled_ = std::min(filled_ + 1, kGaps);
+    }
+    bool due() const { return next_ % kRecompute == 0; }
+    double percentile(double p) {
+        if (filled_ == 0) return std::numeric_limits<double>::infinity();
+        scratch_.assign(gaps_.begin(), gaps_.begin() + static_cast<long>(filled_));
+        const size_t k = std::min(filled_ - 1, static_cast<size_t>(std::ceil(p / 100.0 * filled_)) - (p > 0 ? 1 : 0));
+        std::nth_element(scratch_.begin(), scratch_.begin() + static_cast<long>(k), scratch_.end());
+        return scratch_[k];
+    }
+
+private:
+    std::array<double, kGaps> gaps_{};
+    std::vector<double> scratch_;
+    size_t filled_ = 0;
+    uint64_t next_ = 0;
+};
+}  // namespace
+
+std::vector<SimRequest> make_requests(const std::vector<TraceRow>& rows, const SimModel& model, uint64_t seed) {
+    std::vector<SimRequest> out;
+    out.reserve(rows.size());
+    // Rows name a handful of buckets: resolve each name once.
+    std::vector<std::pair<std::string, uint32_t>> seen;
+    for (size_t i = 0; i < rows.size(); ++i) {
+        const std::string& name = rows[i].bucket;
+        auto hit = std::find_if(seen.begin(), seen.end(), [&](const auto& s) { return s.first == name; });
+        if (hit == seen.end()) {
+            auto it = std::find(model.buckets.begin(), model.buckets.end(), name);
+            if (it == model.buckets.end() || model.service_s[static_cast<size_t>(it - model.buckets.begin())].empty()) {
+                throw std::runtime_error("no service time for bucket '" + name + "'");
+            }
+            seen.emplace_back(name, static_cast<uint32_t>(it - model.buckets.begin()));
+            hit = seen.end() - 1;
+        }
+        SimRequest r;
+        r.arrival = rows[i].ts_seconds;
+        r.bucket = hit->second;
+        r.service = pick(model.service_s[r.bucket], seed ^ (i * 0x2545f4914f6cdd1dULL));
+        out.push_back(r);
+    }
+    return out;
+}
+
+SimResult simulate(const std::vector<SimRequest>& requests, const SimModel& model, const SimHost& host,
+                   const SimPolicy& policy, uint64_t seed) {
+    if (model.cold_start_s.empty()) throw std::runtime_error("model has no cold start samples");
+    const int concurrency = std::max(1, policy.concurrency);
+    const int cores_per_instance = std::max(1, model.cores_per_instance);
+    int max_instances = std::max(1, host.cores / cores_per_instance);
+    if (host.memory_mb > 0 && model.instance_memory_mb > 0) {
+        max_instances = std::min(max_instances, static_cast<int>(host.memory_mb / model.instance_memory_mb));
+    }
+    if (policy.max_replicas > 0) max_instances = std::min(max_instances, policy.max_replicas);
+    max_instances = std::max(max_instances, std::min(policy.min_warm, max_instances));
+
+    SimResult result;
+    HdrHistogram latency_us;
+    std::vector<Instance> instances;
+    std::vector<uint32_t> free_list;  // instances with a free slot, most recently freed last
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event>> events;
+    std::deque<uint32_t> waiting;     // request indexes
+    std::vector<uint8_t> was_queued(requests.size(), 0);
+    int alive = 0;
+    int starting_slots = 0;
+    double latency_sum = 0.0;
+    GapWindow gaps;
+    double adaptive_keep_alive = policy.keep_alive_s;
+
+    auto retire = [&](Instance& inst, double now) {
+        inst.alive = false;
+        --alive;
+        result.memory_mb_s += (now - inst.started) * model.instance_memory_mb;
+    };
+    auto go_idle = [&](uint32_t id, double now) {
+        Instance& inst = instances[id];
+        inst.idle_since = now;
+        const double keep = policy.keep_alive == KeepAlive::Adaptive
+                                ? std::min(adaptive_keep_alive, policy.keep_alive_s)
+                                : policy.keep_alive_s;
+        events.push({now + keep, EventType::Expire, id, ++inst.generation});
+    };
+    auto offer_slot = [&](uint32_t id) {
+        Instance& inst = instances[id];
+        if (!inst.listed && inst.busy < concurrency) {
+            inst.listed = true;
+            free_list.push_back(id);
+        }
+    };
+    auto run = [&](uint32_t id, uint32_t req, double now) {
+        Instance& inst = instances[id];
+        if (inst.busy == 0) {
+            result.idle_instance_s += now - inst.idle_since;
+            ++inst.generation;  // cancels the pending expiry
+        }
+        ++inst.busy;
+        // Requests beyond the instance's cores share them.
+        const double stretch = std::max(1.0, static_cast<double>(inst.busy) / cores_per_instance);
+        events.push({now + requests[req].service * stretch, EventType::Done, id, req});
+    };
+    auto start_instance = [&](double now, bool prewarmed) {
+        const uint32_t id = static_cast<uint32_t>(instances.size());
+        Instance inst;
+        inst.started = now;
+        instances.push_back(inst);
+        ++alive;
+        result.peak_instances = std::max(result.peak_instances, alive);
+        if (prewarmed) {
+            instances[id].ready = true;
+            go_idle(id, now);
+            offer_slot(id);
+            return;
+        }
+        starting_slots += concurrency;
+        const double cold = pick(model.cold_start_s, seed ^ (result.instance_starts * 0x9e3779b97f4a7c15ULL));
+        ++result.instance_starts;
+        events.push({now + cold, EventType::Ready, id, 0});
+    };
+    auto free_instance = [&]() -> int64_t {
+        while (!free_list.empty()) {
+            const uint32_t id = free_list.back();
+            Instance& inst = instances[id];
+            if (inst.alive && inst.busy < concurrency) return id;
+            inst.listed = false;
+            free_list.pop_back();
+        }
+        return -1;
+    };
+    auto take_slot = [&](uint32_t id, uint32_t req, double now) {
+        run(id, req, now);
+        Instance& inst = instances[id];
+        if (inst.busy >= concurrency && inst.listed && !free_list.empty() && free_list.back() == id) {
+            inst.listed = false;
+            free_list.pop_back();
+        }
+    };
+
+    for (int i = 0; i < policy.min_warm && i < max_instances; ++i) start_instance(0.0, true);
+
+    size_t next = 0;
+    size_t outstanding = 0;
+    double now = 0.0;
+    while (next < requests.size() || outstanding > 0) {
+        const bool arrival = next < requests.size() && (events.empty() || requests[next].arrival < events.top().time);
+        if (arrival) {
+            const uint32_t req = static_cast<uint32_t>(next++);
+            now = requests[req].arrival;
+            ++outstanding;
+            if (policy.keep_alive == KeepAlive::Adaptive && req > 0) {
+                gaps.add(now - requests[req - 1].arrival);
+                if (gaps.due()) adaptive_keep_alive = gaps.percentile(policy.idle_percentile);
+            }
+            const int64_t id = free_instance();
+            if (id >= 0) {
+                take_slot(static_cast<uint32_t>(id), req, now);
+                continue;
+            }
+            waiting.push_back(req);
+            was_queued[req] = 1;
+            if (static_cast<int>(waiting.size()) > starting_slots && alive < max_instances) {
+                start_instance(now, false);
+            }
+            continue;
+        }
+
+        const Event e = events.top();
+        events.pop();
+        now = e.time;
+        Instance& inst = instances[e.instance];
+        switch (e.type) {
+        case EventType::Ready: {
+            inst.ready = true;
+            inst.idle_since = now;
+            starting_slots -= concurrency;
+            // Whoever is at the head of the queue waited for this start.
+            while (inst.busy < concurrency && !waiting.empty()) {
+                const uint32_t req = waiting.front();
+                waiting.pop_front();
+                ++result.cold_requests;
+                run(e.instance, req, now);
+            }
+            if (inst.busy == 0) go_idle(e.instance, now);
+            offer_slot(e.instance);
+            break;
+        }
+        case EventType::Done: {
+            --inst.busy;
+            --outstanding;
+            const double latency = now - requests[e.arg].arrival;
+            latency_sum += latency;
+            latency_us.record(static_cast<int64_t>(latency * 1e6));
+            result.queued_requests += was_queued[e.arg];
+            ++result.requests;
+            result.end_s = now;
+            if (!waiting.empty()) {
+                const uint32_t req = waiting.front();
+                waiting.pop_front();
+                inst.idle_since = now;  // handed straight over: no idle gap
+                run(e.instance, req, now);
+                break;
+            }
+            if (inst.busy == 0) go_idle(e.instance, now);
+            offer_slot(e.instance);
+            break;
+        }
+        case EventType::Expire:
+            if (inst.alive && inst.ready && inst.busy == 0 && e.arg == inst.generation && alive > policy.min_warm) {
+                result.idle_instance_s += now - inst.idle_since;
+                retire(inst, now);
+            }
+            break;
+        }
+    }
+
+    for (Instance& inst : instances) {
+        if (!inst.alive) continue;
+        if (inst.busy == 0) result.idle_instance_s += std::max(0.0, result.end_s - inst.idle_since);
+        result.memory_mb_s += std::max(0.0, result.end_s - inst.started) * model.instance_memory_mb;
+    }
+    if (result.requests) {
+        result.mean_s = latency_sum / static_cast<double>(result.requests);
+        result.p50_s = latency_us.value_at_percentile(50) / 1e6;
+        result.p99_s = latency_us.value_at_percentile(99) / 1e6;
+        result.p999_s = latency_us.value_at_percentile(99.9) / 1e6;
+        result.max_s = latency_us.max() / 1e6;
+    }
+    return result;
+}
@@ -0,0 +1,87 @@
+#ifndef SERVERLESS_SIM_H
+#define SERVERLESS_SIM_H
+
+// Discrete-event model of one function on one host. It compares keep-alive,
+// pre-warming and replica policies against an invocation trace offline, in a
+// fraction of the time a replay against live junction_run instances takes.
+//
+// Each instance takes a cold start, drawn from measured samples, before it
+// serves. It then runs up to `concurrency` requests at once, each for its
+// bucket's service time. That time is stretched when the running requests
+// outnumber the instance's cores. Requests that find no free slot wait in one
+// FIFO queue. A new instance is started only when the queue is longer than the
+// slots already starting, and only while the host has cores and memory for it.
+// An instance that goes idle is reclaimed after the policy's keep-alive, unless
+// that would leave fewer than min_warm.
+//
+// Service times are drawn once per trace (make_requests), and cold starts are
+// drawn by start index from a fixed seed. So every policy in a sweep sees the
+// same random numbers, and differences between them come from the policy alone.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "trace_file.h"
+
+struct SimRequest {
+    double arrival = 0.0;  // seconds from the start of the trace
+    double service = 0.0;  // seconds on a free core
+    uint32_t bucket = 0;   // index into SimModel::buckets
+};
+
+// What the function costs, as measured (see bench/policy_sim.cpp for calibration
+// from test/results CSVs).
+struct SimModel {
+    std::vector<std::string> buckets;
+    std::vector<std::vector<double>> service_s;  // per bucket: warm service time samples
+    std::vector<double> cold_start_s;            // instance start time samples
+    double instance_memory_mb = 400.0;
+    int cores_per_instance = 1;
+};
+
+struct SimHost {
+    int cores = 8;
+    double memory_mb = 0.0;  // 0: only cores limit the instance count
+};
+
+enum class KeepAlive {
+    Fixed,     // reclaim after keep_alive_s idle
+    Adaptive,  // after the idle_percentile of recent inter-arrival gaps, at most keep_alive_s
+};
+
+struct SimPolicy {
+    KeepAlive keep_alive = KeepAlive::Fixed;
+    double keep_alive_s = 60.0;
+    double idle_percentile = 99.0;
+    int min_warm = 0;      // kept regardless of load, warm before the first request
+    int max_replicas = 0;  // 0: as many as the host fits
+    int concurrency = 1;   // requests one instance serves at once
+};
+
+struct SimResult {
+    uint64_t requests = 0;
+    uint64_t cold_requests = 0;    // waited for an instance to start
+    uint64_t queued_requests = 0;  // waited at all
+    uint64_t instance_starts = 0;  // min_warm instances not included
+    int peak_instances = 0;
+    double mean_s = 0.0;
+    double p50_s = 0.0;
+    double p99_s = 0.0;
+    double p999_s = 0.0;
+    double max_s = 0.0;
+    double memory_mb_s = 0.0;       // instance memory x lifetime, starts included
+    double idle_instance_s = 0.0;   // instance lifetime with nothing running
+    double end_s = 0.0;             // last completion
+
+    double cold_rate() const { return requests ? static_cast<double>(cold_requests) / requests : 0.0; }
+};
+
+// Map trace rows to buckets of `model` and draw each one's service time. Buckets
+// the model has no samples for are an error.
+std::vector<SimRequest> make_requests(const std::vector<TraceRow>& rows, const SimModel& model, uint64_t seed);
+
+SimResult simulate(const std::vector<SimRequest>& requests, const SimModel& model, const SimHost& host,
+                   const SimPolicy& policy, uint64_t seed);
+
+#endif // SERVERLESS_SIM_H
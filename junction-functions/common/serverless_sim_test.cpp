@@ -0,0 +1,82 @@
+// Checks simulate() on traces small enough to work out by hand: one bucket with
+// a fixed service time, one fixed cold start, and a host with room for them all.
+#include "serverless_sim.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+constexpr double kCold = 2.0;
+constexpr double kService = 0.5;
+constexpr double kMemoryMb = 400.0;
+
+int failures = 0;
+
+void check(const std::string& what, double got, double want) {
+    const bool ok = std::fabs(got - want) <= 1e-3 * std::max(1.0, std::fabs(want));
+    failures += ok ? 0 : 1;
+    std::cout << (ok ? "ok   " : "FAIL ") << what << ": " << got << " (want " << want << ")\n";
+}
+
+SimModel model() {
+    SimModel m;
+    m.buckets = {"small"};
+    m.service_s = {{kService}};
+    m.cold_start_s = {kCold};
+    m.instance_memory_mb = kMemoryMb;
+    return m;
+}
+
+std::vector<SimRequest> arrivals(const std::vector<double>& at) {
+    std::vector<SimRequest> out;
+    for (double t : at) out.push_back({t, kService, 0});
+    return out;
+}
+
+SimResult run(const std::vector<double>& at, SimPolicy policy) {
+    return simulate(arrivals(at), model(), SimHost{}, policy, 1);
+}
+}  // namespace
+
+int main() {
+    SimPolicy no_keep_alive;
+    no_keep_alive.keep_alive_s = 0.0;
+    SimResult one = run({1.0}, no_keep_alive);
+    check("one request: cold starts", static_cast<double>(one.cold_requests), 1);
+    check("one request: instance starts", static_cast<double>(one.instance_starts), 1);
+    check("one request: latency", one.mean_s, kCold + kService);
+    // Started at 1.0, reclaimed as soon as the request finished.
+    check("one request: memory-seconds", one.memory_mb_s, (kCold + kService) * kMemoryMb);
+
+    SimPolicy keep_alive;
+    keep_alive.keep_alive_s = 60.0;
+    SimResult warm = run({0.0, 5.0}, keep_alive);
+    check("within keep-alive: cold starts", static_cast<double>(warm.cold_requests), 1);
+    check("within keep-alive: instance starts", static_cast<double>(warm.instance_starts), 1);
+    check("within keep-alive: mean latency", warm.mean_s, (kCold + kService + kService) / 2);
+    // Alive from 0.0 to the last completion at 5.5.
+    check("within keep-alive: memory-seconds", warm.memory_mb_s, (5.0 + kService) * kMemoryMb);
+
+    SimPolicy short_keep_alive;
+    short_keep_alive.keep_alive_s = 1.0;
+    SimResult expired = run({0.0, 5.0}, short_keep_alive);
+    check("past keep-alive: cold starts", static_cast<double>(expired.cold_requests), 2);
+    // First instance lives 0.0-3.5, the second 5.0-7.5.
+    check("past keep-alive: memory-seconds", expired.memory_mb_s,
+          (kCold + kService + 1.0 + kCold + kService) * kMemoryMb);
+
+    SimPolicy prewarmed;
+    prewarmed.min_warm = 1;
+    prewarmed.keep_alive_s = 0.0;
+    SimResult pre = run({1.0, 3.0}, prewarmed);
+    check("min_warm=1: cold starts", static_cast<double>(pre.cold_requests), 0);
+    check("min_warm=1: instance starts", static_cast<double>(pre.instance_starts), 0);
+    check("min_warm=1: latency", pre.mean_s, kService);
+    // Warm from 0.0, never reclaimed, until the last completion at 3.5.
+    check("min_warm=1: memory-seconds", pre.memory_mb_s, (3.0 + kService) * kMemoryMb);
+
+    return failures ? 1 : 0;
+}
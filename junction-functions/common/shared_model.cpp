@@ -0,0 +1,87 @@
+#include "shared_model.h"
+
+#include <onnxruntime_session_options_config_keys.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+std::unique_ptr<SharedModel> SharedModel::open(const std::string& path) {
+    if (const char* fd_env = std::getenv(kSharedModelFdEnv)) {
+        const int fd = std::atoi(fd_env);
+        if (fd < 0 || fcntl(fd, F_GETFD) < 0) {
+            throw std::runtime_error(std::string(kSharedModelFdEnv) + "=" + fd_env + " is not an open descriptor");
+        }
+        return std::make_unique<SharedModel>(fd, "fd " + std::to_string(fd));
+    }
+    return map_file(path);
+}
+
+std::unique_ptr<SharedModel> SharedModel::map_file(const std::string& path) {
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) throw std::runtime_error("cannot open model " + path + ": " + std::strerror(errno));
+    try {
+        auto model = std::make_unique<SharedModel>(fd, path);
+        ::close(fd);  // the mapping keeps the file alive
+        return model;
+    } catch (...) {
+        ::close(fd);
+        throw;
+    }
+}
+
+SharedModel::SharedModel(int fd, std::string source) : source_(std::move(source)) {
+    struct stat st;
+    if (fstat(fd, &st) != 0) throw std::runtime_error("cannot stat " + source_ + ": " + std::strerror(errno));
+    if (st.st_size <= 0) throw std::runtime_error(source_ + " is empty");
+    size_ = static_cast<size_t>(st.st_size);
+
+    data_ = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+    if (data_ == MAP_FAILED) {
+        data_ = nullptr;
+        throw std::runtime_error("cannot map " + source_ + ": " + std::strerror(errno));
+    }
+    // Session creation reads the whole model front to back.
+    madvise(data_, size_, MADV_WILLNEED);
+
+    // ORT-format models are flatbuffers with file identifier "ORTM" at offset 4.
+    ort_format_ = size_ >= 8 && std::memcmp(static_cast<const char*>(data_) + 4, "ORTM", 4) == 0;
+}
+
+SharedModel::~SharedModel() {
+    if (data_) munmap(data_, size_);
+}
+
+PrepackedWeights::PrepackedWeights() {
+    Ort::ThrowOnError(Ort::GetApi().CreatePrepackedWeightsContainer(&container_));
+}
+
+PrepackedWeights::~PrepackedWeights() {
+    if (container_) Ort::GetApi().ReleasePrepackedWeightsContainer(container_);
+}
+
+Ort::Session create_shared_session(Ort::Env& env, const SharedModel& model, Ort::SessionOptions& opts,
+                                   const PrepackedWeights* prepacked, bool disable_prepacking) {
+    if (model.ort_format()) {
+        // Already optimized by model_compile; keep ORT from copying the buffer or
+        // the initializers out of it.
+        opts.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_DISABLE_ALL);
+        opts.AddConfigEntry(kOrtSessionOptionsConfigLoadModelFormat, "ORT");
+        opts.AddConfigEntry(kOrtSessionOptionsConfigUseORTModelBytesDirectly, "1");
+        opts.AddConfigEntry(kOrtSessionOptionsConfigUseORTModelBytesForInitializers, "1");
+    } else {
+        opts.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_ENABLE_ALL);
+    }
+    if (disable_prepacking) opts.AddConfigEntry(kOrtSessionOptionsConfigDisablePrepacking, "1");
+
+    if (prepacked && !disable_prepacking) {
+        return Ort::Session(env, model.data(), model.size(), opts, prepacked->get());
+    }
+    return Ort::Session(env, model.data(), model.size(), opts);
+}
@@ -0,0 +1,73 @@
+#ifndef SHARED_MODEL_H
+#define SHARED_MODEL_H
+
+#include <onnxruntime_cxx_api.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+// Descriptor JunctionD hands an instance when it spawns it with a shared model
+// (a sealed memfd holding the model bytes).
+constexpr const char* kSharedModelFdEnv = "JUNCTION_MODEL_FD";
+
+// Read-only, MAP_SHARED mapping of a model.
+//
+// Every process that maps the same file (or the same memfd) gets the same physical
+// pages, so N instances cost one copy of the weights plus their own activations.
+// That only holds if ORT leaves the weights where they are: create_shared_session()
+// loads ORT-format artifacts (model_compile output) with their initializers pointing
+// into this mapping. A raw .onnx export still works, but ORT parses it into private
+// tensors, so it gets the shared I/O but not the shared memory.
+class SharedModel {
+public:
+    // Map $JUNCTION_MODEL_FD if JunctionD set it, otherwise `path`.
+    static std::unique_ptr<SharedModel> open(const std::string& path);
+    // Map `path`, ignoring $JUNCTION_MODEL_FD (for processes hosting several models).
+    static std::unique_ptr<SharedModel> map_file(const std::string& path);
+
+    SharedModel(int fd, std::string source);
+    ~SharedModel();
+    SharedModel(const SharedModel&) = delete;
+    SharedModel& operator=(const SharedModel&) = delete;
+
+    const void* data() const { return data_; }
+    size_t size() const { return size_; }
+    // True when the bytes are an ORT-format model rather than ONNX protobuf.
+    bool ort_format() const { return ort_format_; }
+    // Where the bytes came from, for logs ("distilbert.ort", "fd 5").
+    const std::string& source() const { return source_; }
+
+private:
+    void* data_ = nullptr;
+    size_t size_ = 0;
+    bool ort_format_ = false;
+    std::string source_;
+};
+
+// Owns an OrtPrepackedWeightsContainer. Sessions created with the same container
+// share the packed copies ORT makes of MatMul/Gemm weights instead of each
+// building its own. Must outlive those sessions.
+class PrepackedWeights {
+public:
+    PrepackedWeights();
+    ~PrepackedWeights();
+    PrepackedWeights(const PrepackedWeights&) = delete;
+    PrepackedWeights& operator=(const PrepackedWeights&) = delete;
+
+    OrtPrepackedWeightsContainer* get() const { return container_; }
+
+private:
+    OrtPrepackedWeightsContainer* container_ = nullptr;
+};
+
+// Session over `model`'s bytes; `model` must outlive it. Sets the optimization
+// level and load format on `opts` the way configure_model_load() does for paths.
+// Pass `prepacked` to share packed weights with the other sessions in this process,
+// or set `disable_prepacking` to keep every weight in the shared mapping at some
+// cost in GEMM speed (packed copies are private to each process).
+Ort::Session create_shared_session(Ort::Env& env, const SharedModel& model, Ort::SessionOptions& opts,
+                                   const PrepackedWeights* prepacked = nullptr,
+                                   bool disable_prepacking = false);
+
+#endif // SHARED_MODEL_H
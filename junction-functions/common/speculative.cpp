@@ -0,0 +1,195 @@
+#include "speculative.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+double ms_between(Clock::time_point a, Clock::time_point b) {
+    return std::chrono::duration<double, std::milli>(b - a).count();
+}
+
+bool is_greedy(const sampling::SamplingParams& p) {
+    return p.temperature <= 0.0f || p.top_k == 1;
+}
+}  // namespace
+
+SpeculativeDecoder::SpeculativeDecoder(Ort::Session& draft, Ort::Session& target, const SpeculativeConfig& cfg)
+    : cfg_(cfg),
+      draft_(draft, cfg.max_seq_len),
+      target_(target, cfg.max_seq_len, std::max(32, cfg.max_k + 1)),
+      sampler_(target_.dims().vocab_size),
+      vocab_(target_.dims().vocab_size) {
+    cfg_.min_k = std::max(1, cfg_.min_k);
+    cfg_.max_k = std::max(cfg_.min_k, cfg_.max_k);
+    if (draft_.dims().vocab_size != vocab_) {
+        throw std::runtime_error("SpeculativeDecoder: draft and target vocab sizes differ");
+    }
+    if (target_.max_step_tokens() < cfg_.max_k + 1) {
+        throw std::runtime_error("SpeculativeDecoder: target model must be exported with a dynamic sequence axis");
+    }
+    q_.resize(static_cast<size_t>(cfg_.max_k * vocab_));
+    p_.resize(static_cast<size_t>(vocab_));
+    verify_ids_.reserve(static_cast<size_t>(cfg_.max_k) + 1);
+    stats_.k = std::clamp(cfg_.initial_k, cfg_.min_k, cfg_.max_k);
+}
+
+const float* SpeculativeDecoder::feed_draft(const std::vector<int64_t>& ids) {
+    const float* logits = nullptr;
+    for (size_t pos = 0; pos < ids.size();) {
+        const int64_t n = std::min<int64_t>(draft_.max_step_tokens(), static_cast<int64_t>(ids.size() - pos));
+        logits = draft_.step(ids.data() + pos, n) + (n - 1) * vocab_;
+        pos += static_cast<size_t>(n);
+    }
+    return logits;
+}
+
+int SpeculativeDecoder::choose_k() const {
+    if (stats_.draft_ms <= 0.0 || stats_.verify_ms <= 0.0) return stats_.k;
+    const double a = std::min(stats_.acceptance, 0.999);
+    const double c = stats_.draft_ms / stats_.verify_ms;
+
+    int best_k = cfg_.min_k;
+    double best = 0.0;
+    for (int k = cfg_.min_k; k <= cfg_.max_k; ++k) {
+        const double expected = (1.0 - std::pow(a, k + 1)) / (1.0 - a);
+        const double rate = expected / (k * c + 1.0);
+        if (rate > best) {
+            best = rate;
+            best_k = k;
+        }
+    }
+    return best_k;
+}
+
+std::vector<int64_t> SpeculativeDecoder::generate(const std::vector<int64_t>& prompt, int64_t max_new_tokens,
+                                                  const sampling::SamplingParams& params, std::mt19937_64& rng,
+                                                  int64_t eos_token) {
+    const int64_t prompt_len = static_cast<int64_t>(prompt.size());
+    if (prompt.empty() || prompt_len > cfg_.max_seq_len) {
+        throw std::runtime_error("SpeculativeDecoder: prompt must have between 1 and " +
+                                 std::to_string(cfg_.max_seq_len) + " tokens");
+    }
+    // The newest emitted token is never fed, so the caches hold at most
+    // prompt + max_new_tokens - 1 positions.
+    max_new_tokens = std::min(max_new_tokens, cfg_.max_seq_len - prompt_len + 1);
+
+    const bool greedy = is_greedy(params);
+    const double w = cfg_.smoothing;
+    draft_.cache().reset();
+    target_.cache().reset();
+
+    // The target cache holds everything but `last`. The draft cache may lag further
+    // (a fully accepted round leaves d_k unfed), so it keeps its own pending list,
+    // which always ends with `last`.
+    std::vector<int64_t> context(prompt.begin(), prompt.end() - 1);
+    if (!context.empty()) {
+        target_.prefill(context);
+        draft_.prefill(context);
+    }
+    int64_t last = prompt.back();
+    std::vector<int64_t> draft_pending{last};
+    std::vector<int64_t> out;
+
+    while (static_cast<int64_t>(out.size()) < max_new_tokens) {
+        const int64_t base = target_.cache().length();
+        const int64_t remaining = max_new_tokens - static_cast<int64_t>(out.size());
+        const int k = static_cast<int>(std::min<int64_t>(stats_.k, remaining - 1));
+
+        // ---- Draft k tokens ----
+        auto t0 = Clock::now();
+        verify_ids_.assign(1, last);
+        if (k > 0) {
+            const float* logits = feed_draft(draft_pending);
+            draft_pending.clear();
+            for (int i = 0; i < k; ++i) {
+                if (i > 0) logits = draft_.step(&verify_ids_.back(), 1);
+                int64_t d;
+                if (greedy) {
+                    d = sampling::argmax(logits, vocab_);
+                } else {
+                    float* q = q_.data() + i * vocab_;
+                    sampler_.distribution(logits, vocab_, params, q);
+                    d = sampling::sample_from(q, vocab_, 1.0f, rng);
+                }
+                verify_ids_.push_back(d);
+            }
+        }
+
+        // ---- Verify all of them in one target pass ----
+        auto t1 = Clock::now();
+        const float* logits = target_.step(verify_ids_.data(), k + 1);
+        auto t2 = Clock::now();
+
+        int n = 0;
+        int64_t next = -1;
+        for (; n < k; ++n) {
+            const float* row = logits + n * vocab_;
+            const int64_t d = verify_ids_[n + 1];
+            if (greedy) {
+                const int64_t best = sampling::argmax(row, vocab_);
+                if (best == d) continue;
+                next = best;
+                break;
+            }
+
+            const float* q = q_.data() + n * vocab_;
+            sampler_.distribution(row, vocab_, params, p_.data());
+            // Keep d with probability min(1, p/q); q[d] > 0 because d was drawn from q.
+            std::uniform_real_distribution<float> uni(0.0f, 1.0f);
+            if (uni(rng) * q[d] <= p_[d]) continue;
+
+            float total = 0.0f;
+            for (int64_t i = 0; i < vocab_; ++i) {
+                p_[i] = std::max(0.0f, p_[i] - q[i]);
+                total += p_[i];
+            }
+            next = total > 0.0f ? sampling::sample_from(p_.data(), vocab_, total, rng) : d;
+            break;
+        }
+        if (next < 0) {
+            // Every draft survived: the target's last row gives one token for free.
+            const float* row = logits + k * vocab_;
+            next = greedy ? sampling::argmax(row, vocab_) : sampler_.sample(row, vocab_, params, rng);
+        }
+
+        // ---- Roll both caches back to the accepted prefix ----
+        target_.cache().truncate(base + 1 + n);
+        if (k > 0) {
+            // The draft fed last, d1..d(k-1); keep last, d1..dn.
+            draft_.cache().truncate(base + 1 + std::min(n, k - 1));
+            if (n == k) draft_pending.push_back(verify_ids_[k]);
+        }
+        draft_pending.push_back(next);
+        last = next;
+
+        bool stop = false;
+        for (int i = 1; i <= n + 1 && !stop; ++i) {
+            const int64_t tok = i <= n ? verify_ids_[i] : next;
+            out.push_back(tok);
+            stop = eos_token >= 0 && tok == eos_token;
+        }
+
+        ++stats_.rounds;
+        ++stats_.target_runs;
+        stats_.drafted += static_cast<uint64_t>(k);
+        stats_.accepted += static_cast<uint64_t>(n);
+        stats_.generated += static_cast<uint64_t>(n + 1);
+        if (k > 0) {
+            const double draft_step = ms_between(t0, t1) / k;
+            stats_.draft_ms = stats_.draft_ms > 0.0 ? w * stats_.draft_ms + (1 - w) * draft_step : draft_step;
+            hits_ = w * hits_ + (1 - w) * n;
+            misses_ = w * misses_ + (1 - w) * (n < k ? 1.0 : 0.0);
+            stats_.acceptance = hits_ + misses_ > 0.0 ? hits_ / (hits_ + misses_) : 0.0;
+        }
+        const double verify = ms_between(t1, t2);
+        stats_.verify_ms = stats_.verify_ms > 0.0 ? w * stats_.verify_ms + (1 - w) * verify : verify;
+        stats_.k = choose_k();
+
+        if (stop) break;
+    }
+    return out;
+}
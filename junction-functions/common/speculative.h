@@ -0,0 +1,81 @@
+#ifndef SPECULATIVE_H
+#define SPECULATIVE_H
+
+#include "gpt2_decoder.h"
+#include "sampling.h"
+
+#include <onnxruntime_cxx_api.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+struct SpeculativeConfig {
+    int64_t max_seq_len = 1024;
+    int initial_k = 4;     // draft tokens per round before any statistics exist
+    int min_k = 1;         // at least 1, so acceptance keeps being measured
+    int max_k = 8;
+    double smoothing = 0.8;  // EWMA weight on history for acceptance rate and step costs
+};
+
+struct SpeculativeStats {
+    uint64_t rounds = 0;
+    uint64_t drafted = 0;        // tokens proposed by the draft model
+    uint64_t accepted = 0;       // drafted tokens the target kept
+    uint64_t generated = 0;      // tokens emitted (accepted + one per round)
+    uint64_t target_runs = 0;
+    double acceptance = 0.0;     // smoothed per-token acceptance probability
+    double draft_ms = 0.0;       // smoothed cost of one draft step
+    double verify_ms = 0.0;      // smoothed cost of one target verify pass
+    int k = 0;                   // draft length for the next round
+
+    double acceptance_rate() const { return drafted ? double(accepted) / drafted : 0.0; }
+    double tokens_per_target_run() const { return target_runs ? double(generated) / target_runs : 0.0; }
+};
+
+// Speculative decoding: a small draft model (DistilGPT2) proposes k tokens one at a
+// time, then the target (GPT-2, same vocab) scores all of them in one forward pass.
+//
+// Each drafted token d is kept with probability min(1, p(d) / q(d)), where p and q
+// are the target and draft distributions after temperature/top-k/top-p. The first
+// rejection is replaced by a draw from normalize(max(0, p - q)), and if all k survive
+// a bonus token comes from the target's last row. This leaves the output distributed
+// exactly as if GPT-2 had been sampled alone; under greedy params it reproduces GPT-2's
+// greedy output token for token.
+//
+// After every round k is re-chosen to maximize expected tokens per unit time,
+// (1 - a^(k+1)) / (1 - a) / (k * c + 1), from the smoothed acceptance rate a and the
+// measured draft/verify cost ratio c.
+class SpeculativeDecoder {
+public:
+    // The target must be exported with a dynamic sequence axis so k + 1 tokens can be
+    // verified in one Run; the draft may be either kind.
+    SpeculativeDecoder(Ort::Session& draft, Ort::Session& target, const SpeculativeConfig& cfg);
+
+    // Generate up to max_new_tokens after `prompt` (stopping after eos_token unless it
+    // is -1). Both caches are reset first, so calls are independent.
+    std::vector<int64_t> generate(const std::vector<int64_t>& prompt, int64_t max_new_tokens,
+                                  const sampling::SamplingParams& params, std::mt19937_64& rng,
+                                  int64_t eos_token = 50256);
+
+    const SpeculativeStats& stats() const { return stats_; }
+
+private:
+    const float* feed_draft(const std::vector<int64_t>& ids);
+    int choose_k() const;
+
+    SpeculativeConfig cfg_;
+    Gpt2Decoder draft_;
+    Gpt2Decoder target_;
+    sampling::Sampler sampler_;
+    int64_t vocab_;
+
+    std::vector<float> q_;       // [max_k, vocab] draft distributions for this round
+    std::vector<float> p_;       // [vocab] target distribution / residual
+    std::vector<int64_t> verify_ids_;  // [last, d1..dk]
+    SpeculativeStats stats_;
+    double hits_ = 0.0;    // smoothed accepted drafts per round
+    double misses_ = 0.0;  // smoothed rejections per round (0 or 1)
+};
+
+#endif // SPECULATIVE_H
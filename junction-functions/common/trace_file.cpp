@@ -0,0 +1,148 @@
+#include "trace_file.h"
+
+#include "../../junctiond/json.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <istream>
+#include <stdexcept>
+
+using json = nlohmann::json;
+
+std::string bucket_for_tokens(double tokens) {
+    if (tokens <= 256) return "small";
+    if (tokens <= 1000) return "medium";
+    if (tokens <= 4000) return "large";
+    return "xl";
+}
+
+namespace {
+// Days since 1970-01-01 of a proleptic Gregorian date (Howard Hinnant's algorithm).
+int64_t days_from_civil(int64_t y, unsigned m, unsigned d) {
+    y -= m <= 2;
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = static_cast<unsigned>(y - era * 400);
+    const unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<int64_t>(doe) - 719468;
+}
+}  // namespace
+
+double parse_timestamp(const std::string& text) {
+    int y = 0, mo = 0, d = 0, h = 0, mi = 0, consumed = 0;
+    double s = 0.0;
+    if (std::sscanf(text.c_str(), "%d-%d-%d%*1[ T]%d:%d:%lf%n", &y, &mo, &d, &h, &mi, &s, &consumed) < 6) {
+        throw std::runtime_error("unparsable TIMESTAMP '" + text + "'");
+    }
+    double offset = 0.0;
+    const std::string tz = text.substr(static_cast<size_t>(consumed));
+    if (!tz.empty() && (tz[0] == '+' || tz[0] == '-')) {
+        int oh = 0, om = 0;
+        std::sscanf(tz.c_str() + 1, "%d:%d", &oh, &om);
+        offset = (tz[0] == '-' ? -1.0 : 1.0) * (oh * 3600.0 + om * 60.0);
+    }
+    const int64_t days = days_from_civil(y, static_cast<unsigned>(mo), static_cast<unsigned>(d));
+    return static_cast<double>(days) * 86400.0 + h * 3600.0 + mi * 60.0 + s - offset;
+}
+
+std::vector<std::string> split_csv_line(const std::string& line) {
+    std::vector<std::string> out;
+    std::string field;
+    bool quoted = false;
+    for (char c : line) {
+        if (c == '"') {
+            quoted = !quoted;
+        } else if (c == ',' && !quoted) {
+            out.push_back(field);
+            field.clear();
+        } else if (c != '\r') {
+            field += c;
+        }
+    }
+    out.push_back(field);
+    return out;
+}
+
+namespace {
+// Rows carry either seconds already (ts_seconds) or absolute timestamps; both end
+// up relative to the earliest row.
+struct RawRow {
+    double time = 0.0;
+    std::string bucket;
+};
+
+std::vector<RawRow> read_csv(std::istream& in) {
+    std::string line;
+    if (!std::getline(in, line)) throw std::runtime_error("trace is empty");
+    const std::vector<std::string> header = split_csv_line(line);
+    auto column = [&](const char* name) {
+        auto it = std::find(header.begin(), header.end(), name);
+        return it == header.end() ? -1 : static_cast<int>(it - header.begin());
+    };
+    const int ts_col = column("ts_seconds");
+    const int stamp_col = column("TIMESTAMP");
+    const int bucket_col = column("token_bucket") >= 0 ? column("token_bucket") : column("bucket");
+    const int tokens_col = column("ContextTokens");
+    if (ts_col < 0 && stamp_col < 0) throw std::runtime_error("trace is missing TIMESTAMP column");
+    if (bucket_col < 0 && tokens_col < 0) throw std::runtime_error("trace is missing token_bucket or ContextTokens column");
+
+    std::vector<RawRow> rows;
+    while (std::getline(in, line)) {
+        if (line.empty() || line == "\r") continue;
+        const std::vector<std::string> f = split_csv_line(line);
+        auto at = [&](int col) -> const std::string& {
+            if (col >= static_cast<int>(f.size())) throw std::runtime_error("short trace row: " + line);
+            return f[static_cast<size_t>(col)];
+        };
+        RawRow row;
+        row.time = ts_col >= 0 ? std::stod(at(ts_col)) : parse_timestamp(at(stamp_col));
+        row.bucket = bucket_col >= 0 ? at(bucket_col) : bucket_for_tokens(std::stod(at(tokens_col)));
+        rows.push_back(std::move(row));
+    }
+    return rows;
+}
+
+std::vector<RawRow> read_jsonl(std::istream& in) {
+    std::vector<RawRow> rows;
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.find_first_not_of(" \t\r") == std::string::npos) continue;
+        const json j = json::parse(line);
+        RawRow row;
+        if (j.contains("ts_seconds")) {
+            row.time = j["ts_seconds"].get<double>();
+        } else {
+            const json& t = j.contains("TIMESTAMP") ? j["TIMESTAMP"] : j.at("timestamp");
+            row.time = t.is_number() ? t.get<double>() : parse_timestamp(t.get<std::string>());
+        }
+        if (j.contains("token_bucket") || j.contains("bucket")) {
+            row.bucket = (j.contains("token_bucket") ? j["token_bucket"] : j["bucket"]).get<std::string>();
+        } else {
+            const json& tokens = j.contains("ContextTokens") ? j["ContextTokens"] : j.at("context_tokens");
+            row.bucket = bucket_for_tokens(tokens.get<double>());
+        }
+        rows.push_back(std::move(row));
+    }
+    return rows;
+}
+}  // namespace
+
+std::vector<TraceRow> load_trace(const std::string& path, double scale_time, long limit) {
+    std::ifstream in(path);
+    if (!in) throw std::runtime_error("cannot open trace " + path);
+    const bool jsonl = path.size() >= 6 && (path.compare(path.size() - 6, 6, ".jsonl") == 0 ||
+                                            path.compare(path.size() - 5, 5, ".json") == 0);
+    std::vector<RawRow> raw = jsonl ? read_jsonl(in) : read_csv(in);
+    if (raw.empty()) throw std::runtime_error("trace has no rows");
+
+    std::stable_sort(raw.begin(), raw.end(), [](const RawRow& a, const RawRow& b) { return a.time < b.time; });
+    if (limit >= 0 && raw.size() > static_cast<size_t>(limit)) raw.resize(static_cast<size_t>(limit));
+    if (raw.empty()) throw std::runtime_error("--limit " + std::to_string(limit) + " leaves no rows");
+    std::vector<TraceRow> rows;
+    rows.reserve(raw.size());
+    for (const RawRow& r : raw) rows.push_back({(r.time - raw.front().time) * scale_time, r.bucket});
+    return rows;
+}
+
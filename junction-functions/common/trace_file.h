@@ -0,0 +1,33 @@
+#ifndef TRACE_FILE_H
+#define TRACE_FILE_H
+
+// Invocation traces as data/preprocess_trace.py writes them, for the replay and
+// simulation tools.
+//
+// CSV with TIMESTAMP or ts_seconds, plus token_bucket (or bucket) or
+// ContextTokens; export the parquet trace with pandas.to_csv. JSONL (.jsonl/.json)
+// with the same fields also works. Rows are sorted by time and made relative to
+// the earliest one.
+
+#include <string>
+#include <vector>
+
+struct TraceRow {
+    double ts_seconds = 0.0;
+    std::string bucket;
+};
+
+// Same bins as data/preprocess_trace.py: (0,256], (256,1000], (1000,4000], (4000,8000].
+std::string bucket_for_tokens(double tokens);
+
+// "2024-05-12 00:00:00.001163+00:00" (or with 'T' / 'Z') to seconds since the epoch.
+double parse_timestamp(const std::string& text);
+
+std::vector<std::string> split_csv_line(const std::string& line);
+
+// Inter-arrival times are multiplied by `scale_time`; `limit` >= 0 keeps only the
+// first rows. Throws on a missing, empty or malformed trace, or when `limit`
+// leaves no rows: callers may rely on a non-empty result.
+std::vector<TraceRow> load_trace(const std::string& path, double scale_time = 1.0, long limit = -1);
+
+#endif // TRACE_FILE_H
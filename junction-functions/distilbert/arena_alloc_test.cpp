@@ -0,0 +1,104 @@
+// Checks that InferArena prepare()/run()/probs() does no heap allocation of its
+// own once warmed up. Only the arena is measured: the HTTP handler around it
+// (json::parse, the response) is not, and does allocate. Needs a model:
+//
+//   DISTILBERT_ONNX=/path/to/distilbert.onnx ./distilbert_arena_alloc_test
+//
+// ORT itself still allocates a little inside every Run (execution frame
+// bookkeeping), so the arena path is compared against a bare Run of an
+// IoBinding prepared up front, which is the floor no caller can go below.
+#include <onnxruntime_cxx_api.h>
+
+#include "infer_arena.h"
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <vector>
+
+namespace {
+std::atomic<long> g_allocs{0};
+}  // namespace
+
+void* operator new(size_t size) {
+    g_allocs.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+
+namespace {
+template <typename F>
+long count_allocs(F&& f) {
+    long before = g_allocs.load();
+    f();
+    return g_allocs.load() - before;
+}
+
+// Lowest allocation count ORT itself reaches for one bound Run of `len` tokens.
+long bare_run_allocs(Ort::Session& session, int64_t len, int64_t num_classes) {
+    auto mem = Ort::MemoryInfo::CreateCpu(OrtDeviceAllocator, OrtMemTypeCPU);
+    std::vector<int64_t> ids(len, 0), mask(len, 1);
+    std::vector<float> logits(num_classes);
+    std::array<int64_t, 2> in_shape{1, len}, out_shape{1, num_classes};
+    Ort::IoBinding binding(session);
+    binding.BindInput("input_ids", Ort::Value::CreateTensor<int64_t>(mem, ids.data(), ids.size(), in_shape.data(), 2));
+    binding.BindInput("attention_mask", Ort::Value::CreateTensor<int64_t>(mem, mask.data(), mask.size(), in_shape.data(), 2));
+    binding.BindOutput("logits", Ort::Value::CreateTensor<float>(mem, logits.data(), logits.size(), out_shape.data(), 2));
+    Ort::RunOptions opts;
+    session.Run(opts, binding);
+    long best = -1;
+    for (int i = 0; i < 5; ++i) {
+        long n = count_allocs([&] { session.Run(opts, binding); });
+        if (best < 0 || n < best) best = n;
+    }
+    return best;
+}
+}  // namespace
+
+int main() {
+    const char* model = std::getenv("DISTILBERT_ONNX");
+    if (!model) {
+        std::cout << "SKIP: set DISTILBERT_ONNX to a distilbert.onnx export\n";
+        return 77;
+    }
+
+    Ort::Env env(ORT_LOGGING_LEVEL_WARNING, "arena_alloc_test");
+    Ort::SessionOptions opts;
+    opts.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_ENABLE_ALL);
+    Ort::Session session(env, model, opts);
+
+    InferArena arena(session);
+    arena.warm_up();
+
+    int failures = 0;
+    for (int64_t bucket : arena.buckets()) {
+        // A length that pads up into this bucket, so the zero-fill path runs too.
+        const int64_t len = bucket - bucket / 4;
+        const long floor = bare_run_allocs(session, bucket, arena.num_classes());
+        long best = -1;
+        for (int i = 0; i < 5; ++i) {
+            long n = count_allocs([&] {
+                InferArena::Inputs in = arena.prepare(len);
+                for (int64_t t = 0; t < len; ++t) {
+                    in.ids[t] = 101 + t;
+                    in.mask[t] = 1;
+                }
+                arena.run();
+                (void)arena.probs();
+            });
+            if (best < 0 || n < best) best = n;
+        }
+        const bool ok = best <= floor;
+        failures += ok ? 0 : 1;
+        std::cout << (ok ? "ok   " : "FAIL ") << "bucket " << bucket << ": " << best
+                  << " allocations per request (bare ORT Run: " << floor << ")\n";
+    }
+    return failures ? 1 : 0;
+}
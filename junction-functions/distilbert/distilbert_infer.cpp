@@ -1,6 +1,12 @@
 // distilbert_infer.cpp
 #include <onnxruntime_cxx_api.h>
 
+#include "../common/phase_markers.h"
+#include "../common/request_trace.h"
+#include "../common/shared_model.h"
+#include "infer_arena.h"
+#include "sliding_window.h"
+
 #include <iostream>
 #include <array>
 #include <vector>
@@ -61,6 +67,7 @@ std::vector<int64_t> parse_ids(const std::string& text) {
 }
 
 int main(int argc, char* argv[]) {
+    phase_mark("static_init");
     // Parse args while allowing an optional --json flag.
     bool json_output = false;
     std::vector<std::string> positional;
@@ -74,10 +81,16 @@ int main(int argc, char* argv[]) {
         }
         positional.push_back(std::move(arg));
     }
+    // The gateway's cold path passes the request's trace in $TRACEPARENT.
+    tracing::start("distilbert_infer");
+    struct StopTracing {
+        ~StopTracing() { tracing::stop(); }
+    } stop_tracing;
+    tracing::Span main_span("function.main", tracing::context_from_env());
 
     if (positional.size() != 3) {
         std::cerr << "Usage: " << argv[0]
-                  << " /path/to/distilbert.onnx \"input_ids...\" \"attention_mask...\" [--json]\n"
+                  << " /path/to/distilbert.{onnx,ort} \"input_ids...\" \"attention_mask...\" [--json]\n"
                   << "Example: " << argv[0]
                   << " ./distilbert.onnx \"101 2023 3185 2001 2307 102\" \"1 1 1 1 1 1\" --json\n";
         return 1;
@@ -92,11 +105,15 @@ int main(int argc, char* argv[]) {
         Ort::Env env(ORT_LOGGING_LEVEL_WARNING, "distilbert_infer");
         Ort::SessionOptions session_options;
         session_options.SetIntraOpNumThreads(1);
-        session_options.SetGraphOptimizationLevel(
-            GraphOptimizationLevel::ORT_ENABLE_ALL);
-
-        // 2. Create session
-        Ort::Session session(env, model_path.c_str(), session_options);
+        phase_mark("env");
+        // 2. Create session over a shared mapping of the model (or JunctionD's
+        // memfd). A model_compile artifact (.ort) loads unoptimized with its weights
+        // left in the mapping, so concurrent instances share one physical copy.
+        tracing::Span session_span("function.session", main_span.context());
+        auto model = SharedModel::open(model_path);
+        Ort::Session session = create_shared_session(env, *model, session_options);
+        session_span.end();
+        phase_mark("session");
 
         // 3. Describe input
         Ort::AllocatorWithDefaultOptions allocator;
@@ -133,13 +150,28 @@ int main(int argc, char* argv[]) {
             throw std::runtime_error("input_ids and attention_mask length mismatch");
         }
 
-        const int64_t seq_len = static_cast<int64_t>(input_ids.size());
-        if (seq_len == 0) {
+        if (input_ids.empty()) {
             throw std::runtime_error("Empty input provided");
         }
+        // Drop trailing padding; the logits do not depend on it.
+        const int64_t seq_len = trim_padding(attention_mask.data(), static_cast<int64_t>(attention_mask.size()));
+        input_ids.resize(seq_len);
+        attention_mask.resize(seq_len);
+
+        // Past DistilBERT's 512 positions, run overlapping windows as one batch and
+        // average their logits (see sliding_window.h).
+        WindowConfig window_cfg;
+        WindowBatch windows;
+        windows.windows = 1;
+        windows.length = seq_len;
+        if (seq_len > window_cfg.window) {
+            plan_windows(input_ids.data(), attention_mask.data(), seq_len, window_cfg, windows);
+            input_ids = windows.ids;
+            attention_mask = windows.mask;
+        }
 
         // 4. Create input tensors
-        std::array<int64_t, 2> input_shape{1, seq_len};  // batch_size=1
+        std::array<int64_t, 2> input_shape{windows.windows, windows.length};
 
         Ort::MemoryInfo memory_info = Ort::MemoryInfo::CreateCpu(
             OrtDeviceAllocator, OrtMemTypeCPU);
@@ -166,6 +198,7 @@ int main(int argc, char* argv[]) {
         };
 
         // 5. Run inference
+        tracing::Span run_span("session.run", main_span.context());
         auto output_tensors = session.Run(
             Ort::RunOptions{nullptr},
             input_names.data(),
@@ -175,6 +208,8 @@ int main(int argc, char* argv[]) {
             output_names.size()
         );
 
+        run_span.end();
+        phase_mark("run");
         if (output_tensors.size() != 1) {
             throw std::runtime_error("Expected a single output tensor");
         }
@@ -186,15 +221,13 @@ int main(int argc, char* argv[]) {
         auto type_info = logits_tensor.GetTensorTypeAndShapeInfo();
         auto output_shape = type_info.GetShape();
 
-        if (output_shape.size() != 2 || output_shape[0] != 1) {
+        if (output_shape.size() != 2 || output_shape[0] != windows.windows) {
             throw std::runtime_error("Unexpected logits shape");
         }
 
         int64_t num_classes = output_shape[1];
         std::vector<float> logits(num_classes);
-        for (int64_t i = 0; i < num_classes; ++i) {
-            logits[i] = logits_data[i];
-        }
+        pool_window_logits(logits_data, num_classes, windows, window_cfg.pooling, logits.data());
 
         std::vector<float> probs = softmax(logits);
         std::string label = label_from_logits(logits);
@@ -220,6 +253,8 @@ int main(int argc, char* argv[]) {
             for (float p : probs) std::cout << p << " ";
             std::cout << "\nPredicted label: " << label << "\n";
         }
+        std::cout.flush();
+        phase_mark("output");
 
         // Free the names we allocated
         for (auto name : input_names) {
@@ -2,14 +2,23 @@
 
 #include "../junctiond/httplib.h"
 #include "../junctiond/json.hpp"
+#include "../junctiond/metrics.h"
+#include "worker_pool.h"
+#include "../common/model_registry.h"
+#include "../common/phase_markers.h"
+#include "../common/request_trace.h"
+#include "../common/sampling.h"
 
-#include <array>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
 #include <iostream>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <vector>
-#include <algorithm>
-#include <cmath>
 
 using json = nlohmann::json;
 
@@ -18,8 +27,27 @@ struct Config {
     std::string model_path;
     std::string host = "0.0.0.0";
     int port = 9000;
+    // With --registry, model_path comes from the registry entry for model/variant.
+    std::string registry_path;
+    std::string model_name = "distilbert";
+    std::string variant;  // empty: the registry's default
+    WorkerPoolConfig pool;
+    WindowConfig window;  // inputs longer than the largest bucket
+    OpProfileConfig profile;
+    double profile_rate = 0.0;  // fraction of requests ORT-profiled from startup
 };
 
+std::vector<int64_t> parse_int_list(const std::string& text, const std::string& flag) {
+    std::vector<int64_t> out;
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) out.push_back(std::stoll(item));
+    }
+    if (out.empty()) throw std::runtime_error(flag + " needs a comma separated list of integers");
+    return out;
+}
+
 Config parse_args(int argc, char* argv[]) {
     Config cfg;
     for (int i = 1; i < argc; ++i) {
@@ -30,77 +58,206 @@ Config parse_args(int argc, char* argv[]) {
             cfg.host = argv[++i];
         } else if ((arg == "--port" || arg == "-p") && i + 1 < argc) {
             cfg.port = std::stoi(argv[++i]);
+        } else if (arg == "--registry" && i + 1 < argc) {
+            cfg.registry_path = argv[++i];
+        } else if (arg == "--model" && i + 1 < argc) {
+            cfg.model_name = argv[++i];
+        } else if (arg == "--variant" && i + 1 < argc) {
+            cfg.variant = argv[++i];
+        } else if (arg == "--buckets" && i + 1 < argc) {
+            cfg.pool.buckets = parse_int_list(argv[++i], arg);
+        } else if (arg == "--warmup" && i + 1 < argc) {
+            cfg.pool.warmup.lengths = parse_warmup_lengths(argv[++i]);
+        } else if (arg == "--warmup-batches" && i + 1 < argc) {
+            cfg.pool.warmup.batch_sizes = parse_int_list(argv[++i], arg);
+        } else if (arg == "--warmup-iters" && i + 1 < argc) {
+            cfg.pool.warmup.iterations = std::stoi(argv[++i]);
+        } else if (arg == "--workers" && i + 1 < argc) {
+            cfg.pool.workers = std::stoi(argv[++i]);
+        } else if (arg == "--intra-op-threads" && i + 1 < argc) {
+            cfg.pool.intra_op_threads = std::stoi(argv[++i]);
+        } else if (arg == "--first-core" && i + 1 < argc) {
+            cfg.pool.first_core = std::stoi(argv[++i]);
+        } else if (arg == "--max-queue" && i + 1 < argc) {
+            cfg.pool.max_queue = std::stoul(argv[++i]);
+        } else if (arg == "--no-pin") {
+            cfg.pool.pin = false;
+        } else if (arg == "--no-prepack") {
+            cfg.pool.prepack = false;
+        } else if (arg == "--window" && i + 1 < argc) {
+            cfg.window.window = std::stoll(argv[++i]);
+        } else if (arg == "--window-stride" && i + 1 < argc) {
+            cfg.window.stride = std::stoll(argv[++i]);
+        } else if (arg == "--window-pooling" && i + 1 < argc) {
+            cfg.window.pooling = parse_window_pooling(argv[++i]);
+        } else if (arg == "--max-windows" && i + 1 < argc) {
+            cfg.window.max_windows = std::stoll(argv[++i]);
+        } else if (arg == "--window-threads" && i + 1 < argc) {
+            cfg.pool.window_threads = std::stoi(argv[++i]);
+        } else if (arg == "--no-long-inputs") {
+            cfg.pool.long_inputs = false;
+        } else if (arg == "--profile-rate" && i + 1 < argc) {
+            cfg.profile_rate = std::stod(argv[++i]);
+        } else if (arg == "--profile-dir" && i + 1 < argc) {
+            cfg.profile.dir = argv[++i];
+        } else if (arg == "--profile-runs" && i + 1 < argc) {
+            cfg.profile.runs_per_file = std::stoi(argv[++i]);
         } else {
             throw std::runtime_error("Unknown or incomplete argument: " + arg);
         }
     }
+    if (!cfg.registry_path.empty()) {
+        ModelVariant v = ModelRegistry(cfg.registry_path).resolve(cfg.model_name, cfg.variant);
+        cfg.model_path = v.path;
+        cfg.variant = v.name;
+    }
     if (cfg.model_path.empty()) {
-        throw std::runtime_error("--model-path is required");
+        throw std::runtime_error("--model-path or --registry is required");
     }
+    validate_window_config(cfg.window);
     return cfg;
 }
 
-std::vector<float> softmax(const std::vector<float>& logits) {
-    if (logits.empty()) return {};
-    float max_logit = *std::max_element(logits.begin(), logits.end());
-    std::vector<float> exps(logits.size());
-    float sum = 0.0f;
-    for (size_t i = 0; i < logits.size(); ++i) {
-        exps[i] = std::exp(logits[i] - max_logit);
-        sum += exps[i];
+// Token counts before and after trimming and bucketing. Attention cost grows
+// with the square of the length, so the *_sq sums estimate the compute saved.
+// A windowed request counts `windows` rows of `bucket` tokens.
+struct PaddingStats {
+    std::atomic<uint64_t> requests{0}, windowed_requests{0}, windows{0};
+    std::atomic<uint64_t> received_tokens{0}, effective_tokens{0}, bucket_tokens{0};
+    std::atomic<uint64_t> received_sq{0}, bucket_sq{0};
+
+    void record(int64_t received, int64_t effective, int64_t bucket, int64_t rows = 1) {
+        requests.fetch_add(1, std::memory_order_relaxed);
+        if (rows > 1) {
+            windowed_requests.fetch_add(1, std::memory_order_relaxed);
+            windows.fetch_add(rows, std::memory_order_relaxed);
+        }
+        received_tokens.fetch_add(received, std::memory_order_relaxed);
+        effective_tokens.fetch_add(effective, std::memory_order_relaxed);
+        bucket_tokens.fetch_add(rows * bucket, std::memory_order_relaxed);
+        received_sq.fetch_add(received * received, std::memory_order_relaxed);
+        bucket_sq.fetch_add(rows * bucket * bucket, std::memory_order_relaxed);
     }
-    for (float& v : exps) v /= sum;
-    return exps;
-}
 
-std::string label_from_logits(const std::vector<float>& logits) {
-    if (logits.size() != 2) return "unknown";
+    json to_json() const {
+        const uint64_t rsq = received_sq.load();
+        return {{"requests", requests.load()},
+                {"windowed_requests", windowed_requests.load()},
+                {"windows", windows.load()},
+                {"received_tokens", received_tokens.load()},
+                {"effective_tokens", effective_tokens.load()},
+                {"bucket_tokens", bucket_tokens.load()},
+                {"attention_cost_ratio", rsq ? double(bucket_sq.load()) / rsq : 1.0}};
+    }
+};
+
+const char* label_from_logits(const float* logits, int64_t n) {
+    if (n != 2) return "unknown";
     return logits[1] > logits[0] ? "positive" : "negative";
 }
+
+// Writes {"logits":[...],"probs":[...],"label":"..."} into buf, plus "windows"
+// when the input was split; returns its length, or 0 if it does not fit in cap.
+size_t format_response(char* buf, size_t cap, const float* logits, const float* probs, int64_t n,
+                       int64_t windows = 1) {
+    size_t len = 0;
+    bool fits = true;
+    auto put = [&](const char* fmt, auto... args) {
+        if (!fits) return;
+        int w = std::snprintf(buf + len, cap - len, fmt, args...);
+        if (w < 0 || static_cast<size_t>(w) >= cap - len) fits = false;
+        else len += static_cast<size_t>(w);
+    };
+    put("{\"logits\":[");
+    for (int64_t i = 0; i < n; ++i) put(i ? ",%.9g" : "%.9g", logits[i]);
+    put("],\"probs\":[");
+    for (int64_t i = 0; i < n; ++i) put(i ? ",%.9g" : "%.9g", probs[i]);
+    put("],\"label\":\"%s\"", label_from_logits(logits, n));
+    if (windows > 1) put(",\"windows\":%lld", static_cast<long long>(windows));
+    put("}");
+    return fits ? len : 0;
+}
+
+// The same response through nlohmann, for outputs too large for
+// format_response's buffer (models with many classes). Allocates.
+std::string response_json(const float* logits, const float* probs, int64_t n, int64_t windows = 1) {
+    json out{{"logits", std::vector<float>(logits, logits + n)},
+             {"probs", std::vector<float>(probs, probs + n)},
+             {"label", label_from_logits(logits, n)}};
+    if (windows > 1) out["windows"] = windows;
+    return out.dump();
+}
 }  // namespace
 
 int main(int argc, char* argv[]) {
+    phase_mark("static_init");
+    const auto process_start = std::chrono::steady_clock::now();
     Config cfg;
     try {
         cfg = parse_args(argc, argv);
     } catch (const std::exception& e) {
         std::cerr << "Usage: " << argv[0]
-                  << " --model-path /path/to/distilbert.onnx [--host 0.0.0.0] [--port 9000]\n"
+                  << " (--model-path /path/to/distilbert.onnx | --registry registry.json [--model distilbert]"
+                  << " [--variant int8]) [--host 0.0.0.0] [--port 9000]"
+                  << " [--buckets 32,64,128,256,512] [--workers N] [--intra-op-threads N]"
+                  << " [--first-core N] [--max-queue N] [--no-pin] [--no-prepack]"
+                  << " [--warmup small,medium,large,xl|none] [--warmup-batches 1] [--warmup-iters 2]"
+                  << " [--window 512] [--window-stride 384] [--window-pooling mean|max|weighted|first]"
+                  << " [--max-windows 32] [--window-threads N] [--no-long-inputs]"
+                  << " [--profile-rate 0] [--profile-dir /tmp] [--profile-runs 16]\n"
                   << "Error: " << e.what() << "\n";
         return 1;
     }
 
     try {
+        // Spans go to $JUNCTION_TRACE_FILE when the gateway set it.
+        tracing::start("distilbert_service");
         Ort::Env env(ORT_LOGGING_LEVEL_WARNING, "distilbert_service");
-        Ort::SessionOptions session_options;
-        session_options.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_ENABLE_ALL);
-        Ort::Session session(env, cfg.model_path.c_str(), session_options);
-        Ort::AllocatorWithDefaultOptions allocator;
-
-        std::vector<std::string> input_name_storage;
-        std::vector<const char*> input_name_ptrs;
-        size_t num_inputs = session.GetInputCount();
-        input_name_storage.reserve(num_inputs);
-        input_name_ptrs.reserve(num_inputs);
-        for (size_t i = 0; i < num_inputs; ++i) {
-            auto name = session.GetInputNameAllocated(i, allocator);
-            input_name_storage.emplace_back(name.get());
-            input_name_ptrs.push_back(input_name_storage.back().c_str());
+        phase_mark("env");
+        // ORT operator profiling of sampled requests, adjusted at run time via /profile.
+        OpProfiler profiler("distilbert_service", cfg.profile);
+        profiler.set_rate(cfg.profile_rate);
+        cfg.pool.profiler = &profiler;
+        // Sessions are built, pinned and warmed inside the pool, so a model that does
+        // not fit the buckets fails here rather than on the first request, and the
+        // first real request of each warmed shape runs at steady-state speed.
+        WorkerPool pool(env, cfg.model_path, cfg.pool);
+        phase_mark("workers");  // sessions and warm-up, in parallel; COLD_START splits them
+        const PoolStartup& startup = pool.startup();
+        PaddingStats padding;
+        if (pool.long_inputs() && cfg.window.window > pool.max_length()) {
+            throw std::runtime_error("--window " + std::to_string(cfg.window.window) +
+                                     " is longer than the largest bucket");
         }
+        const double startup_ms =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - process_start).count();
+        std::cout << "distilbert_service: " << cfg.model_path
+                  << (cfg.variant.empty() ? "" : " (" + cfg.variant + ")") << ", " << pool.workers() << " workers x "
+                  << std::max(1, cfg.pool.intra_op_threads) << " intra-op threads"
+                  << (cfg.pool.pin ? ", pinned from core " + std::to_string(cfg.pool.first_core) : "")
+                  << "\n";
 
-        std::vector<std::string> output_name_storage;
-        std::vector<const char*> output_name_ptrs;
-        size_t num_outputs = session.GetOutputCount();
-        output_name_storage.reserve(num_outputs);
-        output_name_ptrs.reserve(num_outputs);
-        for (size_t i = 0; i < num_outputs; ++i) {
-            auto name = session.GetOutputNameAllocated(i, allocator);
-            output_name_storage.emplace_back(name.get());
-            output_name_ptrs.push_back(output_name_storage.back().c_str());
-        }
+        // /metrics: request counts, in-flight and latency here; queue wait and
+        // per-bucket session.Run time are recorded by the workers.
+        metrics::Registry& registry = metrics::Registry::global();
+        metrics::RequestMetrics request_metrics(registry, "distilbert");
+        metrics::Counter& rejected =
+            registry.counter("distilbert_queue_rejections_total", "Requests shed because the queue was full");
+        metrics::Histogram& window_seconds = registry.histogram(
+            "distilbert_inference_seconds", "session.Run time per request, by padded length bucket",
+            {{"bucket", "windows"}});
+        registry.gaugeCallback("distilbert_queue_depth", "Requests waiting for a worker", {},
+                               [&pool] { return static_cast<double>(pool.queue_depth()); });
 
         httplib::Server svr;
+        // HTTP threads only parse and wait; keep enough of them to keep the queue fed.
+        const size_t http_threads = std::max<size_t>(8, 2 * static_cast<size_t>(pool.workers()));
+        svr.new_task_queue = [http_threads] { return new httplib::ThreadPool(http_threads); };
         svr.Post("/infer", [&](const httplib::Request& req, httplib::Response& res) {
+            metrics::RequestMetrics::Scope measured(request_metrics, res.status);
+            tracing::TraceContext incoming;
+            tracing::parse_traceparent(req.get_header_value(tracing::kTraceHeader), incoming);
+            tracing::Span span("service.infer", incoming);
             try {
                 auto body = json::parse(req.body);
                 if (!body.contains("input_ids") || !body.contains("attention_mask")) {
@@ -121,59 +278,85 @@ int main(int argc, char* argv[]) {
                     return;
                 }
 
-                std::vector<int64_t> input_ids;
-                std::vector<int64_t> attention_mask;
-                input_ids.reserve(ids_j.size());
-                attention_mask.reserve(mask_j.size());
-                for (size_t i = 0; i < ids_j.size(); ++i) {
-                    input_ids.push_back(ids_j.at(i).get<int64_t>());
-                    attention_mask.push_back(mask_j.at(i).get<int64_t>());
-                }
+                // Per-thread staging buffers: the worker copies out of and back into these.
+                thread_local std::vector<int64_t> ids, mask;
+                thread_local std::vector<float> logits, probs;
+                const int64_t received = static_cast<int64_t>(mask_j.size());
+                mask.resize(received);
+                for (int64_t i = 0; i < received; ++i) mask[i] = mask_j[i].get<int64_t>();
 
-                const int64_t seq_len = static_cast<int64_t>(input_ids.size());
-                std::array<int64_t, 2> input_shape{1, seq_len};
-                Ort::MemoryInfo mem_info = Ort::MemoryInfo::CreateCpu(OrtDeviceAllocator, OrtMemTypeCPU);
-                Ort::Value ids_tensor = Ort::Value::CreateTensor<int64_t>(
-                    mem_info, input_ids.data(), input_ids.size(), input_shape.data(), input_shape.size());
-                Ort::Value mask_tensor = Ort::Value::CreateTensor<int64_t>(
-                    mem_info, attention_mask.data(), attention_mask.size(), input_shape.data(), input_shape.size());
-
-                std::array<Ort::Value, 2> input_tensors{
-                    std::move(ids_tensor),
-                    std::move(mask_tensor)
-                };
-
-                auto outputs = session.Run(
-                    Ort::RunOptions{nullptr},
-                    input_name_ptrs.data(),
-                    input_tensors.data(),
-                    input_tensors.size(),
-                    output_name_ptrs.data(),
-                    output_name_ptrs.size());
-
-                if (outputs.empty()) {
-                    throw std::runtime_error("No outputs returned from model");
+                // Clients (and the OpenFaaS handler) pad to max_length; only the
+                // unpadded prefix is run, padded up to the nearest length bucket.
+                const int64_t seq_len = trim_padding(mask.data(), received);
+                if (seq_len > pool.max_length() && !pool.long_inputs()) {
+                    res.status = 400;
+                    res.set_content("{\"error\":\"input longer than the largest length bucket\"}", "application/json");
+                    return;
                 }
+                ids.resize(seq_len);
+                for (int64_t i = 0; i < seq_len; ++i) ids[i] = ids_j[i].get<int64_t>();
+                logits.resize(pool.num_classes());
+                probs.resize(pool.num_classes());
 
-                auto& logits_tensor = outputs.front();
-                float* logits_data = logits_tensor.GetTensorMutableData<float>();
-                auto type_info = logits_tensor.GetTensorTypeAndShapeInfo();
-                auto shape = type_info.GetShape();
-                if (shape.size() != 2 || shape[0] != 1) {
-                    throw std::runtime_error("Unexpected logits shape");
-                }
+                if (seq_len > pool.max_length()) {
+                    // Too long for one pass: overlapping windows, all run in one batched call.
+                    thread_local WindowBatch batch;
+                    thread_local std::vector<float> window_logits;
+                    try {
+                        plan_windows(ids.data(), mask.data(), seq_len, cfg.window, batch);
+                    } catch (const std::exception& e) {
+                        res.status = 400;
+                        json err{{"error", e.what()}};
+                        res.set_content(err.dump(), "application/json");
+                        return;
+                    }
+                    window_logits.resize(static_cast<size_t>(batch.windows * pool.num_classes()));
+                    tracing::Span run_span("session.run_windows", span.context());
+                    const auto run_start = std::chrono::steady_clock::now();
+                    pool.run_windows(batch, window_logits.data());
+                    window_seconds.observe(
+                        std::chrono::duration<double>(std::chrono::steady_clock::now() - run_start).count());
+                    run_span.end();
+                    pool_window_logits(window_logits.data(), pool.num_classes(), batch, cfg.window.pooling,
+                                       logits.data());
+                    sampling::softmax(logits.data(), pool.num_classes(), 1.0f, probs.data());
+                    padding.record(received, seq_len, batch.length, batch.windows);
 
-                int64_t num_classes = shape[1];
-                std::vector<float> logits(num_classes);
-                for (int64_t i = 0; i < num_classes; ++i) {
-                    logits[i] = logits_data[i];
+                    thread_local char out[512];
+                    size_t n = format_response(out, sizeof(out), logits.data(), probs.data(), pool.num_classes(),
+                                               batch.windows);
+                    if (n) res.set_content(out, n, "application/json");
+                    else res.set_content(response_json(logits.data(), probs.data(), pool.num_classes(), batch.windows),
+                                         "application/json");
+                    return;
                 }
+                padding.record(received, seq_len, pool.bucket_for(seq_len));
 
-                std::vector<float> probs = softmax(logits);
-                std::string label = label_from_logits(logits);
+                InferJob job;
+                job.ids = ids.data();
+                job.mask = mask.data();
+                job.len = seq_len;
+                job.logits = logits.data();
+                job.probs = probs.data();
+                job.trace = span.context();
+                job.profile = profiler.sample(req.get_header_value(kOrtProfileHeader));
+                try {
+                    pool.run(job);
+                } catch (const std::exception& e) {
+                    if (!job.done) {
+                        // Never reached a worker: shed load instead of queueing without bound.
+                        rejected.inc();
+                        res.status = 503;
+                        res.set_content("{\"error\":\"inference queue is full\"}", "application/json");
+                        return;
+                    }
+                    throw;
+                }
 
-                json resp{{"logits", logits}, {"probs", probs}, {"label", label}};
-                res.set_content(resp.dump(), "application/json");
+                thread_local char out[512];
+                size_t n = format_response(out, sizeof(out), logits.data(), probs.data(), pool.num_classes());
+                if (n) res.set_content(out, n, "application/json");
+                else res.set_content(response_json(logits.data(), probs.data(), pool.num_classes()), "application/json");
             } catch (const std::exception& e) {
                 res.status = 500;
                 json err{{"error", e.what()}};
@@ -181,8 +364,66 @@ int main(int argc, char* argv[]) {
             }
         });
 
+        svr.Get("/metrics", [&](const httplib::Request&, httplib::Response& res) {
+            res.set_content(registry.expose(), metrics::kContentType);
+        });
+
+        // Per-operator hotspots of the profiled requests (windowed ones are not
+        // profiled). GET ?top=N reports, POST ?rate=R sets the sampled fraction,
+        // DELETE clears the totals.
+        svr.Get("/profile", [&](const httplib::Request& req, httplib::Response& res) {
+            size_t top = 20;
+            if (req.has_param("top")) top = std::strtoul(req.get_param_value("top").c_str(), nullptr, 10);
+            res.set_content(profiler.report(top), "application/json");
+        });
+        svr.Post("/profile", [&](const httplib::Request& req, httplib::Response& res) {
+            try {
+                profiler.set_rate(std::stod(req.get_param_value("rate")));
+            } catch (const std::exception&) {
+                res.status = 400;
+                res.set_content("{\"error\":\"rate must be a number between 0 and 1\"}", "application/json");
+                return;
+            }
+            json out{{"rate", profiler.rate()}};
+            res.set_content(out.dump(), "application/json");
+        });
+        svr.Delete("/profile", [&](const httplib::Request&, httplib::Response& res) {
+            profiler.reset();
+            res.set_content("{}", "application/json");
+        });
+
+        svr.Get("/stats", [&](const httplib::Request&, httplib::Response& res) {
+            json stats{{"variant", cfg.variant},
+                       {"cold_start", {{"startup_ms", startup_ms},
+                                       {"load_ms", startup.load_ms},
+                                       {"warmup_ms", startup.warmup_ms},
+                                       {"warmup_runs", startup.warmup_runs},
+                                       {"slowest_warmup_run_ms", startup.slowest_warmup_run_ms}}},
+                       {"padding", padding.to_json()},
+                       {"long_inputs", {{"enabled", pool.long_inputs()},
+                                        {"window", cfg.window.window},
+                                        {"stride", cfg.window.stride},
+                                        {"max_windows", cfg.window.max_windows},
+                                        {"pooling", window_pooling_name(cfg.window.pooling)}}},
+                       {"workers", pool.workers()},
+                       {"intra_op_threads", std::max(1, cfg.pool.intra_op_threads)},
+                       {"pinned", cfg.pool.pin},
+                       {"queue_depth", pool.queue_depth()},
+                       {"completed_per_worker", pool.completed_per_worker()}};
+            res.set_content(stats.dump(), "application/json");
+        });
+
+        if (!svr.bind_to_port(cfg.host, cfg.port)) {
+            throw std::runtime_error("cannot bind " + cfg.host + ":" + std::to_string(cfg.port));
+        }
+        phase_mark("bind");
+        // JunctionD times cold starts up to READY; the line after breaks that down.
+        std::cout << "READY" << std::endl;
+        phase_mark("ready");
+        std::cout << "COLD_START startup_ms=" << startup_ms << " load_ms=" << startup.load_ms
+                  << " warmup_ms=" << startup.warmup_ms << " warmup_runs=" << startup.warmup_runs << std::endl;
         std::cout << "distilbert_service listening on " << cfg.host << ":" << cfg.port << "\n";
-        svr.listen(cfg.host, cfg.port);
+        svr.listen_after_bind();
     } catch (const std::exception& e) {
         std::cerr << "Fatal error: " << e.what() << "\n";
         return 1;
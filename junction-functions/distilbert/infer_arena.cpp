@@ -0,0 +1,104 @@
+#include "infer_arena.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+const std::vector<int64_t>& default_length_buckets() {
+    static const std::vector<int64_t> buckets{32, 64, 128, 256, 512};
+    return buckets;
+}
+
+struct InferArena::Bucket {
+    int64_t len;
+    std::vector<int64_t> ids;
+    std::vector<int64_t> mask;
+    std::vector<float> logits;
+    std::vector<Ort::Value> bound;  // keeps the bound tensors alive with the binding
+    Ort::IoBinding binding;
+
+    Bucket(Ort::Session& session, const Ort::MemoryInfo& mem, int64_t len, int64_t num_classes)
+        : len(len), ids(len, 0), mask(len, 0), logits(num_classes, 0.0f), binding(session) {
+        std::array<int64_t, 2> input_shape{1, len};
+        std::array<int64_t, 2> output_shape{1, num_classes};
+        bound.push_back(Ort::Value::CreateTensor<int64_t>(
+            mem, ids.data(), ids.size(), input_shape.data(), input_shape.size()));
+        bound.push_back(Ort::Value::CreateTensor<int64_t>(
+            mem, mask.data(), mask.size(), input_shape.data(), input_shape.size()));
+        bound.push_back(Ort::Value::CreateTensor<float>(
+            mem, logits.data(), logits.size(), output_shape.data(), output_shape.size()));
+        binding.BindInput("input_ids", bound[0]);
+        binding.BindInput("attention_mask", bound[1]);
+        binding.BindOutput("logits", bound[2]);
+    }
+};
+
+namespace {
+int64_t discover_num_classes(Ort::Session& session) {
+    Ort::AllocatorWithDefaultOptions allocator;
+    for (size_t i = 0; i < session.GetOutputCount(); ++i) {
+        if (std::string(session.GetOutputNameAllocated(i, allocator).get()) != "logits") continue;
+        auto shape = session.GetOutputTypeInfo(i).GetTensorTypeAndShapeInfo().GetShape();
+        if (shape.size() == 2 && shape[1] > 0) return shape[1];
+        throw std::runtime_error("Unexpected logits shape");
+    }
+    throw std::runtime_error("Model has no logits output");
+}
+}  // namespace
+
+InferArena::InferArena(Ort::Session& session, std::vector<int64_t> buckets)
+    : session_(session),
+      mem_(Ort::MemoryInfo::CreateCpu(OrtDeviceAllocator, OrtMemTypeCPU)),
+      buckets_(std::move(buckets)),
+      num_classes_(discover_num_classes(session)),
+      probs_(num_classes_, 0.0f) {
+    std::sort(buckets_.begin(), buckets_.end());
+    buckets_.erase(std::unique(buckets_.begin(), buckets_.end()), buckets_.end());
+    if (buckets_.empty() || buckets_.front() <= 0) {
+        throw std::runtime_error("InferArena needs positive length buckets");
+    }
+    for (int64_t len : buckets_) {
+        slots_.push_back(std::make_unique<Bucket>(session_, mem_, len, num_classes_));
+    }
+}
+
+InferArena::~InferArena() = default;
+
+InferArena::Inputs InferArena::prepare(int64_t len) {
+    if (len <= 0 || len > buckets_.back()) {
+        throw std::runtime_error("sequence length " + std::to_string(len) + " outside 1.." +
+                                 std::to_string(buckets_.back()));
+    }
+    auto it = std::lower_bound(buckets_.begin(), buckets_.end(), len);
+    current_ = slots_[it - buckets_.begin()].get();
+    std::fill(current_->ids.begin() + len, current_->ids.end(), 0);
+    std::fill(current_->mask.begin() + len, current_->mask.end(), 0);
+    return {current_->ids.data(), current_->mask.data()};
+}
+
+const float* InferArena::run() {
+    if (!current_) throw std::runtime_error("InferArena::run before prepare");
+    session_.Run(run_options_, current_->binding);
+
+    const float* logits = current_->logits.data();
+    const float max_logit = *std::max_element(logits, logits + num_classes_);
+    float sum = 0.0f;
+    for (int64_t i = 0; i < num_classes_; ++i) {
+        probs_[i] = std::exp(logits[i] - max_logit);
+        sum += probs_[i];
+    }
+    for (float& p : probs_) p /= sum;
+    return logits;
+}
+
+void InferArena::warm_up() {
+    for (int64_t len : buckets_) {
+        Inputs in = prepare(len);
+        std::fill(in.ids, in.ids + len, 0);
+        std::fill(in.mask, in.mask + len, 1);
+        run();
+    }
+    current_ = nullptr;
+}
@@ -0,0 +1,72 @@
+#ifndef INFER_ARENA_H
+#define INFER_ARENA_H
+
+#include <onnxruntime_cxx_api.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Sequence lengths requests are padded up to. DistilBERT tops out at 512 positions.
+const std::vector<int64_t>& default_length_buckets();
+
+// Length of `mask` without its trailing zeros (at least 1). Positions past it are
+// padding that no real token attends to, so dropping them leaves the logits
+// unchanged while attention cost falls with the square of the length.
+inline int64_t trim_padding(const int64_t* mask, int64_t len) {
+    while (len > 1 && mask[len - 1] == 0) --len;
+    return len;
+}
+
+// Preallocated inputs/outputs for one DistilBERT worker.
+//
+// Every length bucket owns its input_ids/attention_mask buffers, a logits buffer and
+// an IoBinding with all three bound once at construction. A request is copied into
+// the smallest bucket that fits (padding carries attention_mask 0, so the logits do
+// not change) and run through that binding, so after warm-up the path from
+// prepare() to probs() does no heap allocation of its own and ORT writes the
+// outputs straight into our buffers. That covers the arena only, not the request
+// around it: json::parse of the body and the JSON response still allocate.
+// Not thread-safe: one arena per worker thread.
+class InferArena {
+public:
+    InferArena(Ort::Session& session, std::vector<int64_t> buckets = default_length_buckets());
+    ~InferArena();
+
+    struct Inputs {
+        int64_t* ids;
+        int64_t* mask;
+    };
+
+    // Select the bucket for a `len`-token request and return its buffers for the
+    // caller to fill; positions past `len` are already zeroed. Throws if `len` is 0
+    // or longer than the largest bucket.
+    Inputs prepare(int64_t len);
+
+    // Run the bucket chosen by the last prepare(). Returns [num_classes] logits,
+    // valid until the next prepare().
+    const float* run();
+    // Softmax of the last run's logits.
+    const float* probs() const { return probs_.data(); }
+
+    // Run every bucket once so ORT's allocator and kernels have seen each shape.
+    void warm_up();
+
+    int64_t num_classes() const { return num_classes_; }
+    int64_t max_length() const { return buckets_.back(); }
+    const std::vector<int64_t>& buckets() const { return buckets_; }
+
+private:
+    struct Bucket;
+
+    Ort::Session& session_;
+    Ort::MemoryInfo mem_;
+    Ort::RunOptions run_options_;
+    std::vector<int64_t> buckets_;
+    std::vector<std::unique_ptr<Bucket>> slots_;
+    Bucket* current_ = nullptr;
+    int64_t num_classes_ = 0;
+    std::vector<float> probs_;
+};
+
+#endif // INFER_ARENA_H
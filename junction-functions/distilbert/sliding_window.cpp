@@ -0,0 +1,107 @@
+#include "sliding_window.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+WindowPooling parse_window_pooling(const std::string& name) {
+    if (name == "mean") return WindowPooling::Mean;
+    if (name == "max") return WindowPooling::Max;
+    if (name == "weighted") return WindowPooling::Weighted;
+    if (name == "first") return WindowPooling::First;
+    throw std::runtime_error("unknown window pooling '" + name + "' (mean, max, weighted or first)");
+}
+
+const char* window_pooling_name(WindowPooling pooling) {
+    switch (pooling) {
+        case WindowPooling::Mean: return "mean";
+        case WindowPooling::Max: return "max";
+        case WindowPooling::Weighted: return "weighted";
+        case WindowPooling::First: return "first";
+    }
+    return "unknown";
+}
+
+void validate_window_config(const WindowConfig& cfg) {
+    if (cfg.window < 3) throw std::runtime_error("window must be at least 3 tokens");
+    // Stride is measured over the tokens between [CLS] and [SEP].
+    if (cfg.stride < 1 || cfg.stride > cfg.window - 2) {
+        throw std::runtime_error("window stride must be between 1 and window - 2");
+    }
+    if (cfg.max_windows < 1) throw std::runtime_error("max windows must be at least 1");
+}
+
+void plan_windows(const int64_t* ids, const int64_t* mask, int64_t len, const WindowConfig& cfg,
+                  WindowBatch& out) {
+    validate_window_config(cfg);
+    if (len < 1) throw std::runtime_error("empty input");
+
+    // Special tokens stay out of the windowed body and are put back around each window.
+    const bool wrapped = len >= 2 && ids[0] == cfg.cls_id && ids[len - 1] == cfg.sep_id;
+    const int64_t extra = wrapped ? 2 : 0;
+    const int64_t* body_ids = ids + (wrapped ? 1 : 0);
+    const int64_t* body_mask = mask + (wrapped ? 1 : 0);
+    const int64_t body_len = len - extra;
+    const int64_t span = std::min(cfg.window - extra, std::max<int64_t>(body_len, 1));
+
+    const int64_t windows =
+        body_len <= span ? 1 : 1 + (body_len - span + cfg.stride - 1) / cfg.stride;
+    if (windows > cfg.max_windows) {
+        throw std::runtime_error("input of " + std::to_string(len) + " tokens needs " + std::to_string(windows) +
+                                 " windows, more than the limit of " + std::to_string(cfg.max_windows));
+    }
+
+    out.windows = windows;
+    out.length = span + extra;
+    out.ids.assign(static_cast<size_t>(windows * out.length), 0);
+    out.mask.assign(out.ids.size(), 0);
+    out.weight.assign(static_cast<size_t>(windows), 0);
+
+    int64_t covered = 0;  // body tokens already inside an earlier window
+    for (int64_t w = 0; w < windows; ++w) {
+        // The last window is pulled back to end on the last token, so it is full too.
+        const int64_t offset = std::min(w * cfg.stride, std::max<int64_t>(body_len - span, 0));
+        const int64_t n = std::min(span, body_len - offset);
+        int64_t* row_ids = out.ids.data() + w * out.length;
+        int64_t* row_mask = out.mask.data() + w * out.length;
+        int64_t pos = 0;
+        if (wrapped) {
+            row_ids[pos] = cfg.cls_id;
+            row_mask[pos++] = 1;
+        }
+        std::copy(body_ids + offset, body_ids + offset + n, row_ids + pos);
+        std::copy(body_mask + offset, body_mask + offset + n, row_mask + pos);
+        pos += n;
+        if (wrapped) {
+            row_ids[pos] = cfg.sep_id;
+            row_mask[pos] = 1;
+        }
+        out.weight[w] = std::max<int64_t>(offset + n - covered, 0);
+        covered = std::max(covered, offset + n);
+    }
+}
+
+void pool_window_logits(const float* logits, int64_t classes, const WindowBatch& batch,
+                        WindowPooling pooling, float* out) {
+    if (pooling == WindowPooling::First || batch.windows == 1) {
+        std::copy(logits, logits + classes, out);
+        return;
+    }
+    if (pooling == WindowPooling::Max) {
+        std::copy(logits, logits + classes, out);
+        for (int64_t w = 1; w < batch.windows; ++w) {
+            for (int64_t c = 0; c < classes; ++c) out[c] = std::max(out[c], logits[w * classes + c]);
+        }
+        return;
+    }
+
+    std::fill(out, out + classes, 0.0f);
+    double total = 0.0;
+    for (int64_t w = 0; w < batch.windows; ++w) {
+        const double weight = pooling == WindowPooling::Weighted ? static_cast<double>(batch.weight[w]) : 1.0;
+        for (int64_t c = 0; c < classes; ++c) out[c] += static_cast<float>(weight * logits[w * classes + c]);
+        total += weight;
+    }
+    if (total > 0.0) {
+        for (int64_t c = 0; c < classes; ++c) out[c] = static_cast<float>(out[c] / total);
+    }
+}
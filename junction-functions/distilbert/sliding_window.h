@@ -0,0 +1,52 @@
+#ifndef SLIDING_WINDOW_H
+#define SLIDING_WINDOW_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// How per-window logits are combined into the document's logits.
+enum class WindowPooling {
+    Mean,      // average over windows
+    Max,       // per-class maximum: one strongly-polar window decides
+    Weighted,  // average weighted by each window's count of tokens not seen in an earlier window
+    First,     // first window only (plain truncation, for comparison)
+};
+
+WindowPooling parse_window_pooling(const std::string& name);
+const char* window_pooling_name(WindowPooling pooling);
+
+// Inputs longer than the model's 512 positions are split into overlapping
+// windows of `window` tokens, `stride` tokens apart, each re-wrapped in
+// [CLS] ... [SEP] when the input itself was.
+struct WindowConfig {
+    int64_t window = 512;
+    int64_t stride = 384;  // window - stride tokens of overlap keep context across cuts
+    int64_t max_windows = 32;  // longer inputs are rejected: 32 windows cover ~12k tokens
+    WindowPooling pooling = WindowPooling::Mean;
+    int64_t cls_id = 101;
+    int64_t sep_id = 102;
+};
+
+// A [windows, length] batch ready to run in one Session::Run.
+struct WindowBatch {
+    int64_t windows = 0;
+    int64_t length = 0;
+    std::vector<int64_t> ids;     // [windows * length]
+    std::vector<int64_t> mask;    // [windows * length]
+    std::vector<int64_t> weight;  // [windows] new tokens per window, for WindowPooling::Weighted
+};
+
+// Throws if the window/stride settings cannot be planned.
+void validate_window_config(const WindowConfig& cfg);
+
+// Fill `out` with the windows over ids/mask[0, len). Reuses `out`'s storage.
+// Throws if cfg is inconsistent or the input needs more than cfg.max_windows.
+void plan_windows(const int64_t* ids, const int64_t* mask, int64_t len, const WindowConfig& cfg,
+                  WindowBatch& out);
+
+// Combine [batch.windows, classes] logits into `out` [classes].
+void pool_window_logits(const float* logits, int64_t classes, const WindowBatch& batch,
+                        WindowPooling pooling, float* out);
+
+#endif // SLIDING_WINDOW_H
@@ -0,0 +1,81 @@
+#include "warmup.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <chrono>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+double ms_since(Clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+}
+
+// One [batch, len] run through plain Session::Run; the arena only binds batch 1.
+void run_batch(Ort::Session& session, int64_t batch, int64_t len) {
+    static const char* input_names[] = {"input_ids", "attention_mask"};
+    static const char* output_names[] = {"logits"};
+    Ort::MemoryInfo mem = Ort::MemoryInfo::CreateCpu(OrtDeviceAllocator, OrtMemTypeCPU);
+    std::vector<int64_t> ids(static_cast<size_t>(batch * len), 0);
+    std::vector<int64_t> mask(ids.size(), 1);
+    std::array<int64_t, 2> shape{batch, len};
+    std::array<Ort::Value, 2> inputs{
+        Ort::Value::CreateTensor<int64_t>(mem, ids.data(), ids.size(), shape.data(), shape.size()),
+        Ort::Value::CreateTensor<int64_t>(mem, mask.data(), mask.size(), shape.data(), shape.size())};
+    session.Run(Ort::RunOptions{nullptr}, input_names, inputs.data(), inputs.size(), output_names, 1);
+}
+}  // namespace
+
+int64_t named_warmup_length(const std::string& name) {
+    // Token counts of the data/prompts.json prompt for each bucket, rounded up.
+    if (name == "small") return 64;
+    if (name == "medium") return 256;
+    if (name == "large") return 384;
+    if (name == "xl") return 512;
+    throw std::runtime_error("unknown warm-up bucket '" + name + "' (small, medium, large, xl or a token count)");
+}
+
+std::vector<int64_t> default_warmup_lengths() {
+    return {named_warmup_length("small"), named_warmup_length("medium"), named_warmup_length("large"),
+            named_warmup_length("xl")};
+}
+
+std::vector<int64_t> parse_warmup_lengths(const std::string& text) {
+    std::vector<int64_t> out;
+    if (text == "none") return out;
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (item.empty()) continue;
+        out.push_back(std::isdigit(static_cast<unsigned char>(item[0])) ? std::stoll(item) : named_warmup_length(item));
+    }
+    return out;
+}
+
+WarmupReport run_warmup(Ort::Session& session, InferArena& arena, const WarmupConfig& cfg) {
+    WarmupReport report;
+    const auto start = Clock::now();
+    for (int it = 0; it < cfg.iterations; ++it) {
+        for (int64_t batch : cfg.batch_sizes) {
+            for (int64_t len : cfg.lengths) {
+                len = std::min(std::max<int64_t>(len, 1), arena.max_length());
+                const auto t0 = Clock::now();
+                if (batch <= 1) {
+                    InferArena::Inputs in = arena.prepare(len);
+                    std::fill(in.ids, in.ids + len, 0);
+                    std::fill(in.mask, in.mask + len, 1);
+                    arena.run();
+                } else {
+                    run_batch(session, batch, len);
+                }
+                report.slowest_ms = std::max(report.slowest_ms, ms_since(t0));
+                ++report.runs;
+            }
+        }
+    }
+    report.ms = ms_since(start);
+    return report;
+}
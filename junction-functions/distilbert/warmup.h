@@ -0,0 +1,42 @@
+#ifndef WARMUP_H
+#define WARMUP_H
+
+#include "infer_arena.h"
+
+#include <onnxruntime_cxx_api.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Token lengths for the request-size buckets used by the traces
+// (data/preprocess_trace.py): small, medium, large, xl. Lengths past the model's
+// 512 positions are clamped when the warm-up runs.
+int64_t named_warmup_length(const std::string& name);
+
+// small, medium, large and xl.
+std::vector<int64_t> default_warmup_lengths();
+
+// Dummy inferences a worker runs before it reports ready, so the first real
+// request of each shape does not pay for kernel setup, weight prepacking or
+// first-touch page faults.
+struct WarmupConfig {
+    std::vector<int64_t> lengths = default_warmup_lengths();  // tokens; empty: no warm-up
+    std::vector<int64_t> batch_sizes{1};
+    int iterations = 2;  // the second pass catches allocator growth the first one caused
+};
+
+// Parse "small,medium,128" into token lengths; "none" gives an empty list.
+std::vector<int64_t> parse_warmup_lengths(const std::string& text);
+
+struct WarmupReport {
+    double ms = 0.0;          // wall time of the whole warm-up
+    double slowest_ms = 0.0;  // slowest single run, normally the very first
+    int runs = 0;
+};
+
+// Run `cfg` against `arena` (batch 1, through its bindings) and, for larger batch
+// sizes, straight against `session`.
+WarmupReport run_warmup(Ort::Session& session, InferArena& arena, const WarmupConfig& cfg);
+
+#endif // WARMUP_H
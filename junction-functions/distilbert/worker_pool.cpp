@@ -0,0 +1,370 @@
+#include "worker_pool.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+// Hardware counter totals for one length bucket; rates and ratios (IPC, LLC
+// misses per instruction) are left to the scraper.
+struct BucketPerf {
+    metrics::Counter* runs;
+    metrics::Counter* cycles;
+    metrics::Counter* instructions;
+    metrics::Counter* llc_misses;
+    metrics::Counter* context_switches;
+
+    void add(const PerfReading& r) {
+        runs->inc();
+        cycles->inc(r.cycles);
+        instructions->inc(r.instructions);
+        llc_misses->inc(r.llc_misses);
+        context_switches->inc(r.context_switches);
+    }
+};
+
+void pin_current_thread(int core) {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+        throw std::runtime_error("failed to pin worker to core " + std::to_string(core));
+    }
+#else
+    (void)core;
+#endif
+}
+
+// ORT pins intra-op threads 2..n itself (the calling thread is ours to pin). Its
+// affinity string is 1-based: "3;4" puts thread 2 on core 2 and thread 3 on core 3.
+std::string intra_op_affinities(int first_core, int threads) {
+    std::string out;
+    for (int t = 1; t < threads; ++t) {
+        if (!out.empty()) out += ';';
+        out += std::to_string(first_core + t + 1);
+    }
+    return out;
+}
+}  // namespace
+
+WorkerPool::WorkerPool(Ort::Env& env, const std::string& model_path, const WorkerPoolConfig& cfg)
+    : cfg_(cfg), model_(SharedModel::open(model_path)) {
+    cfg_.intra_op_threads = std::max(1, cfg_.intra_op_threads);
+    if (cfg_.workers <= 0) {
+        const int cores = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        cfg_.workers = std::max(1, (cores - cfg_.first_core) / cfg_.intra_op_threads);
+    }
+    completed_ = std::vector<std::atomic<uint64_t>>(static_cast<size_t>(cfg_.workers));
+
+    for (int i = 0; i < cfg_.workers; ++i) {
+        threads_.emplace_back(&WorkerPool::worker_main, this, i, std::ref(env));
+    }
+
+    auto stop_workers = [this] {
+        {
+            std::lock_guard<std::mutex> qlk(mtx_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for (auto& t : threads_) t.join();
+    };
+    std::unique_lock<std::mutex> lk(ready_mtx_);
+    ready_cv_.wait(lk, [&] { return ready_ == cfg_.workers; });
+    if (startup_error_) {
+        lk.unlock();
+        stop_workers();
+        std::rethrow_exception(startup_error_);
+    }
+    lk.unlock();
+
+    if (!cfg_.long_inputs) return;
+    try {
+        Ort::SessionOptions opts;
+        opts.SetExecutionMode(ExecutionMode::ORT_SEQUENTIAL);
+        opts.SetIntraOpNumThreads(cfg_.window_threads > 0 ? cfg_.window_threads
+                                                          : cfg_.workers * cfg_.intra_op_threads);
+        opts.SetInterOpNumThreads(1);
+        window_session_ = std::make_unique<Ort::Session>(
+            create_shared_session(env, *model_, opts, &prepacked_, !cfg_.prepack));
+        if (!cfg_.warmup.lengths.empty()) {
+            // Two full windows: enough for ORT to see a batched shape before the first long request.
+            std::vector<int64_t> ids(static_cast<size_t>(max_length_ + 1), 0), mask(ids.size(), 1);
+            WindowBatch batch;
+            WindowConfig wcfg;
+            wcfg.window = max_length_;
+            wcfg.stride = max_length_ - 2;
+            plan_windows(ids.data(), mask.data(), static_cast<int64_t>(ids.size()), wcfg, batch);
+            std::vector<float> logits(static_cast<size_t>(batch.windows * num_classes_));
+            run_windows(batch, logits.data());
+        }
+    } catch (...) {
+        stop_workers();
+        throw;
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto& t : threads_) {
+        if (t.joinable()) t.join();
+    }
+    for (InferJob* job : queue_) {
+        // Notify under the lock: once done is visible the caller may return and
+        // destroy the job, cv included.
+        std::lock_guard<std::mutex> lk(job->m);
+        job->error = "inference pool shutting down";
+        job->done = true;
+        job->cv.notify_one();
+    }
+}
+
+void WorkerPool::run(InferJob& job) {
+    job.queued_ns = tracing::now_ns();
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        if (queue_.size() >= cfg_.max_queue) throw std::runtime_error("inference queue is full");
+        queue_.push_back(&job);
+    }
+    cv_.notify_one();
+
+    std::unique_lock<std::mutex> lk(job.m);
+    job.cv.wait(lk, [&] { return job.done; });
+    if (!job.error.empty()) throw std::runtime_error(job.error);
+}
+
+void WorkerPool::run_windows(const WindowBatch& batch, float* logits) {
+    if (!window_session_) throw std::runtime_error("long inputs are disabled");
+    static const char* input_names[] = {"input_ids", "attention_mask"};
+    static const char* output_names[] = {"logits"};
+    const std::array<int64_t, 2> in_shape{batch.windows, batch.length};
+    const std::array<int64_t, 2> out_shape{batch.windows, num_classes_};
+    Ort::MemoryInfo mem = Ort::MemoryInfo::CreateCpu(OrtDeviceAllocator, OrtMemTypeCPU);
+    // ORT only reads the inputs; the casts satisfy CreateTensor's signature.
+    std::array<Ort::Value, 2> inputs{
+        Ort::Value::CreateTensor<int64_t>(mem, const_cast<int64_t*>(batch.ids.data()), batch.ids.size(),
+                                          in_shape.data(), in_shape.size()),
+        Ort::Value::CreateTensor<int64_t>(mem, const_cast<int64_t*>(batch.mask.data()), batch.mask.size(),
+                                          in_shape.data(), in_shape.size())};
+    Ort::Value output = Ort::Value::CreateTensor<float>(mem, logits, static_cast<size_t>(batch.windows * num_classes_),
+                                                       out_shape.data(), out_shape.size());
+
+    std::lock_guard<std::mutex> lk(window_mtx_);
+    window_session_->Run(Ort::RunOptions{nullptr}, input_names, inputs.data(), inputs.size(), output_names,
+                         &output, 1);
+}
+
+size_t WorkerPool::queue_depth() {
+    std::lock_guard<std::mutex> lk(mtx_);
+    return queue_.size();
+}
+
+std::vector<uint64_t> WorkerPool::completed_per_worker() const {
+    std::vector<uint64_t> out;
+    for (const auto& c : completed_) out.push_back(c.load(std::memory_order_relaxed));
+    return out;
+}
+
+void WorkerPool::worker_main(int index, Ort::Env& env) {
+    const int core = cfg_.first_core + index * cfg_.intra_op_threads;
+    std::unique_ptr<Ort::Session> session;
+    std::unique_ptr<InferArena> arena;
+    double load_ms = 0.0;
+    auto worker_options = [&] {
+        Ort::SessionOptions opts;
+        opts.SetExecutionMode(ExecutionMode::ORT_SEQUENTIAL);
+        opts.SetIntraOpNumThreads(cfg_.intra_op_threads);
+        opts.SetInterOpNumThreads(1);
+        if (cfg_.pin && cfg_.intra_op_threads > 1) {
+            opts.AddConfigEntry("session.intra_op_thread_affinities",
+                                intra_op_affinities(core, cfg_.intra_op_threads).c_str());
+        }
+        return opts;
+    };
+    WarmupReport warm;
+    try {
+        const auto t0 = std::chrono::steady_clock::now();
+        // Pin before loading so the session's memory is first touched on our node.
+        if (cfg_.pin) pin_current_thread(core);
+
+        Ort::SessionOptions opts = worker_options();
+        session = std::make_unique<Ort::Session>(
+            create_shared_session(env, *model_, opts, &prepacked_, !cfg_.prepack));
+        arena = std::make_unique<InferArena>(*session, cfg_.buckets);
+        load_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+        warm = run_warmup(*session, *arena, cfg_.warmup);
+    } catch (...) {
+        std::lock_guard<std::mutex> lk(ready_mtx_);
+        if (!startup_error_) startup_error_ = std::current_exception();
+        ++ready_;
+        ready_cv_.notify_all();
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lk(ready_mtx_);
+        num_classes_ = arena->num_classes();
+        max_length_ = arena->max_length();
+        buckets_ = arena->buckets();
+        startup_.load_ms = std::max(startup_.load_ms, load_ms);
+        startup_.warmup_ms = std::max(startup_.warmup_ms, warm.ms);
+        startup_.slowest_warmup_run_ms = std::max(startup_.slowest_warmup_run_ms, warm.slowest_ms);
+        startup_.warmup_runs = warm.runs;
+        ++ready_;
+    }
+    ready_cv_.notify_all();
+
+    // Looked up once: recording is then a couple of relaxed adds per request.
+    metrics::Registry& registry = metrics::Registry::global();
+    metrics::Histogram& queue_wait =
+        registry.histogram("distilbert_queue_wait_seconds", "Time a request waited for a free worker");
+    std::vector<metrics::Histogram*> run_seconds;
+    for (int64_t b : arena->buckets()) {
+        run_seconds.push_back(&registry.histogram("distilbert_inference_seconds",
+                                                  "session.Run time per request, by padded length bucket",
+                                                  {{"bucket", std::to_string(b)}}));
+    }
+
+    // Only when built with JUNCTION_PERF_COUNTERS and the kernel lets this thread
+    // count; otherwise start()/stop() are no-ops and nothing is registered.
+    PerfCounters perf;
+    std::vector<BucketPerf> bucket_perf;
+    if (perf.available()) {
+        for (int64_t b : arena->buckets()) {
+            const metrics::Labels labels{{"bucket", std::to_string(b)}};
+            bucket_perf.push_back(
+                {&registry.counter("distilbert_perf_runs_total", "session.Run calls counted", labels),
+                 &registry.counter("distilbert_perf_cycles_total", "User-space cycles in session.Run", labels),
+                 &registry.counter("distilbert_perf_instructions_total", "User-space instructions in session.Run",
+                                   labels),
+                 &registry.counter("distilbert_perf_llc_misses_total", "Last-level cache misses in session.Run",
+                                   labels),
+                 &registry.counter("distilbert_perf_context_switches_total",
+                                   "Context switches of the worker during session.Run", labels)});
+        }
+    } else if (JUNCTION_PERF_COUNTERS && index == 0) {
+        std::cerr << "distilbert_service: perf counters unavailable: " << perf.error() << "\n";
+    }
+
+    // Sampled jobs run on a second session with ORT profiling on. It is built and
+    // warmed between jobs, never while a caller waits: up front while the rate is
+    // above zero, else after the first sampled job (which runs unprofiled) asks for
+    // it. The warm-up runs are left out of the profile.
+    std::unique_ptr<ProfiledSession> profiled;
+    std::unique_ptr<InferArena> profiled_arena;
+    if (cfg_.profiler) {
+        profiled = std::make_unique<ProfiledSession>(
+            *cfg_.profiler, "worker" + std::to_string(index), [&](const std::string& prefix) {
+                Ort::SessionOptions opts = worker_options();
+                opts.EnableProfiling(prefix.c_str());
+                return std::make_unique<Ort::Session>(
+                    create_shared_session(env, *model_, opts, &prepacked_, !cfg_.prepack));
+            });
+    }
+    auto flush_profile = [&] {
+        try {
+            profiled->flush();
+        } catch (const std::exception& e) {
+            std::cerr << "distilbert_service: worker " << index << ": ORT profile: " << e.what() << "\n";
+        }
+    };
+    auto profiling_arena = [&]() -> InferArena* {
+        if (!profiled_arena) {
+            try {
+                profiled_arena = std::make_unique<InferArena>(profiled->session(), cfg_.buckets);
+                profiled_arena->warm_up();
+                // One Run per bucket: count them as run and skipped, so runs_per_file
+                // and pending_runs cover sampled jobs only.
+                const int warm_runs = static_cast<int>(profiled_arena->buckets().size());
+                profiled->skip_runs(warm_runs);
+                profiled->finish_run(warm_runs);
+            } catch (const std::exception& e) {
+                // Profiling is best effort: the job still runs on the normal session.
+                std::cerr << "distilbert_service: worker " << index << ": profiling session: " << e.what() << "\n";
+                profiled_arena.reset();
+                flush_profile();
+                return nullptr;
+            }
+        }
+        return profiled_arena.get();
+    };
+
+    const int64_t classes = arena->num_classes();
+    bool want_profiling = cfg_.profiler && cfg_.profiler->rate() > 0;
+    while (true) {
+        if (want_profiling && !profiled_arena) profiling_arena();
+        want_profiling = false;
+
+        InferJob* job = nullptr;
+        {
+            std::unique_lock<std::mutex> lk(mtx_);
+            cv_.wait(lk, [&] { return stop_ || !queue_.empty(); });
+            if (stop_) return;
+            job = queue_.front();
+            queue_.pop_front();
+        }
+        const int64_t dequeued_ns = tracing::now_ns();
+        queue_wait.observe((dequeued_ns - job->queued_ns) / 1e9);
+        tracing::record(job->trace, 0, "service.queue", job->queued_ns, dequeued_ns);
+
+        InferArena* run_arena = arena.get();
+        if (job->profile && profiled) {
+            if (profiled_arena) run_arena = profiled_arena.get();
+            else want_profiling = true;
+        }
+
+        std::string error;
+        try {
+            InferArena::Inputs in = run_arena->prepare(job->len);
+            std::copy(job->ids, job->ids + job->len, in.ids);
+            std::copy(job->mask, job->mask + job->len, in.mask);
+            tracing::Span span("session.run", job->trace);
+            perf.start();
+            const int64_t run_start = tracing::now_ns();
+            const float* logits = run_arena->run();
+            const int64_t run_end = tracing::now_ns();
+            PerfReading counted;
+            const bool have_perf = perf.stop(counted);
+            span.end();
+            const auto& buckets = arena->buckets();
+            const size_t bucket = std::lower_bound(buckets.begin(), buckets.end(), job->len) - buckets.begin();
+            if (run_arena == arena.get()) {
+                // Profiled runs are slower and would skew the latency and counter figures.
+                run_seconds[bucket]->observe((run_end - run_start) / 1e9);
+                if (have_perf) bucket_perf[bucket].add(counted);
+            }
+            std::copy(logits, logits + classes, job->logits);
+            std::copy(run_arena->probs(), run_arena->probs() + classes, job->probs);
+        } catch (const std::exception& e) {
+            error = e.what();
+        }
+        completed_[index].fetch_add(1, std::memory_order_relaxed);
+
+        {
+            // Under the lock, as in ~WorkerPool: the job lives on the caller's stack.
+            std::lock_guard<std::mutex> lk(job->m);
+            job->error = std::move(error);
+            job->done = true;
+            job->cv.notify_one();
+        }
+
+        if (run_arena != arena.get() && profiled->finish_run()) {
+            // Hand this batch of runs to the profiler, after the caller has its
+            // answer; the session is rebuilt before the next job if still sampling.
+            profiled_arena.reset();
+            flush_profile();
+            want_profiling = cfg_.profiler->rate() > 0;
+        }
+    }
+}
@@ -0,0 +1,133 @@
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include "infer_arena.h"
+#include "sliding_window.h"
+#include "warmup.h"
+#include "../common/op_profile.h"
+#include "../common/perf_counters.h"
+#include "../common/request_trace.h"
+#include "../common/shared_model.h"
+#include "../junctiond/metrics.h"
+
+#include <onnxruntime_cxx_api.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct WorkerPoolConfig {
+    int workers = 0;           // 0: one per online core / intra_op_threads
+    int intra_op_threads = 1;  // ORT threads per worker, the worker itself included
+    bool pin = true;           // pin each worker (and its ORT threads) to its own cores
+    int first_core = 0;
+    size_t max_queue = 1024;   // submissions beyond this many waiting jobs are rejected
+    bool prepack = true;       // false: leave every weight in the shared mapping (see SharedModel)
+    std::vector<int64_t> buckets = default_length_buckets();
+    WarmupConfig warmup;       // run by every worker before the pool reports ready
+    bool long_inputs = true;   // build the session run_windows() needs
+    int window_threads = 0;    // its intra-op threads; 0: every core the workers were given
+    OpProfiler* profiler = nullptr;  // set: jobs with `profile` run on a profiling session
+};
+
+// How long the pool took to come up. Workers start in parallel, so each figure is
+// the slowest worker's.
+struct PoolStartup {
+    double load_ms = 0.0;    // session + arena construction
+    double warmup_ms = 0.0;
+    double slowest_warmup_run_ms = 0.0;
+    int warmup_runs = 0;     // per worker
+};
+
+// One classification request. It lives on the submitting thread's stack, and the
+// worker copies results into the caller's buffers before waking it up.
+struct InferJob {
+    const int64_t* ids = nullptr;
+    const int64_t* mask = nullptr;
+    int64_t len = 0;
+    float* logits = nullptr;  // [num_classes]
+    float* probs = nullptr;   // [num_classes]
+    tracing::TraceContext trace;  // worker records queue wait and session.Run under it
+    int64_t queued_ns = 0;        // set by run()
+    bool profile = false;         // run on the worker's ORT-profiling session
+
+    std::mutex m;
+    std::condition_variable cv;
+    bool done = false;
+    std::string error;
+};
+
+// Fixed set of inference workers fed from one queue.
+//
+// Each worker owns a session whose intra-op pool is sized to the cores it was given
+// and, when pinning is on, is bound to exactly those cores: the worker thread runs
+// on the first one and ORT's extra intra-op threads on the rest. Workers never share
+// a session or a core, so N concurrent requests use N disjoint core sets instead of
+// N callers contending for one session-wide thread pool. Each worker also owns an
+// InferArena, so a warmed-up prepare()/run() does no heap allocation of its own.
+// The rest of a request does: distilbert_service's handler still allocates to
+// json::parse the body and build the response.
+//
+// The sessions are not N copies of the model: all of them are built over one
+// SharedModel mapping and one prepacked-weights container.
+class WorkerPool {
+public:
+    WorkerPool(Ort::Env& env, const std::string& model_path, const WorkerPoolConfig& cfg);
+    ~WorkerPool();
+
+    // Queue `job` and block until a worker has run it. Throws on a full queue or a
+    // failed run.
+    void run(InferJob& job);
+
+    // Run all of `batch`'s windows as one [windows, length] Session::Run on a
+    // session whose intra-op pool spans the pool's cores, writing
+    // [windows * num_classes()] logits. Long documents are rare and each one is a
+    // single batched pass, so they are run one at a time on the caller's thread
+    // rather than queued behind (or fanned out across) the per-core workers.
+    void run_windows(const WindowBatch& batch, float* logits);
+    bool long_inputs() const { return window_session_ != nullptr; }
+
+    int workers() const { return static_cast<int>(threads_.size()); }
+    int64_t num_classes() const { return num_classes_; }
+    int64_t max_length() const { return max_length_; }
+    // Length a `len`-token request is padded to (len <= max_length()).
+    int64_t bucket_for(int64_t len) const { return *std::lower_bound(buckets_.begin(), buckets_.end(), len); }
+    const PoolStartup& startup() const { return startup_; }
+    size_t queue_depth();
+    std::vector<uint64_t> completed_per_worker() const;
+
+private:
+    void worker_main(int index, Ort::Env& env);
+
+    WorkerPoolConfig cfg_;
+    std::unique_ptr<SharedModel> model_;
+    PrepackedWeights prepacked_;
+    std::vector<std::thread> threads_;
+    std::vector<std::atomic<uint64_t>> completed_;
+    std::unique_ptr<Ort::Session> window_session_;
+    std::mutex window_mtx_;
+
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    std::deque<InferJob*> queue_;
+    bool stop_ = false;
+
+    // Startup handshake: workers report once their session is loaded and warm.
+    std::mutex ready_mtx_;
+    std::condition_variable ready_cv_;
+    int ready_ = 0;
+    std::exception_ptr startup_error_;
+    int64_t num_classes_ = 0;
+    int64_t max_length_ = 0;
+    std::vector<int64_t> buckets_;  // sorted, as the arenas use them
+    PoolStartup startup_;
+};
+
+#endif // WORKER_POOL_H
@@ -1,20 +1,32 @@
 #include "../junctiond/httplib.h"
 #include "../junctiond/json.hpp"
+#include "../junctiond/metrics.h"
 
 #include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
 #include <cstdlib>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <mutex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <vector>
+#include <fcntl.h>
+#include <poll.h>
 #include <sys/wait.h>
 #include <unistd.h>
 
+#include "cold_start_trace.h"
 #include "junctiond.h"
+#include "common/infer_request.h"
+#include "common/model_registry.h"
+#include "common/phase_markers.h"
+#include "common/request_trace.h"
 
 using json = nlohmann::json;
 
@@ -27,6 +39,11 @@ struct Config {
     std::string service_path;        // distilbert_service binary (warm path)
     std::string junction_run_path;   // junction_run binary
     int warm_port = 9000;            // port for warm service inside junction
+    bool share_model = false;        // hand the warm service the model as a JunctionD memfd
+    std::string registry_path;       // model registry (models/quantize_onnx.py); overrides model_path
+    std::string model_name = "distilbert";
+    std::string variant;             // variant used when a request names none; empty: registry default
+    std::string trace_file;          // span collector file; empty: $JUNCTION_TRACE_FILE, else no tracing
 };
 
 std::string default_handler_path(const char* argv0) {
@@ -63,52 +80,78 @@ Config parse_args(int argc, char* argv[]) {
             cfg.junction_run_path = argv[++i];
         } else if (arg == "--warm-port" && i + 1 < argc) {
             cfg.warm_port = std::stoi(argv[++i]);
+        } else if (arg == "--share-model") {
+            cfg.share_model = true;
+        } else if (arg == "--registry" && i + 1 < argc) {
+            cfg.registry_path = argv[++i];
+        } else if (arg == "--model" && i + 1 < argc) {
+            cfg.model_name = argv[++i];
+        } else if (arg == "--variant" && i + 1 < argc) {
+            cfg.variant = argv[++i];
+        } else if (arg == "--trace-file" && i + 1 < argc) {
+            cfg.trace_file = std::filesystem::absolute(argv[++i]).string();
         } else {
             throw std::runtime_error("Unknown or incomplete argument: " + arg);
         }
     }
-    if (cfg.model_path.empty()) {
-        throw std::runtime_error("--model-path is required");
+    if (cfg.model_path.empty() && cfg.registry_path.empty()) {
+        throw std::runtime_error("--model-path or --registry is required");
     }
     return cfg;
 }
 
-std::string to_space_separated(const std::vector<int64_t>& vals) {
-    std::ostringstream os;
-    for (size_t i = 0; i < vals.size(); ++i) {
-        if (i) os << ' ';
-        os << vals[i];
-    }
-    return os.str();
-}
-
 struct CommandResult {
     int exit_code = -1;
     std::string stdout_output;
     std::string stderr_output;
 };
 
-CommandResult exec_and_capture(const std::vector<std::string>& args) {
+// Runs `args` to completion and collects its output. With `phases`, the child
+// also gets a JUNCTION_PHASE_FD pipe the way a JunctionD instance does
+// (common/phase_markers.h): fork and exec are stamped on the gateway's side and
+// the instance's own marks are appended after them.
+CommandResult exec_and_capture(const std::vector<std::string>& args,
+                               const std::map<std::string, std::string>& env = {},
+                               std::vector<PhaseMark>* phases = nullptr) {
     if (args.empty()) throw std::runtime_error("No command provided");
 
-    int stdout_pipe[2];
-    int stderr_pipe[2];
-    if (pipe(stdout_pipe) != 0 || pipe(stderr_pipe) != 0) {
+    // CLOEXEC, so a child forked for a concurrent request does not inherit these
+    // and hold their write ends open; dup2 clears it on the child's own stdio.
+    int stdout_pipe[2] = {-1, -1};
+    int stderr_pipe[2] = {-1, -1};
+    int phase_pipe[2] = {-1, -1};
+    auto close_pipes = [&] {
+        for (int* p : {stdout_pipe, stderr_pipe, phase_pipe}) {
+            for (int i = 0; i < 2; ++i) {
+                if (p[i] >= 0) close(p[i]);
+            }
+        }
+    };
+    if (pipe2(stdout_pipe, O_CLOEXEC) != 0 || pipe2(stderr_pipe, O_CLOEXEC) != 0 ||
+        (phases && pipe2(phase_pipe, O_CLOEXEC) != 0)) {
+        close_pipes();
         throw std::runtime_error("Failed to create pipes");
     }
 
     pid_t pid = fork();
     if (pid < 0) {
-        close(stdout_pipe[0]); close(stdout_pipe[1]);
-        close(stderr_pipe[0]); close(stderr_pipe[1]);
+        close_pipes();
         throw std::runtime_error("fork() failed");
     }
 
     if (pid == 0) {
+        // Stamp fork here: the parent may not run again until after the child.
+        const int64_t fork_ns = phaseNow();
         dup2(stdout_pipe[1], STDOUT_FILENO);
         dup2(stderr_pipe[1], STDERR_FILENO);
         close(stdout_pipe[0]); close(stdout_pipe[1]);
         close(stderr_pipe[0]); close(stderr_pipe[1]);
+        for (const auto& kv : env) setenv(kv.first.c_str(), kv.second.c_str(), 1);
+        if (phases) {
+            close(phase_pipe[0]);
+            fcntl(phase_pipe[1], F_SETFD, 0);
+            setenv(kPhaseFdEnv, std::to_string(phase_pipe[1]).c_str(), 1);
+        }
 
         std::vector<char*> c_args;
         c_args.reserve(args.size() + 1);
@@ -116,24 +159,50 @@ CommandResult exec_and_capture(const std::vector<std::string>& args) {
             c_args.push_back(const_cast<char*>(a.c_str()));
         }
         c_args.push_back(nullptr);
+        if (phases) {
+            char marks[128];
+            int n = snprintf(marks, sizeof(marks), "PHASE fork %lld\nPHASE exec %lld\n",
+                             static_cast<long long>(fork_ns), static_cast<long long>(phaseNow()));
+            (void)!write(phase_pipe[1], marks, n);
+        }
         execvp(c_args[0], c_args.data());
         _exit(127);
     }
 
     close(stdout_pipe[1]);
     close(stderr_pipe[1]);
+    if (phases) close(phase_pipe[1]);
 
+    // Read every pipe as it fills: a child blocked writing a full stderr (or
+    // phase) pipe would otherwise never close stdout.
     CommandResult result;
+    std::string phase_buffer;
+    pollfd fds[3] = {{stdout_pipe[0], POLLIN, 0}, {stderr_pipe[0], POLLIN, 0}, {phase_pipe[0], POLLIN, 0}};
+    std::string* sinks[3] = {&result.stdout_output, &result.stderr_output, &phase_buffer};
+    const nfds_t nfds = phases ? 3 : 2;
+    nfds_t open_fds = nfds;
     char buffer[1024];
-    ssize_t n;
-    while ((n = read(stdout_pipe[0], buffer, sizeof(buffer))) > 0) {
-        result.stdout_output.append(buffer, buffer + n);
+    while (open_fds > 0) {
+        if (poll(fds, nfds, -1) < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        for (nfds_t i = 0; i < nfds; ++i) {
+            if (fds[i].fd < 0 || fds[i].revents == 0) continue;
+            ssize_t n = read(fds[i].fd, buffer, sizeof(buffer));
+            if (n > 0) {
+                sinks[i]->append(buffer, buffer + n);
+                continue;
+            }
+            if (n < 0 && errno == EINTR) continue;
+            close(fds[i].fd);
+            fds[i].fd = -1;  // poll skips negative descriptors
+            --open_fds;
+        }
     }
-    while ((n = read(stderr_pipe[0], buffer, sizeof(buffer))) > 0) {
-        result.stderr_output.append(buffer, buffer + n);
+    for (nfds_t i = 0; i < nfds; ++i) {
+        if (fds[i].fd >= 0) close(fds[i].fd);
     }
-    close(stdout_pipe[0]);
-    close(stderr_pipe[0]);
 
     int status = 0;
     waitpid(pid, &status, 0);
@@ -143,9 +212,30 @@ CommandResult exec_and_capture(const std::vector<std::string>& args) {
         result.exit_code = -1;
     }
 
+    if (phases) {
+        const size_t first = phases->size();
+        parsePhaseLines(phase_buffer, *phases);
+        // The forked child is still the gateway until execvp; its marks go on our track.
+        for (size_t i = first; i < phases->size(); ++i) {
+            if ((*phases)[i].name == "fork" || (*phases)[i].name == "exec") (*phases)[i].source = "gateway";
+        }
+    }
     return result;
 }
 
+// X-Cold-Start-Phases value: "spawn=0.000,config=0.214,fork=0.301,...", each
+// mark of the timeline in milliseconds from the first.
+std::string phases_header(const std::vector<PhaseMark>& timeline) {
+    std::string out;
+    for (const PhaseMark& m : timeline) {
+        char ms[32];
+        std::snprintf(ms, sizeof(ms), "%.3f", (m.ns - timeline.front().ns) / 1e6);
+        if (!out.empty()) out += ',';
+        out += m.name + '=' + ms;
+    }
+    return out;
+}
+
 std::string write_temp_config(const std::string& name) {
     std::filesystem::path cfg_path = std::filesystem::path("/tmp") / ("junction_" + name + ".config");
     std::ofstream cfg(cfg_path);
@@ -167,28 +257,78 @@ std::string write_temp_config(const std::string& name) {
 
 std::atomic<uint64_t> request_counter{0};
 
-// Track a single warm instance name and simple state.
-struct WarmState {
-    std::string name = "distilbert-warm";
+// One warm instance per model variant, each on its own port.
+struct WarmInstance {
+    std::string name;
+    int port = 0;
     bool started = false;
 };
 
-json run_distilbert_once(const Config& cfg, const std::string& ids_str, const std::string& mask_str) {
+struct WarmState {
+    std::map<std::string, WarmInstance> instances;  // keyed by variant
+    int next_port = 0;
+};
+
+// Thrown for a variant the registry does not know; reported as a 400.
+struct BadVariant : std::runtime_error {
+    using std::runtime_error::runtime_error;
+};
+
+// The model file a request should run: its "variant" field, else the gateway's
+// --variant, else the registry default. Without a registry only --model-path exists.
+ModelVariant select_variant(const Config& cfg, const ModelRegistry* registry, const json& body) {
+    std::string requested = cfg.variant;
+    if (body.contains("variant")) requested = body["variant"].get<std::string>();
+    if (registry) {
+        try {
+            return registry->resolve(cfg.model_name, requested);
+        } catch (const std::runtime_error& e) {
+            throw BadVariant(e.what());
+        }
+    }
+    if (!requested.empty()) throw BadVariant("variant '" + requested + "' requested but no --registry given");
+    return {cfg.model_name, "", cfg.model_path, ""};
+}
+
+// The request's trace context, from the client's traceparent header or a new
+// trace when tracing is on; invalid (nothing recorded or propagated) otherwise.
+tracing::TraceContext request_context(const httplib::Request& req) {
+    tracing::TraceContext ctx;
+    if (tracing::parse_traceparent(req.get_header_value(tracing::kTraceHeader), ctx)) return ctx;
+    return tracing::enabled() ? tracing::new_trace() : ctx;
+}
+
+// Runs one request in a fresh instance. `phases` gets the instance's cold-start
+// timeline: spawn, config, fork, exec and exit from the gateway, merged with the
+// marks the instance sent.
+json run_distilbert_once(const Config& cfg, const std::string& model_path, const std::string& ids_str,
+                         const std::string& mask_str, const tracing::TraceContext& trace,
+                         std::vector<PhaseMark>& phases) {
+    phases = {{"spawn", "gateway", phaseNow()}};
     std::string instance = "infer_" + std::to_string(request_counter.fetch_add(1));
     std::string cfg_path = write_temp_config(instance);
+    phases.push_back({"config", "gateway", phaseNow()});
 
     std::vector<std::string> cmd{
         cfg.junction_run_path,
         cfg_path,
         "--",
         cfg.handler_path,
-        cfg.model_path,
+        model_path,
         ids_str,
         mask_str,
         "--json"
     };
 
-    CommandResult result = exec_and_capture(cmd);
+    // The instance picks the trace up from its environment.
+    tracing::Span span("gateway.exec", trace);
+    std::map<std::string, std::string> env;
+    if (span.context().valid()) env[tracing::kTraceEnv] = span.context().traceparent();
+    if (!cfg.trace_file.empty()) env[tracing::kTraceFileEnv] = cfg.trace_file;
+    CommandResult result = exec_and_capture(cmd, env, &phases);
+    span.end();
+    phases.push_back({"exit", "gateway", phaseNow()});
+    phases = mergeTimeline(std::move(phases));
 
     std::error_code ec;
     std::filesystem::remove(cfg_path, ec);
@@ -202,13 +342,17 @@ json run_distilbert_once(const Config& cfg, const std::string& ids_str, const st
     return json::parse(result.stdout_output);
 }
 
-json call_warm_service(const Config& cfg, const std::vector<int64_t>& ids, const std::vector<int64_t>& mask) {
-    httplib::Client cli("192.168.127.7", cfg.warm_port);
+json call_warm_service(int port, const std::vector<int64_t>& ids, const std::vector<int64_t>& mask,
+                       const tracing::TraceContext& trace) {
+    tracing::Span span("gateway.warm_call", trace);
+    httplib::Headers headers;
+    if (span.context().valid()) headers.emplace(tracing::kTraceHeader, span.context().traceparent());
+    httplib::Client cli("192.168.127.7", port);
     cli.set_connection_timeout(2, 0);
     cli.set_read_timeout(10, 0);
     cli.set_write_timeout(10, 0);
     json body{{"input_ids", ids}, {"attention_mask", mask}};
-    auto resp = cli.Post("/infer", body.dump(), "application/json");
+    auto resp = cli.Post("/infer", headers, body.dump(), "application/json");
     if (!resp) throw std::runtime_error("warm service unreachable");
     if (resp->status != 200) {
         throw std::runtime_error("warm service error status " + std::to_string(resp->status));
@@ -238,7 +382,9 @@ int main(int argc, char* argv[]) {
         std::cerr << "Usage: " << argv[0]
                   << " --model-path /path/to/distilbert.onnx [--host 0.0.0.0] [--port 8080]"
                   << " [--handler-path /path/to/distilbert_infer] [--service-path /path/to/distilbert_service]"
-                  << " [--junction-run /path/to/junction_run] [--warm-port 9000]\n"
+                  << " [--junction-run /path/to/junction_run] [--warm-port 9000] [--share-model]"
+                  << " [--registry registry.json [--model distilbert]] [--variant fp32|int8]"
+                  << " [--trace-file spans.jsonl]\n"
                   << "Error: " << e.what() << "\n";
         return 1;
     }
@@ -252,8 +398,32 @@ int main(int argc, char* argv[]) {
               << " port=" << cfg.port
               << " warm_port=" << cfg.warm_port << std::endl;
 
+        std::unique_ptr<ModelRegistry> registry;
+        if (!cfg.registry_path.empty()) {
+            registry = std::make_unique<ModelRegistry>(cfg.registry_path);
+            std::cout << "Gateway registry: " << cfg.registry_path << " model=" << cfg.model_name
+                      << " default variant=" << registry->resolve(cfg.model_name, cfg.variant).name << std::endl;
+        }
+
+        if (tracing::start("gateway", cfg.trace_file)) {
+            std::cout << "Gateway tracing to "
+                      << (cfg.trace_file.empty() ? std::getenv(tracing::kTraceFileEnv) : cfg.trace_file) << std::endl;
+        }
+
+        // /metrics: gateway_* per path (cold /infer, warm /infer_warm) plus the junctiond_*
+        // series of the in-process JunctionD.
+        metrics::Registry& metrics_registry = metrics::Registry::global();
+        metrics::RequestMetrics cold_metrics(metrics_registry, "gateway", {{"mode", "cold"}});
+        metrics::RequestMetrics warm_metrics(metrics_registry, "gateway", {{"mode", "warm"}});
+        metrics::Histogram& cold_exec_seconds =
+            metrics_registry.histogram("gateway_cold_exec_seconds", "junction_run exec of a cold-path instance, to exit");
+        metrics::Histogram& warm_call_seconds =
+            metrics_registry.histogram("gateway_warm_call_seconds", "Round trip to the warm service");
+        metrics::Counter& warm_spawns = metrics_registry.counter("gateway_warm_spawns_total", "Warm instances started");
+
         JunctionD jd;
         WarmState warm;
+        warm.next_port = cfg.warm_port;
         std::mutex warm_mtx;
 
         httplib::Server svr;
@@ -273,6 +443,7 @@ int main(int argc, char* argv[]) {
                 if (body.contains("args")) f.args = body["args"].get<std::string>();
                 if (body.contains("cpu")) f.cpu = body["cpu"].get<int>();
                 if (body.contains("memoryMB")) f.memoryMB = body["memoryMB"].get<int>();
+                if (body.contains("shared_model")) f.sharedModel = body["shared_model"].get<std::string>();
 
                 if (body.contains("env") && body["env"].is_object()) {
                     for (auto it = body["env"].begin(); it != body["env"].end(); ++it) {
@@ -314,7 +485,16 @@ int main(int argc, char* argv[]) {
                 auto list = jd.list();
                 json arr = json::array();
                 for (const auto& st : list) {
-                    arr.push_back({{"name", st.name}, {"running", st.running}, {"pid", st.pid}});
+                    json entry{{"name", st.name}, {"running", st.running}, {"pid", st.pid}};
+                    if (st.memory.valid) {
+                        entry["memory"] = {{"rss_kb", st.memory.rssKB},
+                                           {"pss_kb", st.memory.pssKB},
+                                           {"shared_kb", st.memory.sharedKB},
+                                           {"private_dirty_kb", st.memory.privateDirtyKB},
+                                           {"swap_kb", st.memory.swapKB},
+                                           {"sampled_unix_ns", st.memory.sampledNs}};
+                    }
+                    arr.push_back(std::move(entry));
                 }
                 res.set_content(arr.dump(), "application/json");
             } catch (const std::exception& e) {
@@ -324,43 +504,56 @@ int main(int argc, char* argv[]) {
             }
         });
 
+        // Registered variants with their accuracy/latency/memory metadata.
+        svr.Get("/models", [&](const httplib::Request&, httplib::Response& res) {
+            if (!registry) {
+                json resp{{"variants", {{"default", {{"path", cfg.model_path}}}}}};
+                res.set_content(resp.dump(), "application/json");
+                return;
+            }
+            res.set_content(registry->describe(cfg.model_name), "application/json");
+        });
+
+        svr.Get("/metrics", [&](const httplib::Request&, httplib::Response& res) {
+            res.set_content(metrics_registry.expose(), metrics::kContentType);
+        });
+
         // Cold path: per-request cold start via junction_run
         svr.Post("/infer", [&](const httplib::Request& req, httplib::Response& res) {
+            metrics::RequestMetrics::Scope measured(cold_metrics, res.status);
+            tracing::Span span("gateway.infer", request_context(req));
+            if (span.context().valid()) res.set_header(tracing::kTraceHeader, span.context().traceparent());
             try {
                 auto body = json::parse(req.body);
-                if (!body.contains("input_ids") || !body.contains("attention_mask")) {
-                    res.status = 400;
-                    res.set_content("{\"error\":\"input_ids and attention_mask required\"}", "application/json");
-                    return;
-                }
-
-                const auto& ids_j = body["input_ids"];
-                const auto& mask_j = body["attention_mask"];
-                if (!ids_j.is_array() || !mask_j.is_array()) {
-                    res.status = 400;
-                    res.set_content("{\"error\":\"input_ids and attention_mask must be arrays\"}", "application/json");
-                    return;
-                }
-                if (ids_j.size() != mask_j.size() || ids_j.empty()) {
+                if (const char* err = check_token_arrays(body)) {
                     res.status = 400;
-                    res.set_content("{\"error\":\"input_ids and attention_mask length mismatch or empty\"}", "application/json");
+                    res.set_content(json{{"error", err}}.dump(), "application/json");
                     return;
                 }
 
                 std::vector<int64_t> input_ids;
                 std::vector<int64_t> attention_mask;
-                input_ids.reserve(ids_j.size());
-                attention_mask.reserve(mask_j.size());
-                for (size_t i = 0; i < ids_j.size(); ++i) {
-                    input_ids.push_back(ids_j.at(i).get<int64_t>());
-                    attention_mask.push_back(mask_j.at(i).get<int64_t>());
-                }
+                read_token_arrays(body, input_ids, attention_mask);
 
                 std::string ids_str = to_space_separated(input_ids);
                 std::string mask_str = to_space_separated(attention_mask);
 
-                json resp = run_distilbert_once(cfg, ids_str, mask_str);
+                const ModelVariant variant = select_variant(cfg, registry.get(), body);
+                const auto exec_start = std::chrono::steady_clock::now();
+                std::vector<PhaseMark> phases;
+                json resp = run_distilbert_once(cfg, variant.path, ids_str, mask_str, span.context(), phases);
+                cold_exec_seconds.observe(
+                    std::chrono::duration<double>(std::chrono::steady_clock::now() - exec_start).count());
+                if (!variant.name.empty()) resp["variant"] = variant.name;
+                // Every cold-path request execs its own instance (see common/backend_adapter.h).
+                // Only answered requests carry it: a 400 or 500 started nothing.
+                res.set_header("X-Cold-Start", "1");
+                res.set_header("X-Cold-Start-Phases", phases_header(phases));
                 res.set_content(resp.dump(), "application/json");
+            } catch (const BadVariant& e) {
+                res.status = 400;
+                json err{{"error", e.what()}};
+                res.set_content(err.dump(), "application/json");
             } catch (const std::exception& e) {
                 res.status = 500;
                 json err{{"error", e.what()}};
@@ -370,59 +563,67 @@ int main(int argc, char* argv[]) {
 
         // Warm path: ensure a long-lived junctiond-managed instance is running distilbert_service, then proxy.
         svr.Post("/infer_warm", [&](const httplib::Request& req, httplib::Response& res) {
+            metrics::RequestMetrics::Scope measured(warm_metrics, res.status);
+            tracing::Span span("gateway.infer_warm", request_context(req));
+            if (span.context().valid()) res.set_header(tracing::kTraceHeader, span.context().traceparent());
             try {
                 auto body = json::parse(req.body);
-                if (!body.contains("input_ids") || !body.contains("attention_mask")) {
-                    res.status = 400;
-                    res.set_content("{\"error\":\"input_ids and attention_mask required\"}", "application/json");
-                    return;
-                }
-                const auto& ids_j = body["input_ids"];
-                const auto& mask_j = body["attention_mask"];
-                if (!ids_j.is_array() || !mask_j.is_array()) {
-                    res.status = 400;
-                    res.set_content("{\"error\":\"input_ids and attention_mask must be arrays\"}", "application/json");
-                    return;
-                }
-                if (ids_j.size() != mask_j.size() || ids_j.empty()) {
+                if (const char* err = check_token_arrays(body)) {
                     res.status = 400;
-                    res.set_content("{\"error\":\"input_ids and attention_mask length mismatch or empty\"}", "application/json");
+                    res.set_content(json{{"error", err}}.dump(), "application/json");
                     return;
                 }
 
-                // First-time warm start: spawn a junctiond-managed service if not already started.
+                const ModelVariant variant = select_variant(cfg, registry.get(), body);
+
+                // First-time warm start for this variant: spawn a junctiond-managed service if not already started.
+                int port = 0;
+                bool spawned = false;
                 {
                     std::lock_guard<std::mutex> lk(warm_mtx);
-                    if (!warm.started) {
+                    WarmInstance& inst = warm.instances[variant.name];
+                    if (!inst.started) {
+                        inst.name = "distilbert-warm" + (variant.name.empty() ? "" : "-" + variant.name);
+                        if (inst.port == 0) inst.port = warm.next_port++;
                         FunctionData f{};
-                        f.name = warm.name;
+                        f.name = inst.name;
                         f.execpath = cfg.service_path;
                         std::ostringstream args;
-                        args << "--model-path " << cfg.model_path << " --host 0.0.0.0 --port " << cfg.warm_port;
+                        args << "--model-path " << variant.path << " --host 0.0.0.0 --port " << inst.port;
                         f.args = args.str();
                         f.cpu = 2;
                         f.memoryMB = 512;
+                        if (cfg.share_model) f.sharedModel = variant.path;
+                        if (!cfg.trace_file.empty()) f.env[tracing::kTraceFileEnv] = cfg.trace_file;
+                        tracing::Span spawn_span("junctiond.spawn", span.context());
                         bool ok = jd.spawn(f);
+                        spawn_span.end();
                         if (!ok) {
                             res.status = 500;
                             res.set_content("{\"error\":\"failed to spawn warm instance\"}", "application/json");
                             return;
                         }
-                        warm.started = true;
+                        inst.started = true;
+                        spawned = true;
+                        warm_spawns.inc();
                     }
+                    port = inst.port;
                 }
-
                 std::vector<int64_t> input_ids;
                 std::vector<int64_t> attention_mask;
-                input_ids.reserve(ids_j.size());
-                attention_mask.reserve(mask_j.size());
-                for (size_t i = 0; i < ids_j.size(); ++i) {
-                    input_ids.push_back(ids_j.at(i).get<int64_t>());
-                    attention_mask.push_back(mask_j.at(i).get<int64_t>());
-                }
-
-                json resp = call_warm_service(cfg, input_ids, attention_mask);
+                read_token_arrays(body, input_ids, attention_mask);
+
+                const auto call_start = std::chrono::steady_clock::now();
+                json resp = call_warm_service(port, input_ids, attention_mask, span.context());
+                warm_call_seconds.observe(
+                    std::chrono::duration<double>(std::chrono::steady_clock::now() - call_start).count());
+                if (!variant.name.empty()) resp["variant"] = variant.name;
+                res.set_header("X-Cold-Start", spawned ? "1" : "0");
                 res.set_content(resp.dump(), "application/json");
+            } catch (const BadVariant& e) {
+                res.status = 400;
+                json err{{"error", e.what()}};
+                res.set_content(err.dump(), "application/json");
             } catch (const std::exception& e) {
                 res.status = 500;
                 json err{{"error", e.what()}};
@@ -0,0 +1,223 @@
+#include <onnxruntime_cxx_api.h>
+
+#include "../junctiond/httplib.h"
+#include "../junctiond/json.hpp"
+#include "common/decode_scheduler.h"
+#include "common/model_cache.h"
+#include "common/model_registry.h"
+#include "common/op_profile.h"
+#include "common/phase_markers.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using json = nlohmann::json;
+
+namespace {
+struct Config {
+    std::string model_path;
+    std::string host = "0.0.0.0";
+    int port = 9100;
+    // With --registry, model_path comes from the registry entry for model/variant.
+    std::string registry_path;
+    std::string model_name = "gpt2";
+    std::string variant;  // empty: the registry's default
+    SchedulerConfig sched;
+    OpProfileConfig profile;
+    double profile_rate = 0.0;  // fraction of decode iterations ORT-profiled from startup
+};
+
+Config parse_args(int argc, char* argv[]) {
+    Config cfg;
+    // A decode iteration is a handful of small Runs, so batch more of them per trace.
+    cfg.profile.runs_per_file = 64;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if ((arg == "--model-path" || arg == "-m") && i + 1 < argc) {
+            cfg.model_path = argv[++i];
+        } else if ((arg == "--host" || arg == "-H") && i + 1 < argc) {
+            cfg.host = argv[++i];
+        } else if ((arg == "--port" || arg == "-p") && i + 1 < argc) {
+            cfg.port = std::stoi(argv[++i]);
+        } else if (arg == "--registry" && i + 1 < argc) {
+            cfg.registry_path = argv[++i];
+        } else if (arg == "--model" && i + 1 < argc) {
+            cfg.model_name = argv[++i];
+        } else if (arg == "--variant" && i + 1 < argc) {
+            cfg.variant = argv[++i];
+        } else if (arg == "--max-batch" && i + 1 < argc) {
+            cfg.sched.max_batch = std::stoll(argv[++i]);
+        } else if (arg == "--max-seq-len" && i + 1 < argc) {
+            cfg.sched.max_seq_len = std::stoll(argv[++i]);
+        } else if (arg == "--kv-blocks" && i + 1 < argc) {
+            cfg.sched.num_blocks = std::stoi(argv[++i]);
+        } else if (arg == "--block-tokens" && i + 1 < argc) {
+            cfg.sched.block_tokens = std::stoi(argv[++i]);
+        } else if (arg == "--prefix-cache-blocks" && i + 1 < argc) {
+            cfg.sched.prefix_cache_blocks = std::stoi(argv[++i]);
+        } else if (arg == "--profile-rate" && i + 1 < argc) {
+            cfg.profile_rate = std::stod(argv[++i]);
+        } else if (arg == "--profile-dir" && i + 1 < argc) {
+            cfg.profile.dir = argv[++i];
+        } else if (arg == "--profile-runs" && i + 1 < argc) {
+            cfg.profile.runs_per_file = std::stoi(argv[++i]);
+        } else {
+            throw std::runtime_error("Unknown or incomplete argument: " + arg);
+        }
+    }
+    if (!cfg.registry_path.empty()) {
+        ModelVariant v = ModelRegistry(cfg.registry_path).resolve(cfg.model_name, cfg.variant);
+        cfg.model_path = v.path;
+        cfg.variant = v.name;
+    }
+    if (cfg.model_path.empty()) {
+        throw std::runtime_error("--model-path or --registry is required");
+    }
+    return cfg;
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    phase_mark("static_init");
+    Config cfg;
+    try {
+        cfg = parse_args(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << "Usage: " << argv[0]
+                  << " (--model-path /path/to/gpt2.onnx | --registry registry.json [--model gpt2] [--variant int8])"
+                  << " [--host 0.0.0.0] [--port 9100]"
+                  << " [--max-batch 8] [--max-seq-len 1024] [--kv-blocks 512] [--block-tokens 16]"
+                  << " [--prefix-cache-blocks 128] [--profile-rate 0] [--profile-dir /tmp] [--profile-runs 64]\n"
+                  << "Error: " << e.what() << "\n";
+        return 1;
+    }
+
+    try {
+        Ort::Env env(ORT_LOGGING_LEVEL_WARNING, "gpt2_service");
+        phase_mark("env");
+        Ort::SessionOptions session_options;
+        configure_model_load(session_options, cfg.model_path);
+        Ort::Session session(env, cfg.model_path.c_str(), session_options);
+        phase_mark("session");
+
+        // ORT operator profiling of sampled decode iterations, adjusted via /profile.
+        // Declared first: the scheduler hands it its last trace when destroyed.
+        OpProfiler profiler("gpt2_service", cfg.profile);
+        profiler.set_rate(cfg.profile_rate);
+
+        // One scheduling thread owns the session and the paged KV cache; httplib
+        // workers only enqueue requests and wait on their futures.
+        DecodeScheduler scheduler(session, cfg.sched);
+        scheduler.enable_profiling(profiler, [&](const std::string& prefix) {
+            Ort::SessionOptions opts;
+            configure_model_load(opts, cfg.model_path);
+            opts.EnableProfiling(prefix.c_str());
+            return std::make_unique<Ort::Session>(env, cfg.model_path.c_str(), opts);
+        });
+        std::thread sched_thread([&] { scheduler.run(); });
+
+        httplib::Server svr;
+        svr.Post("/generate", [&](const httplib::Request& req, httplib::Response& res) {
+            try {
+                auto body = json::parse(req.body);
+                if (!body.contains("input_ids") || !body["input_ids"].is_array() || body["input_ids"].empty()) {
+                    res.status = 400;
+                    res.set_content("{\"error\":\"input_ids must be a non-empty array\"}", "application/json");
+                    return;
+                }
+
+                GenerationRequest greq;
+                greq.prompt = body["input_ids"].get<std::vector<int64_t>>();
+                if (body.contains("max_new_tokens")) greq.max_new_tokens = body["max_new_tokens"].get<int64_t>();
+                if (body.contains("eos_token_id")) greq.eos_token = body["eos_token_id"].get<int64_t>();
+                if (body.contains("temperature")) greq.params.temperature = body["temperature"].get<float>();
+                if (body.contains("top_k")) greq.params.top_k = body["top_k"].get<int64_t>();
+                if (body.contains("top_p")) greq.params.top_p = body["top_p"].get<float>();
+                if (body.contains("seed")) greq.seed = body["seed"].get<uint64_t>();
+                greq.profile = req.get_header_value(kOrtProfileHeader) == "1";
+
+                GenerationResult r = scheduler.submit(std::move(greq)).get();
+                if (!r.error.empty()) {
+                    res.status = 500;
+                    json err{{"error", r.error}};
+                    res.set_content(err.dump(), "application/json");
+                    return;
+                }
+
+                json resp{{"tokens", r.tokens},
+                          {"queue_ms", r.queue_ms},
+                          {"ttft_ms", r.ttft_ms},
+                          {"latency_ms", r.total_ms},
+                          {"preemptions", r.preemptions}};
+                res.set_content(resp.dump(), "application/json");
+            } catch (const std::exception& e) {
+                res.status = 500;
+                json err{{"error", e.what()}};
+                res.set_content(err.dump(), "application/json");
+            }
+        });
+
+        // Per-operator hotspots of the profiled iterations. GET ?top=N reports,
+        // POST ?rate=R sets the sampled fraction of iterations, DELETE clears.
+        svr.Get("/profile", [&](const httplib::Request& req, httplib::Response& res) {
+            size_t top = 20;
+            if (req.has_param("top")) top = std::strtoul(req.get_param_value("top").c_str(), nullptr, 10);
+            res.set_content(profiler.report(top), "application/json");
+        });
+        svr.Post("/profile", [&](const httplib::Request& req, httplib::Response& res) {
+            try {
+                profiler.set_rate(std::stod(req.get_param_value("rate")));
+            } catch (const std::exception&) {
+                res.status = 400;
+                res.set_content("{\"error\":\"rate must be a number between 0 and 1\"}", "application/json");
+                return;
+            }
+            json out{{"rate", profiler.rate()}};
+            res.set_content(out.dump(), "application/json");
+        });
+        svr.Delete("/profile", [&](const httplib::Request&, httplib::Response& res) {
+            profiler.reset();
+            res.set_content("{}", "application/json");
+        });
+
+        svr.Get("/stats", [&](const httplib::Request&, httplib::Response& res) {
+            SchedulerStats st = scheduler.stats();
+            json resp{{"submitted", st.submitted},
+                      {"completed", st.completed},
+                      {"generated_tokens", st.generated_tokens},
+                      {"decode_iterations", st.decode_iterations},
+                      {"avg_batch", st.decode_iterations ? double(st.batched_rows) / st.decode_iterations : 0.0},
+                      {"preemptions", st.preemptions},
+                      {"waiting", st.waiting},
+                      {"running", st.running},
+                      {"free_kv_blocks", st.free_blocks},
+                      {"prefix_cache", {
+                          {"lookups", st.prefix_lookups},
+                          {"hits", st.prefix_hits},
+                          {"hit_rate", st.prefix_lookups ? double(st.prefix_hits) / st.prefix_lookups : 0.0},
+                          {"token_hit_rate", st.prefix_lookup_tokens
+                               ? double(st.prefix_reused_tokens) / st.prefix_lookup_tokens : 0.0},
+                          {"reused_tokens", st.prefix_reused_tokens},
+                          {"cached_blocks", st.prefix_cached_blocks},
+                          {"evicted_blocks", st.prefix_evicted_blocks}}}};
+            res.set_content(resp.dump(), "application/json");
+        });
+
+        std::cout << "gpt2_service listening on " << cfg.host << ":" << cfg.port << " serving " << cfg.model_path
+                  << (cfg.variant.empty() ? "" : " (" + cfg.variant + ")")
+                  << " (sampling kernels: " << sampling::isa_name(sampling::active_isa()) << ")" << std::endl;
+        phase_mark("ready");
+        svr.listen(cfg.host, cfg.port);
+
+        scheduler.stop();
+        sched_thread.join();
+    } catch (const std::exception& e) {
+        std::cerr << "Fatal error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
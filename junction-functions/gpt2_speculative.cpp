@@ -0,0 +1,59 @@
+#include <onnxruntime_cxx_api.h>
+
+#include "common/model_cache.h"
+#include "common/speculative.h"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// GPT-2 generation with DistilGPT2 drafting. Compare the ms/token line against
+// gpt2_infer run with the same max_new_tokens.
+int main(int argc, char* argv[]) {
+    if (argc < 3 || argc > 6) {
+        std::cerr << "Usage: " << argv[0]
+                  << " distilgpt2.onnx gpt2.onnx [max_new_tokens] [initial_k] [temperature]\n";
+        return 1;
+    }
+
+    const char* draft_path = argv[1];
+    const char* target_path = argv[2];
+    const int64_t max_new_tokens = argc > 3 ? std::stoll(argv[3]) : 32;
+    SpeculativeConfig cfg;
+    if (argc > 4) cfg.initial_k = std::stoi(argv[4]);
+    sampling::SamplingParams params{0.0f};
+    if (argc > 5) params.temperature = std::stof(argv[5]);
+
+    Ort::Env env(ORT_LOGGING_LEVEL_WARNING, "gpt2_speculative");
+    Ort::SessionOptions draft_opts, target_opts;
+    configure_model_load(draft_opts, draft_path);
+    configure_model_load(target_opts, target_path);
+
+    try {
+        Ort::Session draft(env, draft_path, draft_opts);
+        Ort::Session target(env, target_path, target_opts);
+        SpeculativeDecoder decoder(draft, target, cfg);
+
+        std::vector<int64_t> prompt{50256};  // EOS token
+        std::mt19937_64 rng(0);
+
+        auto t0 = std::chrono::steady_clock::now();
+        std::vector<int64_t> generated = decoder.generate(prompt, max_new_tokens, params, rng, -1);
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - t0;
+
+        const SpeculativeStats& st = decoder.stats();
+        std::cout << "Generated ids:";
+        for (int64_t id : generated) std::cout << " " << id;
+        std::cout << "\nPer-token latency ms: " << elapsed.count() / generated.size() << "\n"
+                  << "Acceptance rate: " << st.acceptance_rate()
+                  << " (" << st.accepted << "/" << st.drafted << " drafted)\n"
+                  << "Tokens per GPT-2 pass: " << st.tokens_per_target_run() << "\n"
+                  << "Draft step ms: " << st.draft_ms << ", verify ms: " << st.verify_ms
+                  << ", final k: " << st.k << "\n";
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
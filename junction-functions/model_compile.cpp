@@ -0,0 +1,64 @@
+#include <onnxruntime_cxx_api.h>
+
+#include "common/model_cache.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Offline compile step: run ORT's graph optimizer over each export once and store
+// the result in the versioned model cache, so function binaries can load the
+// artifact with optimization disabled.
+int main(int argc, char* argv[]) {
+    const char* env_dir = std::getenv("JUNCTION_MODEL_CACHE");
+    std::string cache_dir = env_dir ? env_dir : "model_cache";
+    GraphOptimizationLevel level = GraphOptimizationLevel::ORT_ENABLE_ALL;
+    bool force = false;
+    std::vector<std::string> models;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--cache-dir" && i + 1 < argc) {
+            cache_dir = argv[++i];
+        } else if (arg == "--level" && i + 1 < argc) {
+            std::string name = argv[++i];
+            if (name == "basic") {
+                level = GraphOptimizationLevel::ORT_ENABLE_BASIC;
+            } else if (name == "extended") {
+                level = GraphOptimizationLevel::ORT_ENABLE_EXTENDED;
+            } else if (name == "all") {
+                level = GraphOptimizationLevel::ORT_ENABLE_ALL;
+            } else {
+                std::cerr << "Unknown --level " << name << "\n";
+                return 1;
+            }
+        } else if (arg == "--force") {
+            force = true;
+        } else {
+            models.push_back(arg);
+        }
+    }
+    if (models.empty()) {
+        std::cerr << "Usage: " << argv[0]
+                  << " model.onnx [model.onnx ...] [--cache-dir DIR] [--level basic|extended|all] [--force]\n"
+                  << "Cache dir defaults to $JUNCTION_MODEL_CACHE, then ./model_cache.\n";
+        return 1;
+    }
+
+    try {
+        Ort::Env env(ORT_LOGGING_LEVEL_WARNING, "model_compile");
+        for (const auto& model : models) {
+            auto t0 = std::chrono::steady_clock::now();
+            CompiledModel out = compile_optimized_model(env, model, cache_dir, level, force);
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+            std::cout << model << " -> " << out.path
+                      << (out.cached ? " (cached)" : " (compiled in " + std::to_string(ms) + " ms)") << "\n";
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,387 @@
+#include <onnxruntime_cxx_api.h>
+
+#include "../junctiond/httplib.h"
+#include "../junctiond/json.hpp"
+#include "common/model_registry.h"
+#include "common/shared_model.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using json = nlohmann::json;
+
+// Generic multi-model server: every model in a manifest gets a session in this one
+// process, all sharing one Ort::Env and its global intra-op thread pool, and is
+// served with the KServe v2 REST protocol:
+//
+//   GET  /v2/health/ready
+//   GET  /v2/models                    names and load state
+//   GET  /v2/models/<name>             input/output metadata
+//   POST /v2/models/<name>/infer       {"inputs":[{"name","shape","datatype","data"}]}
+//
+// Manifest (paths relative to the manifest file):
+//
+//   {"intra_op_threads": 4,
+//    "models": [{"name": "distilbert", "path": "distilbert.ort"},
+//               {"name": "distilbert-int8", "registry": "registry.json",
+//                "model": "distilbert", "variant": "int8", "lazy": true}]}
+//
+// A lazy model is mapped and compiled on its first request, so rarely used
+// models cost nothing until they are called.
+namespace {
+struct Config {
+    std::string manifest_path;
+    std::string host = "0.0.0.0";
+    int port = 9200;
+    int intra_op_threads = 0;  // 0: manifest value, else one per core
+};
+
+Config parse_args(int argc, char* argv[]) {
+    Config cfg;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--manifest" && i + 1 < argc) {
+            cfg.manifest_path = argv[++i];
+        } else if ((arg == "--host" || arg == "-H") && i + 1 < argc) {
+            cfg.host = argv[++i];
+        } else if ((arg == "--port" || arg == "-p") && i + 1 < argc) {
+            cfg.port = std::stoi(argv[++i]);
+        } else if (arg == "--intra-op-threads" && i + 1 < argc) {
+            cfg.intra_op_threads = std::stoi(argv[++i]);
+        } else {
+            throw std::runtime_error("Unknown or incomplete argument: " + arg);
+        }
+    }
+    if (cfg.manifest_path.empty()) {
+        throw std::runtime_error("--manifest is required");
+    }
+    return cfg;
+}
+
+// Thrown for malformed requests; reported as a 400.
+struct BadRequest : std::runtime_error {
+    using std::runtime_error::runtime_error;
+};
+
+const char* datatype_name(ONNXTensorElementDataType t) {
+    switch (t) {
+        case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT: return "FP32";
+        case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64: return "INT64";
+        case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT32: return "INT32";
+        case ONNX_TENSOR_ELEMENT_DATA_TYPE_BOOL: return "BOOL";
+        default: return "UNSUPPORTED";
+    }
+}
+
+struct TensorSpec {
+    std::string name;
+    ONNXTensorElementDataType type;
+    std::vector<int64_t> shape;  // -1 for dynamic dimensions
+};
+
+struct Model {
+    std::string name;
+    std::string path;
+    bool lazy = false;
+
+    std::mutex load_mtx;
+    std::atomic<bool> loaded{false};
+    std::unique_ptr<SharedModel> mapping;
+    std::unique_ptr<Ort::Session> session;
+    std::vector<TensorSpec> inputs, outputs;
+    double load_ms = 0.0;
+    std::atomic<uint64_t> requests{0};
+};
+
+class ModelServer {
+public:
+    ModelServer(const std::string& manifest_path, int intra_op_threads) {
+        std::ifstream in(manifest_path);
+        if (!in) throw std::runtime_error("cannot open manifest " + manifest_path);
+        const json manifest = json::parse(in);
+        const std::filesystem::path base = std::filesystem::path(manifest_path).parent_path();
+
+        if (intra_op_threads <= 0) intra_op_threads = manifest.value("intra_op_threads", 0);
+        if (intra_op_threads <= 0) intra_op_threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        threads_ = intra_op_threads;
+
+        // One pool for every session: N models cost one set of worker threads, not N.
+        Ort::ThreadingOptions tp;
+        tp.SetGlobalIntraOpNumThreads(intra_op_threads);
+        tp.SetGlobalInterOpNumThreads(1);
+        env_ = std::make_unique<Ort::Env>(tp, ORT_LOGGING_LEVEL_WARNING, "model_server");
+
+        for (const auto& entry : manifest.at("models")) {
+            auto m = std::make_unique<Model>();
+            m->name = entry.at("name").get<std::string>();
+            if (entry.contains("registry")) {
+                std::filesystem::path reg = entry["registry"].get<std::string>();
+                if (reg.is_relative()) reg = base / reg;
+                m->path = ModelRegistry(reg.string())
+                              .resolve(entry.value("model", m->name), entry.value("variant", std::string()))
+                              .path;
+            } else {
+                std::filesystem::path p = entry.at("path").get<std::string>();
+                m->path = (p.is_relative() ? base / p : p).string();
+            }
+            m->lazy = entry.value("lazy", false);
+            if (models_.count(m->name)) throw std::runtime_error("duplicate model name " + m->name);
+            models_[m->name] = std::move(m);
+        }
+        for (auto& kv : models_) {
+            if (!kv.second->lazy) load(*kv.second);
+        }
+    }
+
+    int threads() const { return threads_; }
+
+    // nullptr for names not in the manifest.
+    Model* find(const std::string& name) {
+        auto it = models_.find(name);
+        return it == models_.end() ? nullptr : it->second.get();
+    }
+
+    void ensure_loaded(Model& m) {
+        if (!m.loaded.load(std::memory_order_acquire)) load(m);
+    }
+
+    json list() const {
+        json arr = json::array();
+        for (const auto& kv : models_) {
+            const Model& m = *kv.second;
+            json e{{"name", m.name},
+                   {"path", m.path},
+                   {"state", m.loaded.load() ? "READY" : "UNLOADED"},
+                   {"requests", m.requests.load()}};
+            if (m.loaded.load()) e["load_ms"] = m.load_ms;
+            arr.push_back(std::move(e));
+        }
+        return arr;
+    }
+
+    json metadata(Model& m) {
+        ensure_loaded(m);
+        auto specs = [](const std::vector<TensorSpec>& v) {
+            json arr = json::array();
+            for (const auto& s : v) arr.push_back({{"name", s.name}, {"datatype", datatype_name(s.type)}, {"shape", s.shape}});
+            return arr;
+        };
+        return {{"name", m.name}, {"platform", "onnxruntime_onnx"}, {"inputs", specs(m.inputs)}, {"outputs", specs(m.outputs)}};
+    }
+
+    json infer(Model& m, const json& body) {
+        ensure_loaded(m);
+        m.requests.fetch_add(1, std::memory_order_relaxed);
+        if (!body.contains("inputs") || !body["inputs"].is_array()) throw BadRequest("\"inputs\" array required");
+
+        Ort::MemoryInfo mem = Ort::MemoryInfo::CreateCpu(OrtDeviceAllocator, OrtMemTypeCPU);
+        // Tensors below point into these; keep them alive through Run().
+        std::vector<std::vector<int64_t>> i64;
+        std::vector<std::vector<int32_t>> i32;
+        std::vector<std::vector<float>> f32;
+        i64.reserve(body["inputs"].size());
+        i32.reserve(body["inputs"].size());
+        f32.reserve(body["inputs"].size());
+
+        std::vector<std::string> in_names;
+        std::vector<Ort::Value> in_values;
+        for (const auto& in : body["inputs"]) {
+            if (!in.contains("name") || !in.contains("shape") || !in.contains("data")) {
+                throw BadRequest("each input needs name, shape and data");
+            }
+            const std::string name = in["name"].get<std::string>();
+            const auto spec = std::find_if(m.inputs.begin(), m.inputs.end(), [&](const TensorSpec& s) { return s.name == name; });
+            if (spec == m.inputs.end()) throw BadRequest("model " + m.name + " has no input " + name);
+            std::vector<int64_t> shape = in["shape"].get<std::vector<int64_t>>();
+            int64_t count = 1;
+            for (int64_t d : shape) {
+                if (d < 0) throw BadRequest("negative dimension in " + name);
+                count *= d;
+            }
+            json flat = json::array();
+            flatten(in["data"], flat);
+            if (static_cast<int64_t>(flat.size()) != count) {
+                throw BadRequest(name + ": shape holds " + std::to_string(count) + " elements, data has " +
+                                 std::to_string(flat.size()));
+            }
+
+            switch (spec->type) {
+                case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64:
+                    i64.push_back(flat.get<std::vector<int64_t>>());
+                    in_values.push_back(Ort::Value::CreateTensor<int64_t>(mem, i64.back().data(), i64.back().size(),
+                                                                          shape.data(), shape.size()));
+                    break;
+                case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT32:
+                    i32.push_back(flat.get<std::vector<int32_t>>());
+                    in_values.push_back(Ort::Value::CreateTensor<int32_t>(mem, i32.back().data(), i32.back().size(),
+                                                                          shape.data(), shape.size()));
+                    break;
+                case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT:
+                    f32.push_back(flat.get<std::vector<float>>());
+                    in_values.push_back(Ort::Value::CreateTensor<float>(mem, f32.back().data(), f32.back().size(),
+                                                                        shape.data(), shape.size()));
+                    break;
+                default:
+                    throw BadRequest(std::string("input ") + name + " has unsupported type " + datatype_name(spec->type));
+            }
+            in_names.push_back(name);
+        }
+
+        std::vector<std::string> out_names;
+        if (body.contains("outputs") && body["outputs"].is_array()) {
+            for (const auto& o : body["outputs"]) out_names.push_back(o.at("name").get<std::string>());
+        } else {
+            for (const auto& s : m.outputs) out_names.push_back(s.name);
+        }
+
+        std::vector<const char*> in_ptrs, out_ptrs;
+        for (const auto& n : in_names) in_ptrs.push_back(n.c_str());
+        for (const auto& n : out_names) out_ptrs.push_back(n.c_str());
+        std::vector<Ort::Value> results = m.session->Run(Ort::RunOptions{nullptr}, in_ptrs.data(), in_values.data(),
+                                                         in_values.size(), out_ptrs.data(), out_ptrs.size());
+
+        json outputs = json::array();
+        for (size_t i = 0; i < results.size(); ++i) {
+            auto info = results[i].GetTensorTypeAndShapeInfo();
+            const size_t n = info.GetElementCount();
+            json o{{"name", out_names[i]}, {"datatype", datatype_name(info.GetElementType())}, {"shape", info.GetShape()}};
+            switch (info.GetElementType()) {
+                case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT: {
+                    const float* p = results[i].GetTensorData<float>();
+                    o["data"] = std::vector<float>(p, p + n);
+                    break;
+                }
+                case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64: {
+                    const int64_t* p = results[i].GetTensorData<int64_t>();
+                    o["data"] = std::vector<int64_t>(p, p + n);
+                    break;
+                }
+                case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT32: {
+                    const int32_t* p = results[i].GetTensorData<int32_t>();
+                    o["data"] = std::vector<int32_t>(p, p + n);
+                    break;
+                }
+                default:
+                    throw std::runtime_error("output " + out_names[i] + " has an unsupported type");
+            }
+            outputs.push_back(std::move(o));
+        }
+        json resp{{"model_name", m.name}, {"outputs", std::move(outputs)}};
+        if (body.contains("id")) resp["id"] = body["id"];
+        return resp;
+    }
+
+private:
+    static void flatten(const json& data, json& out) {
+        if (!data.is_array()) {
+            out.push_back(data);
+            return;
+        }
+        for (const auto& d : data) flatten(d, out);
+    }
+
+    void load(Model& m) {
+        std::lock_guard<std::mutex> lk(m.load_mtx);
+        if (m.loaded.load(std::memory_order_relaxed)) return;
+
+        auto t0 = std::chrono::steady_clock::now();
+        Ort::SessionOptions opts;
+        opts.DisablePerSessionThreads();
+        m.mapping = SharedModel::map_file(m.path);
+        m.session = std::make_unique<Ort::Session>(create_shared_session(*env_, *m.mapping, opts, &prepacked_));
+
+        Ort::AllocatorWithDefaultOptions alloc;
+        auto spec = [&](Ort::TypeInfo info, std::string name) {
+            auto t = info.GetTensorTypeAndShapeInfo();
+            return TensorSpec{std::move(name), t.GetElementType(), t.GetShape()};
+        };
+        for (size_t i = 0; i < m.session->GetInputCount(); ++i) {
+            m.inputs.push_back(spec(m.session->GetInputTypeInfo(i), m.session->GetInputNameAllocated(i, alloc).get()));
+        }
+        for (size_t i = 0; i < m.session->GetOutputCount(); ++i) {
+            m.outputs.push_back(spec(m.session->GetOutputTypeInfo(i), m.session->GetOutputNameAllocated(i, alloc).get()));
+        }
+        m.load_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+        m.loaded.store(true, std::memory_order_release);
+        std::cout << "model_server: loaded " << m.name << " from " << m.path << " in " << m.load_ms << " ms\n";
+    }
+
+    int threads_ = 1;
+    std::unique_ptr<Ort::Env> env_;
+    PrepackedWeights prepacked_;
+    std::map<std::string, std::unique_ptr<Model>> models_;
+};
+
+void send_error(httplib::Response& res, int status, const std::string& msg) {
+    res.status = status;
+    json err{{"error", msg}};
+    res.set_content(err.dump(), "application/json");
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    Config cfg;
+    try {
+        cfg = parse_args(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << "Usage: " << argv[0]
+                  << " --manifest models.json [--host 0.0.0.0] [--port 9200] [--intra-op-threads N]\n"
+                  << "Error: " << e.what() << "\n";
+        return 1;
+    }
+
+    try {
+        ModelServer server(cfg.manifest_path, cfg.intra_op_threads);
+
+        httplib::Server svr;
+        svr.Get("/v2/health/ready", [&](const httplib::Request&, httplib::Response& res) {
+            res.set_content("{\"ready\":true}", "application/json");
+        });
+        svr.Get("/v2/models", [&](const httplib::Request&, httplib::Response& res) {
+            res.set_content(json{{"models", server.list()}}.dump(), "application/json");
+        });
+        svr.Get(R"(/v2/models/([^/]+))", [&](const httplib::Request& req, httplib::Response& res) {
+            Model* m = server.find(req.matches[1]);
+            if (!m) return send_error(res, 404, "unknown model " + std::string(req.matches[1]));
+            try {
+                res.set_content(server.metadata(*m).dump(), "application/json");
+            } catch (const std::exception& e) {
+                send_error(res, 500, e.what());
+            }
+        });
+        svr.Post(R"(/v2/models/([^/]+)/infer)", [&](const httplib::Request& req, httplib::Response& res) {
+            Model* m = server.find(req.matches[1]);
+            if (!m) return send_error(res, 404, "unknown model " + std::string(req.matches[1]));
+            try {
+                res.set_content(server.infer(*m, json::parse(req.body)).dump(), "application/json");
+            } catch (const BadRequest& e) {
+                send_error(res, 400, e.what());
+            } catch (const json::exception& e) {
+                send_error(res, 400, e.what());
+            } catch (const Ort::Exception& e) {
+                send_error(res, e.GetOrtErrorCode() == ORT_INVALID_ARGUMENT ? 400 : 500, e.what());
+            } catch (const std::exception& e) {
+                send_error(res, 500, e.what());
+            }
+        });
+
+        std::cout << "model_server listening on " << cfg.host << ":" << cfg.port << " ("
+                  << server.threads() << " shared intra-op threads)\n";
+        svr.listen(cfg.host, cfg.port);
+    } catch (const std::exception& e) {
+        std::cerr << "Fatal error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,68 @@
+#include "cold_start_trace.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <sstream>
+
+int64_t phaseNow() {
+    timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+void parsePhaseLines(std::string &buffer, std::vector<PhaseMark> &marks) {
+    size_t start = 0;
+    size_t end;
+    while ((end = buffer.find('\n', start)) != std::string::npos) {
+        std::istringstream line(buffer.substr(start, end - start));
+        std::string tag, name;
+        long long ns = 0;
+        if (line >> tag >> name >> ns && tag == "PHASE") {
+            marks.push_back({name, "instance", static_cast<int64_t>(ns)});
+        }
+        start = end + 1;
+    }
+    buffer.erase(0, start);
+}
+
+std::vector<PhaseMark> mergeTimeline(std::vector<PhaseMark> marks) {
+    std::stable_sort(marks.begin(), marks.end(),
+                     [](const PhaseMark &a, const PhaseMark &b) { return a.ns < b.ns; });
+    return marks;
+}
+
+namespace {
+std::string escapeJson(const std::string &s) {
+    std::string out;
+    for (char c : s) {
+        if (c == '"' || c == '\\') out += '\\';
+        if (static_cast<unsigned char>(c) >= 0x20) out += c;
+    }
+    return out;
+}
+}  // namespace
+
+std::string chromeTraceJson(const std::string &name, int pid, const std::vector<PhaseMark> &timeline) {
+    std::ostringstream os;
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    os << "{\"ph\":\"M\",\"name\":\"process_name\",\"pid\":" << pid << ",\"tid\":0,\"args\":{\"name\":\""
+       << escapeJson(name) << "\"}}";
+    os << ",{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":" << pid << ",\"tid\":0,\"args\":{\"name\":\"junctiond\"}}";
+    os << ",{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":" << pid << ",\"tid\":1,\"args\":{\"name\":\"instance\"}}";
+    if (!timeline.empty()) {
+        const int64_t origin = timeline.front().ns;
+        for (size_t i = 1; i < timeline.size(); ++i) {
+            const PhaseMark &m = timeline[i];
+            char event[256];
+            std::snprintf(event, sizeof(event),
+                          ",{\"ph\":\"X\",\"cat\":\"cold_start\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,"
+                          "\"name\":\"",
+                          pid, m.source == "instance" ? 1 : 0, (timeline[i - 1].ns - origin) / 1e3,
+                          (m.ns - timeline[i - 1].ns) / 1e3);
+            os << event << escapeJson(m.name) << "\"}";
+        }
+    }
+    os << "]}";
+    return os.str();
+}
@@ -0,0 +1,32 @@
+#ifndef COLD_START_TRACE_H
+#define COLD_START_TRACE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// One point on a cold-start timeline. A mark ends the phase it names; the phase
+// began at the previous mark (see junction-functions/common/phase_markers.h for
+// the instance side).
+struct PhaseMark {
+    std::string name;
+    std::string source;  // "junctiond", "gateway" (its cold path) or "instance"
+    int64_t ns;          // CLOCK_REALTIME
+};
+
+// Wall-clock nanoseconds, the clock instances stamp their marks with.
+int64_t phaseNow();
+
+// Parse complete "PHASE <name> <ns>" lines out of `buffer` into `marks` (as
+// source "instance"), leaving any trailing partial line in `buffer`. Lines that
+// are not marks are dropped.
+void parsePhaseLines(std::string &buffer, std::vector<PhaseMark> &marks);
+
+// Marks ordered by time, as one timeline.
+std::vector<PhaseMark> mergeTimeline(std::vector<PhaseMark> marks);
+
+// Chrome trace JSON (chrome://tracing, Perfetto) for one start: every phase is a
+// complete event on the junctiond or the instance track, timed from the first mark.
+std::string chromeTraceJson(const std::string &name, int pid, const std::vector<PhaseMark> &timeline);
+
+#endif // COLD_START_TRACE_H
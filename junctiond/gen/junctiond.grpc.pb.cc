@@ -15,7 +15,7 @@
 #include <grpcpp/support/method_handler.h>
 #include <grpcpp/impl/rpc_service_method.h>
 #include <grpcpp/support/server_callback.h>
-#include <grpcpp/impl/server_callback_handlers.h>
+#include <grpcpp/impl/codegen/server_callback_handlers.h>
 #include <grpcpp/server_context.h>
 #include <grpcpp/impl/service_type.h>
 #include <grpcpp/support/sync_stream.h>
@@ -25,6 +25,7 @@ static const char* JunctionService_method_names[] = {
   "/junctiond.JunctionService/Spawn",
   "/junctiond.JunctionService/Remove",
   "/junctiond.JunctionService/List",
+  "/junctiond.JunctionService/GetMetrics",
 };
 
 std::unique_ptr< JunctionService::Stub> JunctionService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -37,6 +38,7 @@ JunctionService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& ch
   : channel_(channel), rpcmethod_Spawn_(JunctionService_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_Remove_(JunctionService_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_List_(JunctionService_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetMetrics_(JunctionService_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status JunctionService::Stub::Spawn(::grpc::ClientContext* context, const ::junctiond::FunctionData& request, ::junctiond::StatusReply* response) {
@@ -108,6 +110,29 @@ void JunctionService::Stub::async::List(::grpc::ClientContext* context, const ::
   return result;
 }
 
+::grpc::Status JunctionService::Stub::GetMetrics(::grpc::ClientContext* context, const ::junctiond::Empty& request, ::junctiond::MetricsReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::junctiond::Empty, ::junctiond::MetricsReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetMetrics_, context, request, response);
+}
+
+void JunctionService::Stub::async::GetMetrics(::grpc::ClientContext* context, const ::junctiond::Empty* request, ::junctiond::MetricsReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::junctiond::Empty, ::junctiond::MetricsReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetMetrics_, context, request, response, std::move(f));
+}
+
+void JunctionService::Stub::async::GetMetrics(::grpc::ClientContext* context, const ::junctiond::Empty* request, ::junctiond::MetricsReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetMetrics_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::junctiond::MetricsReply>* JunctionService::Stub::PrepareAsyncGetMetricsRaw(::grpc::ClientContext* context, const ::junctiond::Empty& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::junctiond::MetricsReply, ::junctiond::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetMetrics_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::junctiond::MetricsReply>* JunctionService::Stub::AsyncGetMetricsRaw(::grpc::ClientContext* context, const ::junctiond::Empty& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetMetricsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 JunctionService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       JunctionService_method_names[0],
@@ -139,6 +164,16 @@ JunctionService::Service::Service() {
              ::junctiond::FunctionList* resp) {
                return service->List(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      JunctionService_method_names[3],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< JunctionService::Service, ::junctiond::Empty, ::junctiond::MetricsReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](JunctionService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::junctiond::Empty* req,
+             ::junctiond::MetricsReply* resp) {
+               return service->GetMetrics(ctx, req, resp);
+             }, this)));
 }
 
 JunctionService::Service::~Service() {
@@ -165,6 +200,13 @@ JunctionService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status JunctionService::Service::GetMetrics(::grpc::ServerContext* context, const ::junctiond::Empty* request, ::junctiond::MetricsReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace junctiond
 
@@ -15,10 +15,10 @@
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/support/message_allocator.h>
 #include <grpcpp/support/method_handler.h>
-#include <grpcpp/impl/proto_utils.h>
+#include <grpcpp/impl/codegen/proto_utils.h>
 #include <grpcpp/impl/rpc_method.h>
 #include <grpcpp/support/server_callback.h>
-#include <grpcpp/impl/server_callback_handlers.h>
+#include <grpcpp/impl/codegen/server_callback_handlers.h>
 #include <grpcpp/server_context.h>
 #include <grpcpp/impl/service_type.h>
 #include <grpcpp/support/status.h>
@@ -62,6 +62,14 @@ class JunctionService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::junctiond::FunctionList>> PrepareAsyncList(::grpc::ClientContext* context, const ::junctiond::Empty& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::junctiond::FunctionList>>(PrepareAsyncListRaw(context, request, cq));
     }
+    // Metrics in the Prometheus text format, as the gateway serves on /metrics
+    virtual ::grpc::Status GetMetrics(::grpc::ClientContext* context, const ::junctiond::Empty& request, ::junctiond::MetricsReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::junctiond::MetricsReply>> AsyncGetMetrics(::grpc::ClientContext* context, const ::junctiond::Empty& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::junctiond::MetricsReply>>(AsyncGetMetricsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::junctiond::MetricsReply>> PrepareAsyncGetMetrics(::grpc::ClientContext* context, const ::junctiond::Empty& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::junctiond::MetricsReply>>(PrepareAsyncGetMetricsRaw(context, request, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
@@ -74,6 +82,9 @@ class JunctionService final {
       // List all currently running instances (maps to JunctionD::list)
       virtual void List(::grpc::ClientContext* context, const ::junctiond::Empty* request, ::junctiond::FunctionList* response, std::function<void(::grpc::Status)>) = 0;
       virtual void List(::grpc::ClientContext* context, const ::junctiond::Empty* request, ::junctiond::FunctionList* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Metrics in the Prometheus text format, as the gateway serves on /metrics
+      virtual void GetMetrics(::grpc::ClientContext* context, const ::junctiond::Empty* request, ::junctiond::MetricsReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetMetrics(::grpc::ClientContext* context, const ::junctiond::Empty* request, ::junctiond::MetricsReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -85,6 +96,8 @@ class JunctionService final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::junctiond::StatusReply>* PrepareAsyncRemoveRaw(::grpc::ClientContext* context, const ::junctiond::FunctionName& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::junctiond::FunctionList>* AsyncListRaw(::grpc::ClientContext* context, const ::junctiond::Empty& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::junctiond::FunctionList>* PrepareAsyncListRaw(::grpc::ClientContext* context, const ::junctiond::Empty& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::junctiond::MetricsReply>* AsyncGetMetricsRaw(::grpc::ClientContext* context, const ::junctiond::Empty& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::junctiond::MetricsReply>* PrepareAsyncGetMetricsRaw(::grpc::ClientContext* context, const ::junctiond::Empty& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -110,6 +123,13 @@ class JunctionService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::junctiond::FunctionList>> PrepareAsyncList(::grpc::ClientContext* context, const ::junctiond::Empty& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::junctiond::FunctionList>>(PrepareAsyncListRaw(context, request, cq));
     }
+    ::grpc::Status GetMetrics(::grpc::ClientContext* context, const ::junctiond::Empty& request, ::junctiond::MetricsReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::junctiond::MetricsReply>> AsyncGetMetrics(::grpc::ClientContext* context, const ::junctiond::Empty& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::junctiond::MetricsReply>>(AsyncGetMetricsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::junctiond::MetricsReply>> PrepareAsyncGetMetrics(::grpc::ClientContext* context, const ::junctiond::Empty& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::junctiond::MetricsReply>>(PrepareAsyncGetMetricsRaw(context, request, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
@@ -119,6 +139,8 @@ class JunctionService final {
       void Remove(::grpc::ClientContext* context, const ::junctiond::FunctionName* request, ::junctiond::StatusReply* response, ::grpc::ClientUnaryReactor* reactor) override;
       void List(::grpc::ClientContext* context, const ::junctiond::Empty* request, ::junctiond::FunctionList* response, std::function<void(::grpc::Status)>) override;
       void List(::grpc::ClientContext* context, const ::junctiond::Empty* request, ::junctiond::FunctionList* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void GetMetrics(::grpc::ClientContext* context, const ::junctiond::Empty* request, ::junctiond::MetricsReply* response, std::function<void(::grpc::Status)>) override;
+      void GetMetrics(::grpc::ClientContext* context, const ::junctiond::Empty* request, ::junctiond::MetricsReply* response, ::grpc::ClientUnaryReactor* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -136,9 +158,12 @@ class JunctionService final {
     ::grpc::ClientAsyncResponseReader< ::junctiond::StatusReply>* PrepareAsyncRemoveRaw(::grpc::ClientContext* context, const ::junctiond::FunctionName& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::junctiond::FunctionList>* AsyncListRaw(::grpc::ClientContext* context, const ::junctiond::Empty& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::junctiond::FunctionList>* PrepareAsyncListRaw(::grpc::ClientContext* context, const ::junctiond::Empty& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::junctiond::MetricsReply>* AsyncGetMetricsRaw(::grpc::ClientContext* context, const ::junctiond::Empty& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::junctiond::MetricsReply>* PrepareAsyncGetMetricsRaw(::grpc::ClientContext* context, const ::junctiond::Empty& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_Spawn_;
     const ::grpc::internal::RpcMethod rpcmethod_Remove_;
     const ::grpc::internal::RpcMethod rpcmethod_List_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetMetrics_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -152,6 +177,8 @@ class JunctionService final {
     virtual ::grpc::Status Remove(::grpc::ServerContext* context, const ::junctiond::FunctionName* request, ::junctiond::StatusReply* response);
     // List all currently running instances (maps to JunctionD::list)
     virtual ::grpc::Status List(::grpc::ServerContext* context, const ::junctiond::Empty* request, ::junctiond::FunctionList* response);
+    // Metrics in the Prometheus text format, as the gateway serves on /metrics
+    virtual ::grpc::Status GetMetrics(::grpc::ServerContext* context, const ::junctiond::Empty* request, ::junctiond::MetricsReply* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_Spawn : public BaseClass {
@@ -213,7 +240,27 @@ class JunctionService final {
       ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_Spawn<WithAsyncMethod_Remove<WithAsyncMethod_List<Service > > > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodAsync(3);
+    }
+    ~WithAsyncMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* /*context*/, const ::junctiond::Empty* /*request*/, ::junctiond::MetricsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetMetrics(::grpc::ServerContext* context, ::junctiond::Empty* request, ::grpc::ServerAsyncResponseWriter< ::junctiond::MetricsReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_Spawn<WithAsyncMethod_Remove<WithAsyncMethod_List<WithAsyncMethod_GetMetrics<Service > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_Spawn : public BaseClass {
    private:
@@ -295,7 +342,34 @@ class JunctionService final {
     virtual ::grpc::ServerUnaryReactor* List(
       ::grpc::CallbackServerContext* /*context*/, const ::junctiond::Empty* /*request*/, ::junctiond::FunctionList* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_Spawn<WithCallbackMethod_Remove<WithCallbackMethod_List<Service > > > CallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::junctiond::Empty, ::junctiond::MetricsReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::junctiond::Empty* request, ::junctiond::MetricsReply* response) { return this->GetMetrics(context, request, response); }));}
+    void SetMessageAllocatorFor_GetMetrics(
+        ::grpc::MessageAllocator< ::junctiond::Empty, ::junctiond::MetricsReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::junctiond::Empty, ::junctiond::MetricsReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* /*context*/, const ::junctiond::Empty* /*request*/, ::junctiond::MetricsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetMetrics(
+      ::grpc::CallbackServerContext* /*context*/, const ::junctiond::Empty* /*request*/, ::junctiond::MetricsReply* /*response*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_Spawn<WithCallbackMethod_Remove<WithCallbackMethod_List<WithCallbackMethod_GetMetrics<Service > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_Spawn : public BaseClass {
@@ -349,6 +423,23 @@ class JunctionService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodGeneric(3);
+    }
+    ~WithGenericMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* /*context*/, const ::junctiond::Empty* /*request*/, ::junctiond::MetricsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_Spawn : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -409,6 +500,26 @@ class JunctionService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodRaw(3);
+    }
+    ~WithRawMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* /*context*/, const ::junctiond::Empty* /*request*/, ::junctiond::MetricsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetMetrics(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_Spawn : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -475,6 +586,28 @@ class JunctionService final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodRawCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetMetrics(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* /*context*/, const ::junctiond::Empty* /*request*/, ::junctiond::MetricsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetMetrics(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_Spawn : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -555,9 +688,36 @@ class JunctionService final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedList(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::junctiond::Empty,::junctiond::FunctionList>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_Spawn<WithStreamedUnaryMethod_Remove<WithStreamedUnaryMethod_List<Service > > > StreamedUnaryService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodStreamed(3,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::junctiond::Empty, ::junctiond::MetricsReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::junctiond::Empty, ::junctiond::MetricsReply>* streamer) {
+                       return this->StreamedGetMetrics(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* /*context*/, const ::junctiond::Empty* /*request*/, ::junctiond::MetricsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetMetrics(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::junctiond::Empty,::junctiond::MetricsReply>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_Spawn<WithStreamedUnaryMethod_Remove<WithStreamedUnaryMethod_List<WithStreamedUnaryMethod_GetMetrics<Service > > > > StreamedUnaryService;
   typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_Spawn<WithStreamedUnaryMethod_Remove<WithStreamedUnaryMethod_List<Service > > > StreamedService;
+  typedef WithStreamedUnaryMethod_Spawn<WithStreamedUnaryMethod_Remove<WithStreamedUnaryMethod_List<WithStreamedUnaryMethod_GetMetrics<Service > > > > StreamedService;
 };
 
 }  // namespace junctiond
@@ -1,316 +1,296 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: junctiond.proto
-// Protobuf C++ Version: 5.26.1
 
 #include "junctiond.pb.h"
 
 #include <algorithm>
-#include "google/protobuf/io/coded_stream.h"
-#include "google/protobuf/extension_set.h"
-#include "google/protobuf/wire_format_lite.h"
-#include "google/protobuf/descriptor.h"
-#include "google/protobuf/generated_message_reflection.h"
-#include "google/protobuf/reflection_ops.h"
-#include "google/protobuf/wire_format.h"
-#include "google/protobuf/generated_message_tctable_impl.h"
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-// Must be included last.
-#include "google/protobuf/port_def.inc"
 PROTOBUF_PRAGMA_INIT_SEG
-namespace _pb = ::google::protobuf;
-namespace _pbi = ::google::protobuf::internal;
-namespace _fl = ::google::protobuf::internal::field_layout;
-namespace junctiond {
 
-inline constexpr StatusReply::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : message_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        success_{false},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR StatusReply::StatusReply(::_pbi::ConstantInitialized)
-    : _impl_(::_pbi::ConstantInitialized()) {}
-struct StatusReplyDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR StatusReplyDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~StatusReplyDefaultTypeInternal() {}
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace junctiond {
+PROTOBUF_CONSTEXPR Empty::Empty(
+    ::_pbi::ConstantInitialized) {}
+struct EmptyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EmptyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EmptyDefaultTypeInternal() {}
   union {
-    StatusReply _instance;
+    Empty _instance;
   };
 };
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatusReplyDefaultTypeInternal _StatusReply_default_instance_;
-
-inline constexpr FunctionStatus::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : name_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        running_{false},
-        pid_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR FunctionStatus::FunctionStatus(::_pbi::ConstantInitialized)
-    : _impl_(::_pbi::ConstantInitialized()) {}
-struct FunctionStatusDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR FunctionStatusDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~FunctionStatusDefaultTypeInternal() {}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EmptyDefaultTypeInternal _Empty_default_instance_;
+PROTOBUF_CONSTEXPR FunctionData::FunctionData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.rootfs_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.execpath_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.args_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cpu_)*/0
+  , /*decltype(_impl_.memorymb_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FunctionDataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FunctionDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FunctionDataDefaultTypeInternal() {}
   union {
-    FunctionStatus _instance;
+    FunctionData _instance;
   };
 };
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FunctionStatusDefaultTypeInternal _FunctionStatus_default_instance_;
-
-inline constexpr FunctionName::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : name_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR FunctionName::FunctionName(::_pbi::ConstantInitialized)
-    : _impl_(::_pbi::ConstantInitialized()) {}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FunctionDataDefaultTypeInternal _FunctionData_default_instance_;
+PROTOBUF_CONSTEXPR FunctionName::FunctionName(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct FunctionNameDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR FunctionNameDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR FunctionNameDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~FunctionNameDefaultTypeInternal() {}
   union {
     FunctionName _instance;
   };
 };
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FunctionNameDefaultTypeInternal _FunctionName_default_instance_;
-
-inline constexpr FunctionData::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : name_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        rootfs_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        execpath_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        args_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        cpu_{0},
-        memorymb_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR FunctionData::FunctionData(::_pbi::ConstantInitialized)
-    : _impl_(::_pbi::ConstantInitialized()) {}
-struct FunctionDataDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR FunctionDataDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~FunctionDataDefaultTypeInternal() {}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FunctionNameDefaultTypeInternal _FunctionName_default_instance_;
+PROTOBUF_CONSTEXPR FunctionStatus::FunctionStatus(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.memory_)*/nullptr
+  , /*decltype(_impl_.running_)*/false
+  , /*decltype(_impl_.pid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FunctionStatusDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FunctionStatusDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FunctionStatusDefaultTypeInternal() {}
   union {
-    FunctionData _instance;
+    FunctionStatus _instance;
   };
 };
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FunctionDataDefaultTypeInternal _FunctionData_default_instance_;
-      template <typename>
-PROTOBUF_CONSTEXPR Empty::Empty(::_pbi::ConstantInitialized) {}
-struct EmptyDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR EmptyDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~EmptyDefaultTypeInternal() {}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FunctionStatusDefaultTypeInternal _FunctionStatus_default_instance_;
+PROTOBUF_CONSTEXPR MemoryFootprint::MemoryFootprint(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rss_kb_)*/uint64_t{0u}
+  , /*decltype(_impl_.pss_kb_)*/uint64_t{0u}
+  , /*decltype(_impl_.shared_kb_)*/uint64_t{0u}
+  , /*decltype(_impl_.private_dirty_kb_)*/uint64_t{0u}
+  , /*decltype(_impl_.swap_kb_)*/uint64_t{0u}
+  , /*decltype(_impl_.sampled_unix_ns_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MemoryFootprintDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MemoryFootprintDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MemoryFootprintDefaultTypeInternal() {}
   union {
-    Empty _instance;
+    MemoryFootprint _instance;
   };
 };
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EmptyDefaultTypeInternal _Empty_default_instance_;
-
-inline constexpr FunctionList::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : functions_{},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR FunctionList::FunctionList(::_pbi::ConstantInitialized)
-    : _impl_(::_pbi::ConstantInitialized()) {}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MemoryFootprintDefaultTypeInternal _MemoryFootprint_default_instance_;
+PROTOBUF_CONSTEXPR FunctionList::FunctionList(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.functions_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct FunctionListDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR FunctionListDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR FunctionListDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~FunctionListDefaultTypeInternal() {}
   union {
     FunctionList _instance;
   };
 };
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FunctionListDefaultTypeInternal _FunctionList_default_instance_;
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FunctionListDefaultTypeInternal _FunctionList_default_instance_;
+PROTOBUF_CONSTEXPR StatusReply::StatusReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StatusReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatusReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatusReplyDefaultTypeInternal() {}
+  union {
+    StatusReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatusReplyDefaultTypeInternal _StatusReply_default_instance_;
+PROTOBUF_CONSTEXPR MetricsReply::MetricsReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MetricsReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetricsReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetricsReplyDefaultTypeInternal() {}
+  union {
+    MetricsReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetricsReplyDefaultTypeInternal _MetricsReply_default_instance_;
 }  // namespace junctiond
-static ::_pb::Metadata file_level_metadata_junctiond_2eproto[6];
-static constexpr const ::_pb::EnumDescriptor**
-    file_level_enum_descriptors_junctiond_2eproto = nullptr;
-static constexpr const ::_pb::ServiceDescriptor**
-    file_level_service_descriptors_junctiond_2eproto = nullptr;
-const ::uint32_t
-    TableStruct_junctiond_2eproto::offsets[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
-        protodesc_cold) = {
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::junctiond::Empty, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::junctiond::FunctionData, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::junctiond::FunctionData, _impl_.name_),
-        PROTOBUF_FIELD_OFFSET(::junctiond::FunctionData, _impl_.rootfs_),
-        PROTOBUF_FIELD_OFFSET(::junctiond::FunctionData, _impl_.cpu_),
-        PROTOBUF_FIELD_OFFSET(::junctiond::FunctionData, _impl_.memorymb_),
-        PROTOBUF_FIELD_OFFSET(::junctiond::FunctionData, _impl_.execpath_),
-        PROTOBUF_FIELD_OFFSET(::junctiond::FunctionData, _impl_.args_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::junctiond::FunctionName, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::junctiond::FunctionName, _impl_.name_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::junctiond::FunctionStatus, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::junctiond::FunctionStatus, _impl_.name_),
-        PROTOBUF_FIELD_OFFSET(::junctiond::FunctionStatus, _impl_.running_),
-        PROTOBUF_FIELD_OFFSET(::junctiond::FunctionStatus, _impl_.pid_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::junctiond::FunctionList, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::junctiond::FunctionList, _impl_.functions_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::junctiond::StatusReply, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::junctiond::StatusReply, _impl_.success_),
-        PROTOBUF_FIELD_OFFSET(::junctiond::StatusReply, _impl_.message_),
+static ::_pb::Metadata file_level_metadata_junctiond_2eproto[8];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_junctiond_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_junctiond_2eproto = nullptr;
+
+const uint32_t TableStruct_junctiond_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::junctiond::Empty, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::junctiond::FunctionData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::junctiond::FunctionData, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::junctiond::FunctionData, _impl_.rootfs_),
+  PROTOBUF_FIELD_OFFSET(::junctiond::FunctionData, _impl_.cpu_),
+  PROTOBUF_FIELD_OFFSET(::junctiond::FunctionData, _impl_.memorymb_),
+  PROTOBUF_FIELD_OFFSET(::junctiond::FunctionData, _impl_.execpath_),
+  PROTOBUF_FIELD_OFFSET(::junctiond::FunctionData, _impl_.args_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::junctiond::FunctionName, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::junctiond::FunctionName, _impl_.name_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::junctiond::FunctionStatus, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::junctiond::FunctionStatus, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::junctiond::FunctionStatus, _impl_.running_),
+  PROTOBUF_FIELD_OFFSET(::junctiond::FunctionStatus, _impl_.pid_),
+  PROTOBUF_FIELD_OFFSET(::junctiond::FunctionStatus, _impl_.memory_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::junctiond::MemoryFootprint, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::junctiond::MemoryFootprint, _impl_.rss_kb_),
+  PROTOBUF_FIELD_OFFSET(::junctiond::MemoryFootprint, _impl_.pss_kb_),
+  PROTOBUF_FIELD_OFFSET(::junctiond::MemoryFootprint, _impl_.shared_kb_),
+  PROTOBUF_FIELD_OFFSET(::junctiond::MemoryFootprint, _impl_.private_dirty_kb_),
+  PROTOBUF_FIELD_OFFSET(::junctiond::MemoryFootprint, _impl_.swap_kb_),
+  PROTOBUF_FIELD_OFFSET(::junctiond::MemoryFootprint, _impl_.sampled_unix_ns_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::junctiond::FunctionList, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::junctiond::FunctionList, _impl_.functions_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::junctiond::StatusReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::junctiond::StatusReply, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::junctiond::StatusReply, _impl_.message_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::junctiond::MetricsReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::junctiond::MetricsReply, _impl_.text_),
 };
-
-static const ::_pbi::MigrationSchema
-    schemas[] ABSL_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-        {0, -1, -1, sizeof(::junctiond::Empty)},
-        {8, -1, -1, sizeof(::junctiond::FunctionData)},
-        {22, -1, -1, sizeof(::junctiond::FunctionName)},
-        {31, -1, -1, sizeof(::junctiond::FunctionStatus)},
-        {42, -1, -1, sizeof(::junctiond::FunctionList)},
-        {51, -1, -1, sizeof(::junctiond::StatusReply)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::junctiond::Empty)},
+  { 6, -1, -1, sizeof(::junctiond::FunctionData)},
+  { 18, -1, -1, sizeof(::junctiond::FunctionName)},
+  { 25, -1, -1, sizeof(::junctiond::FunctionStatus)},
+  { 35, -1, -1, sizeof(::junctiond::MemoryFootprint)},
+  { 47, -1, -1, sizeof(::junctiond::FunctionList)},
+  { 54, -1, -1, sizeof(::junctiond::StatusReply)},
+  { 62, -1, -1, sizeof(::junctiond::MetricsReply)},
 };
+
 static const ::_pb::Message* const file_default_instances[] = {
-    &::junctiond::_Empty_default_instance_._instance,
-    &::junctiond::_FunctionData_default_instance_._instance,
-    &::junctiond::_FunctionName_default_instance_._instance,
-    &::junctiond::_FunctionStatus_default_instance_._instance,
-    &::junctiond::_FunctionList_default_instance_._instance,
-    &::junctiond::_StatusReply_default_instance_._instance,
+  &::junctiond::_Empty_default_instance_._instance,
+  &::junctiond::_FunctionData_default_instance_._instance,
+  &::junctiond::_FunctionName_default_instance_._instance,
+  &::junctiond::_FunctionStatus_default_instance_._instance,
+  &::junctiond::_MemoryFootprint_default_instance_._instance,
+  &::junctiond::_FunctionList_default_instance_._instance,
+  &::junctiond::_StatusReply_default_instance_._instance,
+  &::junctiond::_MetricsReply_default_instance_._instance,
 };
-const char descriptor_table_protodef_junctiond_2eproto[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
-    protodesc_cold) = {
-    "\n\017junctiond.proto\022\tjunctiond\"\007\n\005Empty\"k\n"
-    "\014FunctionData\022\014\n\004name\030\001 \001(\t\022\016\n\006rootfs\030\002 "
-    "\001(\t\022\013\n\003cpu\030\003 \001(\005\022\020\n\010memoryMB\030\004 \001(\005\022\020\n\010ex"
-    "ecpath\030\005 \001(\t\022\014\n\004args\030\006 \001(\t\"\034\n\014FunctionNa"
-    "me\022\014\n\004name\030\001 \001(\t\"<\n\016FunctionStatus\022\014\n\004na"
-    "me\030\001 \001(\t\022\017\n\007running\030\002 \001(\010\022\013\n\003pid\030\003 \001(\005\"<"
-    "\n\014FunctionList\022,\n\tfunctions\030\001 \003(\0132\031.junc"
-    "tiond.FunctionStatus\"/\n\013StatusReply\022\017\n\007s"
-    "uccess\030\001 \001(\010\022\017\n\007message\030\002 \001(\t2\271\001\n\017Juncti"
-    "onService\0228\n\005Spawn\022\027.junctiond.FunctionD"
-    "ata\032\026.junctiond.StatusReply\0229\n\006Remove\022\027."
-    "junctiond.FunctionName\032\026.junctiond.Statu"
-    "sReply\0221\n\004List\022\020.junctiond.Empty\032\027.junct"
-    "iond.FunctionListB5Z3github.com/DonaldLu"
-    "cy/faasd/pkg/junctiond;junctiondb\006proto3"
-};
-static ::absl::once_flag descriptor_table_junctiond_2eproto_once;
+
+const char descriptor_table_protodef_junctiond_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\017junctiond.proto\022\tjunctiond\"\007\n\005Empty\"k\n"
+  "\014FunctionData\022\014\n\004name\030\001 \001(\t\022\016\n\006rootfs\030\002 "
+  "\001(\t\022\013\n\003cpu\030\003 \001(\005\022\020\n\010memoryMB\030\004 \001(\005\022\020\n\010ex"
+  "ecpath\030\005 \001(\t\022\014\n\004args\030\006 \001(\t\"\034\n\014FunctionNa"
+  "me\022\014\n\004name\030\001 \001(\t\"h\n\016FunctionStatus\022\014\n\004na"
+  "me\030\001 \001(\t\022\017\n\007running\030\002 \001(\010\022\013\n\003pid\030\003 \001(\005\022*"
+  "\n\006memory\030\004 \001(\0132\032.junctiond.MemoryFootpri"
+  "nt\"\210\001\n\017MemoryFootprint\022\016\n\006rss_kb\030\001 \001(\004\022\016"
+  "\n\006pss_kb\030\002 \001(\004\022\021\n\tshared_kb\030\003 \001(\004\022\030\n\020pri"
+  "vate_dirty_kb\030\004 \001(\004\022\017\n\007swap_kb\030\005 \001(\004\022\027\n\017"
+  "sampled_unix_ns\030\006 \001(\003\"<\n\014FunctionList\022,\n"
+  "\tfunctions\030\001 \003(\0132\031.junctiond.FunctionSta"
+  "tus\"/\n\013StatusReply\022\017\n\007success\030\001 \001(\010\022\017\n\007m"
+  "essage\030\002 \001(\t\"\034\n\014MetricsReply\022\014\n\004text\030\001 \001"
+  "(\t2\362\001\n\017JunctionService\0228\n\005Spawn\022\027.juncti"
+  "ond.FunctionData\032\026.junctiond.StatusReply"
+  "\0229\n\006Remove\022\027.junctiond.FunctionName\032\026.ju"
+  "nctiond.StatusReply\0221\n\004List\022\020.junctiond."
+  "Empty\032\027.junctiond.FunctionList\0227\n\nGetMet"
+  "rics\022\020.junctiond.Empty\032\027.junctiond.Metri"
+  "csReplyB5Z3github.com/DonaldLucy/faasd/p"
+  "kg/junctiond;junctiondb\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_junctiond_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_junctiond_2eproto = {
-    false,
-    false,
-    600,
-    descriptor_table_protodef_junctiond_2eproto,
+    false, false, 870, descriptor_table_protodef_junctiond_2eproto,
     "junctiond.proto",
-    &descriptor_table_junctiond_2eproto_once,
-    nullptr,
-    0,
-    6,
-    schemas,
-    file_default_instances,
-    TableStruct_junctiond_2eproto::offsets,
-    file_level_metadata_junctiond_2eproto,
-    file_level_enum_descriptors_junctiond_2eproto,
+    &descriptor_table_junctiond_2eproto_once, nullptr, 0, 8,
+    schemas, file_default_instances, TableStruct_junctiond_2eproto::offsets,
+    file_level_metadata_junctiond_2eproto, file_level_enum_descriptors_junctiond_2eproto,
     file_level_service_descriptors_junctiond_2eproto,
 };
-
-// This function exists to be marked as weak.
-// It can significantly speed up compilation by breaking up LLVM's SCC
-// in the .pb.cc translation units. Large translation units see a
-// reduction of more than 35% of walltime for optimized builds. Without
-// the weak attribute all the messages in the file, including all the
-// vtables and everything they use become part of the same SCC through
-// a cycle like:
-// GetMetadata -> descriptor table -> default instances ->
-//   vtables -> GetMetadata
-// By adding a weak function here we break the connection from the
-// individual vtables back into the descriptor table.
 PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_junctiond_2eproto_getter() {
   return &descriptor_table_junctiond_2eproto;
 }
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_junctiond_2eproto(&descriptor_table_junctiond_2eproto);
 namespace junctiond {
+
 // ===================================================================
 
 class Empty::_Internal {
  public:
 };
 
-Empty::Empty(::google::protobuf::Arena* arena)
-    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+Empty::Empty(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
   // @@protoc_insertion_point(arena_constructor:junctiond.Empty)
 }
-Empty::Empty(
-    ::google::protobuf::Arena* arena,
-    const Empty& from)
-    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
-  Empty* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-
+Empty::Empty(const Empty& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  Empty* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:junctiond.Empty)
 }
 
@@ -318,104 +298,142 @@ Empty::Empty(
 
 
 
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Empty::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Empty::GetClassData() const { return &_class_data_; }
+
+
+
 
 
 
 
-::google::protobuf::Metadata Empty::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(&descriptor_table_junctiond_2eproto_getter,
-                                   &descriptor_table_junctiond_2eproto_once,
-                                   file_level_metadata_junctiond_2eproto[0]);
+::PROTOBUF_NAMESPACE_ID::Metadata Empty::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_junctiond_2eproto_getter, &descriptor_table_junctiond_2eproto_once,
+      file_level_metadata_junctiond_2eproto[0]);
 }
+
 // ===================================================================
 
 class FunctionData::_Internal {
  public:
 };
 
-FunctionData::FunctionData(::google::protobuf::Arena* arena)
-    : ::google::protobuf::Message(arena) {
-  SharedCtor(arena);
+FunctionData::FunctionData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:junctiond.FunctionData)
 }
-inline PROTOBUF_NDEBUG_INLINE FunctionData::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from)
-      : name_(arena, from.name_),
-        rootfs_(arena, from.rootfs_),
-        execpath_(arena, from.execpath_),
-        args_(arena, from.args_),
-        _cached_size_{0} {}
-
-FunctionData::FunctionData(
-    ::google::protobuf::Arena* arena,
-    const FunctionData& from)
-    : ::google::protobuf::Message(arena) {
-  FunctionData* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, cpu_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, cpu_),
-           offsetof(Impl_, memorymb_) -
-               offsetof(Impl_, cpu_) +
-               sizeof(Impl_::memorymb_));
-
+FunctionData::FunctionData(const FunctionData& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FunctionData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.rootfs_){}
+    , decltype(_impl_.execpath_){}
+    , decltype(_impl_.args_){}
+    , decltype(_impl_.cpu_){}
+    , decltype(_impl_.memorymb_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.rootfs_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rootfs_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rootfs().empty()) {
+    _this->_impl_.rootfs_.Set(from._internal_rootfs(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.execpath_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.execpath_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_execpath().empty()) {
+    _this->_impl_.execpath_.Set(from._internal_execpath(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.args_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.args_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_args().empty()) {
+    _this->_impl_.args_.Set(from._internal_args(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.cpu_, &from._impl_.cpu_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.memorymb_) -
+    reinterpret_cast<char*>(&_impl_.cpu_)) + sizeof(_impl_.memorymb_));
   // @@protoc_insertion_point(copy_constructor:junctiond.FunctionData)
 }
-inline PROTOBUF_NDEBUG_INLINE FunctionData::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : name_(arena),
-        rootfs_(arena),
-        execpath_(arena),
-        args_(arena),
-        _cached_size_{0} {}
-
-inline void FunctionData::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, cpu_),
-           0,
-           offsetof(Impl_, memorymb_) -
-               offsetof(Impl_, cpu_) +
-               sizeof(Impl_::memorymb_));
+
+inline void FunctionData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.rootfs_){}
+    , decltype(_impl_.execpath_){}
+    , decltype(_impl_.args_){}
+    , decltype(_impl_.cpu_){0}
+    , decltype(_impl_.memorymb_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.rootfs_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rootfs_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.execpath_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.execpath_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.args_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.args_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
+
 FunctionData::~FunctionData() {
   // @@protoc_insertion_point(destructor:junctiond.FunctionData)
-  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
+
 inline void FunctionData::SharedDtor() {
-  ABSL_DCHECK(GetArena() == nullptr);
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.name_.Destroy();
   _impl_.rootfs_.Destroy();
   _impl_.execpath_.Destroy();
   _impl_.args_.Destroy();
-  _impl_.~Impl_();
-}
-
-const ::google::protobuf::MessageLite::ClassData*
-FunctionData::GetClassData() const {
-  PROTOBUF_CONSTINIT static const ::google::protobuf::MessageLite::
-      ClassDataFull _data_ = {
-          {
-              nullptr,  // OnDemandRegisterArenaDtor
-              PROTOBUF_FIELD_OFFSET(FunctionData, _impl_._cached_size_),
-              false,
-          },
-          &FunctionData::MergeImpl,
-          &FunctionData::kDescriptorMethods,
-      };
-  return &_data_;
-}
-PROTOBUF_NOINLINE void FunctionData::Clear() {
+}
+
+void FunctionData::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FunctionData::Clear() {
 // @@protoc_insertion_point(message_clear_start:junctiond.FunctionData)
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  ::uint32_t cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
@@ -423,206 +441,225 @@ PROTOBUF_NOINLINE void FunctionData::Clear() {
   _impl_.rootfs_.ClearToEmpty();
   _impl_.execpath_.ClearToEmpty();
   _impl_.args_.ClearToEmpty();
-  ::memset(&_impl_.cpu_, 0, static_cast<::size_t>(
+  ::memset(&_impl_.cpu_, 0, static_cast<size_t>(
       reinterpret_cast<char*>(&_impl_.memorymb_) -
       reinterpret_cast<char*>(&_impl_.cpu_)) + sizeof(_impl_.memorymb_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-const char* FunctionData::_InternalParse(
-    const char* ptr, ::_pbi::ParseContext* ctx) {
-  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FunctionData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "junctiond.FunctionData.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string rootfs = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_rootfs();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "junctiond.FunctionData.rootfs"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 cpu = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.cpu_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 memoryMB = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.memorymb_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string execpath = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_execpath();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "junctiond.FunctionData.execpath"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string args = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_args();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "junctiond.FunctionData.args"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
   return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 6, 0, 53, 2> FunctionData::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    6, 56,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967232,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    6,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    &_FunctionData_default_instance_._instance,
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::junctiond::FunctionData>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // string name = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(FunctionData, _impl_.name_)}},
-    // string rootfs = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(FunctionData, _impl_.rootfs_)}},
-    // int32 cpu = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(FunctionData, _impl_.cpu_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(FunctionData, _impl_.cpu_)}},
-    // int32 memoryMB = 4;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(FunctionData, _impl_.memorymb_), 63>(),
-     {32, 63, 0, PROTOBUF_FIELD_OFFSET(FunctionData, _impl_.memorymb_)}},
-    // string execpath = 5;
-    {::_pbi::TcParser::FastUS1,
-     {42, 63, 0, PROTOBUF_FIELD_OFFSET(FunctionData, _impl_.execpath_)}},
-    // string args = 6;
-    {::_pbi::TcParser::FastUS1,
-     {50, 63, 0, PROTOBUF_FIELD_OFFSET(FunctionData, _impl_.args_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string name = 1;
-    {PROTOBUF_FIELD_OFFSET(FunctionData, _impl_.name_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string rootfs = 2;
-    {PROTOBUF_FIELD_OFFSET(FunctionData, _impl_.rootfs_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // int32 cpu = 3;
-    {PROTOBUF_FIELD_OFFSET(FunctionData, _impl_.cpu_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 memoryMB = 4;
-    {PROTOBUF_FIELD_OFFSET(FunctionData, _impl_.memorymb_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // string execpath = 5;
-    {PROTOBUF_FIELD_OFFSET(FunctionData, _impl_.execpath_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string args = 6;
-    {PROTOBUF_FIELD_OFFSET(FunctionData, _impl_.args_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\26\4\6\0\0\10\4\0"
-    "junctiond.FunctionData"
-    "name"
-    "rootfs"
-    "execpath"
-    "args"
-  }},
-};
-
-::uint8_t* FunctionData::_InternalSerialize(
-    ::uint8_t* target,
-    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+uint8_t* FunctionData::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:junctiond.FunctionData)
-  ::uint32_t cached_has_bits = 0;
-  (void)cached_has_bits;
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
   // string name = 1;
   if (!this->_internal_name().empty()) {
-    const std::string& _s = this->_internal_name();
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "junctiond.FunctionData.name");
-    target = stream->WriteStringMaybeAliased(1, _s, target);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "junctiond.FunctionData.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
   // string rootfs = 2;
   if (!this->_internal_rootfs().empty()) {
-    const std::string& _s = this->_internal_rootfs();
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "junctiond.FunctionData.rootfs");
-    target = stream->WriteStringMaybeAliased(2, _s, target);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_rootfs().data(), static_cast<int>(this->_internal_rootfs().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "junctiond.FunctionData.rootfs");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_rootfs(), target);
   }
 
   // int32 cpu = 3;
   if (this->_internal_cpu() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::
-        WriteInt32ToArrayWithField<3>(
-            stream, this->_internal_cpu(), target);
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_cpu(), target);
   }
 
   // int32 memoryMB = 4;
   if (this->_internal_memorymb() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::
-        WriteInt32ToArrayWithField<4>(
-            stream, this->_internal_memorymb(), target);
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_memorymb(), target);
   }
 
   // string execpath = 5;
   if (!this->_internal_execpath().empty()) {
-    const std::string& _s = this->_internal_execpath();
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "junctiond.FunctionData.execpath");
-    target = stream->WriteStringMaybeAliased(5, _s, target);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_execpath().data(), static_cast<int>(this->_internal_execpath().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "junctiond.FunctionData.execpath");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_execpath(), target);
   }
 
   // string args = 6;
   if (!this->_internal_args().empty()) {
-    const std::string& _s = this->_internal_args();
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "junctiond.FunctionData.args");
-    target = stream->WriteStringMaybeAliased(6, _s, target);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_args().data(), static_cast<int>(this->_internal_args().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "junctiond.FunctionData.args");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_args(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target =
-        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:junctiond.FunctionData)
   return target;
 }
 
-::size_t FunctionData::ByteSizeLong() const {
+size_t FunctionData::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:junctiond.FunctionData)
-  ::size_t total_size = 0;
+  size_t total_size = 0;
 
-  ::uint32_t cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string name = 1;
   if (!this->_internal_name().empty()) {
-    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                    this->_internal_name());
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
   // string rootfs = 2;
   if (!this->_internal_rootfs().empty()) {
-    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                    this->_internal_rootfs());
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_rootfs());
   }
 
   // string execpath = 5;
   if (!this->_internal_execpath().empty()) {
-    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                    this->_internal_execpath());
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_execpath());
   }
 
   // string args = 6;
   if (!this->_internal_args().empty()) {
-    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                    this->_internal_args());
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_args());
   }
 
   // int32 cpu = 3;
   if (this->_internal_cpu() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-        this->_internal_cpu());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_cpu());
   }
 
   // int32 memoryMB = 4;
   if (this->_internal_memorymb() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-        this->_internal_memorymb());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_memorymb());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FunctionData::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FunctionData::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FunctionData::GetClassData() const { return &_class_data_; }
 
-void FunctionData::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+
+void FunctionData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
   auto* const _this = static_cast<FunctionData*>(&to_msg);
   auto& from = static_cast<const FunctionData&>(from_msg);
   // @@protoc_insertion_point(class_specific_merge_from_start:junctiond.FunctionData)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_name().empty()) {
@@ -638,12 +675,12 @@ void FunctionData::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::go
     _this->_internal_set_args(from._internal_args());
   }
   if (from._internal_cpu() != 0) {
-    _this->_impl_.cpu_ = from._impl_.cpu_;
+    _this->_internal_set_cpu(from._internal_cpu());
   }
   if (from._internal_memorymb() != 0) {
-    _this->_impl_.memorymb_ = from._impl_.memorymb_;
+    _this->_internal_set_memorymb(from._internal_memorymb());
   }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void FunctionData::CopyFrom(const FunctionData& from) {
@@ -653,20 +690,32 @@ void FunctionData::CopyFrom(const FunctionData& from) {
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool FunctionData::IsInitialized() const {
+bool FunctionData::IsInitialized() const {
   return true;
 }
 
-void FunctionData::InternalSwap(FunctionData* PROTOBUF_RESTRICT other) {
+void FunctionData::InternalSwap(FunctionData* other) {
   using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.name_, &other->_impl_.name_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.rootfs_, &other->_impl_.rootfs_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.execpath_, &other->_impl_.execpath_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.args_, &other->_impl_.args_, arena);
-  ::google::protobuf::internal::memswap<
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rootfs_, lhs_arena,
+      &other->_impl_.rootfs_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.execpath_, lhs_arena,
+      &other->_impl_.execpath_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.args_, lhs_arena,
+      &other->_impl_.args_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
       PROTOBUF_FIELD_OFFSET(FunctionData, _impl_.memorymb_)
       + sizeof(FunctionData::_impl_.memorymb_)
       - PROTOBUF_FIELD_OFFSET(FunctionData, _impl_.cpu_)>(
@@ -674,182 +723,185 @@ void FunctionData::InternalSwap(FunctionData* PROTOBUF_RESTRICT other) {
           reinterpret_cast<char*>(&other->_impl_.cpu_));
 }
 
-::google::protobuf::Metadata FunctionData::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(&descriptor_table_junctiond_2eproto_getter,
-                                   &descriptor_table_junctiond_2eproto_once,
-                                   file_level_metadata_junctiond_2eproto[1]);
+::PROTOBUF_NAMESPACE_ID::Metadata FunctionData::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_junctiond_2eproto_getter, &descriptor_table_junctiond_2eproto_once,
+      file_level_metadata_junctiond_2eproto[1]);
 }
+
 // ===================================================================
 
 class FunctionName::_Internal {
  public:
 };
 
-FunctionName::FunctionName(::google::protobuf::Arena* arena)
-    : ::google::protobuf::Message(arena) {
-  SharedCtor(arena);
+FunctionName::FunctionName(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:junctiond.FunctionName)
 }
-inline PROTOBUF_NDEBUG_INLINE FunctionName::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from)
-      : name_(arena, from.name_),
-        _cached_size_{0} {}
-
-FunctionName::FunctionName(
-    ::google::protobuf::Arena* arena,
-    const FunctionName& from)
-    : ::google::protobuf::Message(arena) {
-  FunctionName* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
-
+FunctionName::FunctionName(const FunctionName& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FunctionName* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
   // @@protoc_insertion_point(copy_constructor:junctiond.FunctionName)
 }
-inline PROTOBUF_NDEBUG_INLINE FunctionName::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : name_(arena),
-        _cached_size_{0} {}
 
-inline void FunctionName::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
+inline void FunctionName::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
+
 FunctionName::~FunctionName() {
   // @@protoc_insertion_point(destructor:junctiond.FunctionName)
-  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
+
 inline void FunctionName::SharedDtor() {
-  ABSL_DCHECK(GetArena() == nullptr);
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.name_.Destroy();
-  _impl_.~Impl_();
-}
-
-const ::google::protobuf::MessageLite::ClassData*
-FunctionName::GetClassData() const {
-  PROTOBUF_CONSTINIT static const ::google::protobuf::MessageLite::
-      ClassDataFull _data_ = {
-          {
-              nullptr,  // OnDemandRegisterArenaDtor
-              PROTOBUF_FIELD_OFFSET(FunctionName, _impl_._cached_size_),
-              false,
-          },
-          &FunctionName::MergeImpl,
-          &FunctionName::kDescriptorMethods,
-      };
-  return &_data_;
-}
-PROTOBUF_NOINLINE void FunctionName::Clear() {
+}
+
+void FunctionName::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FunctionName::Clear() {
 // @@protoc_insertion_point(message_clear_start:junctiond.FunctionName)
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  ::uint32_t cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   _impl_.name_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-const char* FunctionName::_InternalParse(
-    const char* ptr, ::_pbi::ParseContext* ctx) {
-  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FunctionName::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "junctiond.FunctionName.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
   return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 35, 2> FunctionName::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    &_FunctionName_default_instance_._instance,
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::junctiond::FunctionName>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string name = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(FunctionName, _impl_.name_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string name = 1;
-    {PROTOBUF_FIELD_OFFSET(FunctionName, _impl_.name_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\26\4\0\0\0\0\0\0"
-    "junctiond.FunctionName"
-    "name"
-  }},
-};
-
-::uint8_t* FunctionName::_InternalSerialize(
-    ::uint8_t* target,
-    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+uint8_t* FunctionName::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:junctiond.FunctionName)
-  ::uint32_t cached_has_bits = 0;
-  (void)cached_has_bits;
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
   // string name = 1;
   if (!this->_internal_name().empty()) {
-    const std::string& _s = this->_internal_name();
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "junctiond.FunctionName.name");
-    target = stream->WriteStringMaybeAliased(1, _s, target);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "junctiond.FunctionName.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target =
-        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:junctiond.FunctionName)
   return target;
 }
 
-::size_t FunctionName::ByteSizeLong() const {
+size_t FunctionName::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:junctiond.FunctionName)
-  ::size_t total_size = 0;
+  size_t total_size = 0;
 
-  ::uint32_t cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string name = 1;
   if (!this->_internal_name().empty()) {
-    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                    this->_internal_name());
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FunctionName::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FunctionName::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FunctionName::GetClassData() const { return &_class_data_; }
+
 
-void FunctionName::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+void FunctionName::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
   auto* const _this = static_cast<FunctionName*>(&to_msg);
   auto& from = static_cast<const FunctionName&>(from_msg);
   // @@protoc_insertion_point(class_specific_merge_from_start:junctiond.FunctionName)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_name().empty()) {
     _this->_internal_set_name(from._internal_name());
   }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void FunctionName::CopyFrom(const FunctionName& from) {
@@ -859,254 +911,295 @@ void FunctionName::CopyFrom(const FunctionName& from) {
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool FunctionName::IsInitialized() const {
+bool FunctionName::IsInitialized() const {
   return true;
 }
 
-void FunctionName::InternalSwap(FunctionName* PROTOBUF_RESTRICT other) {
+void FunctionName::InternalSwap(FunctionName* other) {
   using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.name_, &other->_impl_.name_, arena);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
 }
 
-::google::protobuf::Metadata FunctionName::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(&descriptor_table_junctiond_2eproto_getter,
-                                   &descriptor_table_junctiond_2eproto_once,
-                                   file_level_metadata_junctiond_2eproto[2]);
+::PROTOBUF_NAMESPACE_ID::Metadata FunctionName::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_junctiond_2eproto_getter, &descriptor_table_junctiond_2eproto_once,
+      file_level_metadata_junctiond_2eproto[2]);
 }
+
 // ===================================================================
 
 class FunctionStatus::_Internal {
  public:
+  static const ::junctiond::MemoryFootprint& memory(const FunctionStatus* msg);
 };
 
-FunctionStatus::FunctionStatus(::google::protobuf::Arena* arena)
-    : ::google::protobuf::Message(arena) {
-  SharedCtor(arena);
+const ::junctiond::MemoryFootprint&
+FunctionStatus::_Internal::memory(const FunctionStatus* msg) {
+  return *msg->_impl_.memory_;
+}
+FunctionStatus::FunctionStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:junctiond.FunctionStatus)
 }
-inline PROTOBUF_NDEBUG_INLINE FunctionStatus::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from)
-      : name_(arena, from.name_),
-        _cached_size_{0} {}
-
-FunctionStatus::FunctionStatus(
-    ::google::protobuf::Arena* arena,
-    const FunctionStatus& from)
-    : ::google::protobuf::Message(arena) {
-  FunctionStatus* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, running_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, running_),
-           offsetof(Impl_, pid_) -
-               offsetof(Impl_, running_) +
-               sizeof(Impl_::pid_));
-
+FunctionStatus::FunctionStatus(const FunctionStatus& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FunctionStatus* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.memory_){nullptr}
+    , decltype(_impl_.running_){}
+    , decltype(_impl_.pid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_memory()) {
+    _this->_impl_.memory_ = new ::junctiond::MemoryFootprint(*from._impl_.memory_);
+  }
+  ::memcpy(&_impl_.running_, &from._impl_.running_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.pid_) -
+    reinterpret_cast<char*>(&_impl_.running_)) + sizeof(_impl_.pid_));
   // @@protoc_insertion_point(copy_constructor:junctiond.FunctionStatus)
 }
-inline PROTOBUF_NDEBUG_INLINE FunctionStatus::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : name_(arena),
-        _cached_size_{0} {}
-
-inline void FunctionStatus::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, running_),
-           0,
-           offsetof(Impl_, pid_) -
-               offsetof(Impl_, running_) +
-               sizeof(Impl_::pid_));
+
+inline void FunctionStatus::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.memory_){nullptr}
+    , decltype(_impl_.running_){false}
+    , decltype(_impl_.pid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
+
 FunctionStatus::~FunctionStatus() {
   // @@protoc_insertion_point(destructor:junctiond.FunctionStatus)
-  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
+
 inline void FunctionStatus::SharedDtor() {
-  ABSL_DCHECK(GetArena() == nullptr);
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.name_.Destroy();
-  _impl_.~Impl_();
-}
-
-const ::google::protobuf::MessageLite::ClassData*
-FunctionStatus::GetClassData() const {
-  PROTOBUF_CONSTINIT static const ::google::protobuf::MessageLite::
-      ClassDataFull _data_ = {
-          {
-              nullptr,  // OnDemandRegisterArenaDtor
-              PROTOBUF_FIELD_OFFSET(FunctionStatus, _impl_._cached_size_),
-              false,
-          },
-          &FunctionStatus::MergeImpl,
-          &FunctionStatus::kDescriptorMethods,
-      };
-  return &_data_;
-}
-PROTOBUF_NOINLINE void FunctionStatus::Clear() {
+  if (this != internal_default_instance()) delete _impl_.memory_;
+}
+
+void FunctionStatus::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FunctionStatus::Clear() {
 // @@protoc_insertion_point(message_clear_start:junctiond.FunctionStatus)
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  ::uint32_t cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   _impl_.name_.ClearToEmpty();
-  ::memset(&_impl_.running_, 0, static_cast<::size_t>(
+  if (GetArenaForAllocation() == nullptr && _impl_.memory_ != nullptr) {
+    delete _impl_.memory_;
+  }
+  _impl_.memory_ = nullptr;
+  ::memset(&_impl_.running_, 0, static_cast<size_t>(
       reinterpret_cast<char*>(&_impl_.pid_) -
       reinterpret_cast<char*>(&_impl_.running_)) + sizeof(_impl_.pid_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-const char* FunctionStatus::_InternalParse(
-    const char* ptr, ::_pbi::ParseContext* ctx) {
-  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FunctionStatus::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "junctiond.FunctionStatus.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool running = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.running_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 pid = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.pid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .junctiond.MemoryFootprint memory = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_memory(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
   return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 37, 2> FunctionStatus::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    &_FunctionStatus_default_instance_._instance,
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::junctiond::FunctionStatus>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // string name = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(FunctionStatus, _impl_.name_)}},
-    // bool running = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(FunctionStatus, _impl_.running_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(FunctionStatus, _impl_.running_)}},
-    // int32 pid = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(FunctionStatus, _impl_.pid_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(FunctionStatus, _impl_.pid_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string name = 1;
-    {PROTOBUF_FIELD_OFFSET(FunctionStatus, _impl_.name_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // bool running = 2;
-    {PROTOBUF_FIELD_OFFSET(FunctionStatus, _impl_.running_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
-    // int32 pid = 3;
-    {PROTOBUF_FIELD_OFFSET(FunctionStatus, _impl_.pid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
-    "\30\4\0\0\0\0\0\0"
-    "junctiond.FunctionStatus"
-    "name"
-  }},
-};
-
-::uint8_t* FunctionStatus::_InternalSerialize(
-    ::uint8_t* target,
-    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+uint8_t* FunctionStatus::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:junctiond.FunctionStatus)
-  ::uint32_t cached_has_bits = 0;
-  (void)cached_has_bits;
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
   // string name = 1;
   if (!this->_internal_name().empty()) {
-    const std::string& _s = this->_internal_name();
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "junctiond.FunctionStatus.name");
-    target = stream->WriteStringMaybeAliased(1, _s, target);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "junctiond.FunctionStatus.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
   // bool running = 2;
   if (this->_internal_running() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteBoolToArray(
-        2, this->_internal_running(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_running(), target);
   }
 
   // int32 pid = 3;
   if (this->_internal_pid() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::
-        WriteInt32ToArrayWithField<3>(
-            stream, this->_internal_pid(), target);
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_pid(), target);
+  }
+
+  // .junctiond.MemoryFootprint memory = 4;
+  if (this->_internal_has_memory()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::memory(this),
+        _Internal::memory(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target =
-        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:junctiond.FunctionStatus)
   return target;
 }
 
-::size_t FunctionStatus::ByteSizeLong() const {
+size_t FunctionStatus::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:junctiond.FunctionStatus)
-  ::size_t total_size = 0;
+  size_t total_size = 0;
 
-  ::uint32_t cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string name = 1;
   if (!this->_internal_name().empty()) {
-    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                    this->_internal_name());
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // .junctiond.MemoryFootprint memory = 4;
+  if (this->_internal_has_memory()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.memory_);
   }
 
   // bool running = 2;
   if (this->_internal_running() != 0) {
-    total_size += 2;
+    total_size += 1 + 1;
   }
 
   // int32 pid = 3;
   if (this->_internal_pid() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-        this->_internal_pid());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_pid());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FunctionStatus::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FunctionStatus::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FunctionStatus::GetClassData() const { return &_class_data_; }
+
 
-void FunctionStatus::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+void FunctionStatus::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
   auto* const _this = static_cast<FunctionStatus*>(&to_msg);
   auto& from = static_cast<const FunctionStatus&>(from_msg);
   // @@protoc_insertion_point(class_specific_merge_from_start:junctiond.FunctionStatus)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_name().empty()) {
     _this->_internal_set_name(from._internal_name());
   }
+  if (from._internal_has_memory()) {
+    _this->_internal_mutable_memory()->::junctiond::MemoryFootprint::MergeFrom(
+        from._internal_memory());
+  }
   if (from._internal_running() != 0) {
-    _this->_impl_.running_ = from._impl_.running_;
+    _this->_internal_set_running(from._internal_running());
   }
   if (from._internal_pid() != 0) {
-    _this->_impl_.pid_ = from._impl_.pid_;
+    _this->_internal_set_pid(from._internal_pid());
   }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void FunctionStatus::CopyFrom(const FunctionStatus& from) {
@@ -1116,197 +1209,500 @@ void FunctionStatus::CopyFrom(const FunctionStatus& from) {
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool FunctionStatus::IsInitialized() const {
+bool FunctionStatus::IsInitialized() const {
   return true;
 }
 
-void FunctionStatus::InternalSwap(FunctionStatus* PROTOBUF_RESTRICT other) {
+void FunctionStatus::InternalSwap(FunctionStatus* other) {
   using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.name_, &other->_impl_.name_, arena);
-  ::google::protobuf::internal::memswap<
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
       PROTOBUF_FIELD_OFFSET(FunctionStatus, _impl_.pid_)
       + sizeof(FunctionStatus::_impl_.pid_)
-      - PROTOBUF_FIELD_OFFSET(FunctionStatus, _impl_.running_)>(
-          reinterpret_cast<char*>(&_impl_.running_),
-          reinterpret_cast<char*>(&other->_impl_.running_));
+      - PROTOBUF_FIELD_OFFSET(FunctionStatus, _impl_.memory_)>(
+          reinterpret_cast<char*>(&_impl_.memory_),
+          reinterpret_cast<char*>(&other->_impl_.memory_));
 }
 
-::google::protobuf::Metadata FunctionStatus::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(&descriptor_table_junctiond_2eproto_getter,
-                                   &descriptor_table_junctiond_2eproto_once,
-                                   file_level_metadata_junctiond_2eproto[3]);
+::PROTOBUF_NAMESPACE_ID::Metadata FunctionStatus::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_junctiond_2eproto_getter, &descriptor_table_junctiond_2eproto_once,
+      file_level_metadata_junctiond_2eproto[3]);
 }
+
+// ===================================================================
+
+class MemoryFootprint::_Internal {
+ public:
+};
+
+MemoryFootprint::MemoryFootprint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:junctiond.MemoryFootprint)
+}
+MemoryFootprint::MemoryFootprint(const MemoryFootprint& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MemoryFootprint* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rss_kb_){}
+    , decltype(_impl_.pss_kb_){}
+    , decltype(_impl_.shared_kb_){}
+    , decltype(_impl_.private_dirty_kb_){}
+    , decltype(_impl_.swap_kb_){}
+    , decltype(_impl_.sampled_unix_ns_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.rss_kb_, &from._impl_.rss_kb_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.sampled_unix_ns_) -
+    reinterpret_cast<char*>(&_impl_.rss_kb_)) + sizeof(_impl_.sampled_unix_ns_));
+  // @@protoc_insertion_point(copy_constructor:junctiond.MemoryFootprint)
+}
+
+inline void MemoryFootprint::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rss_kb_){uint64_t{0u}}
+    , decltype(_impl_.pss_kb_){uint64_t{0u}}
+    , decltype(_impl_.shared_kb_){uint64_t{0u}}
+    , decltype(_impl_.private_dirty_kb_){uint64_t{0u}}
+    , decltype(_impl_.swap_kb_){uint64_t{0u}}
+    , decltype(_impl_.sampled_unix_ns_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+MemoryFootprint::~MemoryFootprint() {
+  // @@protoc_insertion_point(destructor:junctiond.MemoryFootprint)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MemoryFootprint::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void MemoryFootprint::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MemoryFootprint::Clear() {
+// @@protoc_insertion_point(message_clear_start:junctiond.MemoryFootprint)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.rss_kb_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.sampled_unix_ns_) -
+      reinterpret_cast<char*>(&_impl_.rss_kb_)) + sizeof(_impl_.sampled_unix_ns_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MemoryFootprint::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 rss_kb = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.rss_kb_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 pss_kb = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.pss_kb_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 shared_kb = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.shared_kb_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 private_dirty_kb = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.private_dirty_kb_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 swap_kb = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.swap_kb_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 sampled_unix_ns = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.sampled_unix_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MemoryFootprint::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:junctiond.MemoryFootprint)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 rss_kb = 1;
+  if (this->_internal_rss_kb() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_rss_kb(), target);
+  }
+
+  // uint64 pss_kb = 2;
+  if (this->_internal_pss_kb() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_pss_kb(), target);
+  }
+
+  // uint64 shared_kb = 3;
+  if (this->_internal_shared_kb() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_shared_kb(), target);
+  }
+
+  // uint64 private_dirty_kb = 4;
+  if (this->_internal_private_dirty_kb() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_private_dirty_kb(), target);
+  }
+
+  // uint64 swap_kb = 5;
+  if (this->_internal_swap_kb() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_swap_kb(), target);
+  }
+
+  // int64 sampled_unix_ns = 6;
+  if (this->_internal_sampled_unix_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_sampled_unix_ns(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:junctiond.MemoryFootprint)
+  return target;
+}
+
+size_t MemoryFootprint::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:junctiond.MemoryFootprint)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 rss_kb = 1;
+  if (this->_internal_rss_kb() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_rss_kb());
+  }
+
+  // uint64 pss_kb = 2;
+  if (this->_internal_pss_kb() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_pss_kb());
+  }
+
+  // uint64 shared_kb = 3;
+  if (this->_internal_shared_kb() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_shared_kb());
+  }
+
+  // uint64 private_dirty_kb = 4;
+  if (this->_internal_private_dirty_kb() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_private_dirty_kb());
+  }
+
+  // uint64 swap_kb = 5;
+  if (this->_internal_swap_kb() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_swap_kb());
+  }
+
+  // int64 sampled_unix_ns = 6;
+  if (this->_internal_sampled_unix_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_sampled_unix_ns());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MemoryFootprint::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MemoryFootprint::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MemoryFootprint::GetClassData() const { return &_class_data_; }
+
+
+void MemoryFootprint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MemoryFootprint*>(&to_msg);
+  auto& from = static_cast<const MemoryFootprint&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:junctiond.MemoryFootprint)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_rss_kb() != 0) {
+    _this->_internal_set_rss_kb(from._internal_rss_kb());
+  }
+  if (from._internal_pss_kb() != 0) {
+    _this->_internal_set_pss_kb(from._internal_pss_kb());
+  }
+  if (from._internal_shared_kb() != 0) {
+    _this->_internal_set_shared_kb(from._internal_shared_kb());
+  }
+  if (from._internal_private_dirty_kb() != 0) {
+    _this->_internal_set_private_dirty_kb(from._internal_private_dirty_kb());
+  }
+  if (from._internal_swap_kb() != 0) {
+    _this->_internal_set_swap_kb(from._internal_swap_kb());
+  }
+  if (from._internal_sampled_unix_ns() != 0) {
+    _this->_internal_set_sampled_unix_ns(from._internal_sampled_unix_ns());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MemoryFootprint::CopyFrom(const MemoryFootprint& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:junctiond.MemoryFootprint)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MemoryFootprint::IsInitialized() const {
+  return true;
+}
+
+void MemoryFootprint::InternalSwap(MemoryFootprint* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MemoryFootprint, _impl_.sampled_unix_ns_)
+      + sizeof(MemoryFootprint::_impl_.sampled_unix_ns_)
+      - PROTOBUF_FIELD_OFFSET(MemoryFootprint, _impl_.rss_kb_)>(
+          reinterpret_cast<char*>(&_impl_.rss_kb_),
+          reinterpret_cast<char*>(&other->_impl_.rss_kb_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MemoryFootprint::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_junctiond_2eproto_getter, &descriptor_table_junctiond_2eproto_once,
+      file_level_metadata_junctiond_2eproto[4]);
+}
+
 // ===================================================================
 
 class FunctionList::_Internal {
  public:
 };
 
-FunctionList::FunctionList(::google::protobuf::Arena* arena)
-    : ::google::protobuf::Message(arena) {
-  SharedCtor(arena);
+FunctionList::FunctionList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:junctiond.FunctionList)
 }
-inline PROTOBUF_NDEBUG_INLINE FunctionList::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from)
-      : functions_{visibility, arena, from.functions_},
-        _cached_size_{0} {}
-
-FunctionList::FunctionList(
-    ::google::protobuf::Arena* arena,
-    const FunctionList& from)
-    : ::google::protobuf::Message(arena) {
-  FunctionList* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+FunctionList::FunctionList(const FunctionList& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FunctionList* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.functions_){from._impl_.functions_}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:junctiond.FunctionList)
 }
-inline PROTOBUF_NDEBUG_INLINE FunctionList::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : functions_{visibility, arena},
-        _cached_size_{0} {}
 
-inline void FunctionList::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
+inline void FunctionList::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.functions_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
+
 FunctionList::~FunctionList() {
   // @@protoc_insertion_point(destructor:junctiond.FunctionList)
-  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
+
 inline void FunctionList::SharedDtor() {
-  ABSL_DCHECK(GetArena() == nullptr);
-  _impl_.~Impl_();
-}
-
-const ::google::protobuf::MessageLite::ClassData*
-FunctionList::GetClassData() const {
-  PROTOBUF_CONSTINIT static const ::google::protobuf::MessageLite::
-      ClassDataFull _data_ = {
-          {
-              nullptr,  // OnDemandRegisterArenaDtor
-              PROTOBUF_FIELD_OFFSET(FunctionList, _impl_._cached_size_),
-              false,
-          },
-          &FunctionList::MergeImpl,
-          &FunctionList::kDescriptorMethods,
-      };
-  return &_data_;
-}
-PROTOBUF_NOINLINE void FunctionList::Clear() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.functions_.~RepeatedPtrField();
+}
+
+void FunctionList::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FunctionList::Clear() {
 // @@protoc_insertion_point(message_clear_start:junctiond.FunctionList)
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  ::uint32_t cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   _impl_.functions_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-const char* FunctionList::_InternalParse(
-    const char* ptr, ::_pbi::ParseContext* ctx) {
-  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FunctionList::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .junctiond.FunctionStatus functions = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_functions(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
   return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> FunctionList::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    &_FunctionList_default_instance_._instance,
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::junctiond::FunctionList>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // repeated .junctiond.FunctionStatus functions = 1;
-    {::_pbi::TcParser::FastMtR1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(FunctionList, _impl_.functions_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // repeated .junctiond.FunctionStatus functions = 1;
-    {PROTOBUF_FIELD_OFFSET(FunctionList, _impl_.functions_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::junctiond::FunctionStatus>()},
-  }}, {{
-  }},
-};
-
-::uint8_t* FunctionList::_InternalSerialize(
-    ::uint8_t* target,
-    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+uint8_t* FunctionList::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:junctiond.FunctionList)
-  ::uint32_t cached_has_bits = 0;
-  (void)cached_has_bits;
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
   // repeated .junctiond.FunctionStatus functions = 1;
-  for (unsigned i = 0, n = static_cast<unsigned>(
-                           this->_internal_functions_size());
-       i < n; i++) {
-    const auto& repfield = this->_internal_functions().Get(i);
-    target =
-        ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-            1, repfield, repfield.GetCachedSize(),
-            target, stream);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_functions_size()); i < n; i++) {
+    const auto& repfield = this->_internal_functions(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target =
-        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:junctiond.FunctionList)
   return target;
 }
 
-::size_t FunctionList::ByteSizeLong() const {
+size_t FunctionList::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:junctiond.FunctionList)
-  ::size_t total_size = 0;
+  size_t total_size = 0;
 
-  ::uint32_t cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .junctiond.FunctionStatus functions = 1;
   total_size += 1UL * this->_internal_functions_size();
-  for (const auto& msg : this->_internal_functions()) {
-    total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  for (const auto& msg : this->_impl_.functions_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FunctionList::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FunctionList::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FunctionList::GetClassData() const { return &_class_data_; }
+
 
-void FunctionList::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+void FunctionList::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
   auto* const _this = static_cast<FunctionList*>(&to_msg);
   auto& from = static_cast<const FunctionList&>(from_msg);
   // @@protoc_insertion_point(class_specific_merge_from_start:junctiond.FunctionList)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_internal_mutable_functions()->MergeFrom(
-      from._internal_functions());
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.functions_.MergeFrom(from._impl_.functions_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void FunctionList::CopyFrom(const FunctionList& from) {
@@ -1316,216 +1712,221 @@ void FunctionList::CopyFrom(const FunctionList& from) {
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool FunctionList::IsInitialized() const {
+bool FunctionList::IsInitialized() const {
   return true;
 }
 
-void FunctionList::InternalSwap(FunctionList* PROTOBUF_RESTRICT other) {
+void FunctionList::InternalSwap(FunctionList* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   _impl_.functions_.InternalSwap(&other->_impl_.functions_);
 }
 
-::google::protobuf::Metadata FunctionList::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(&descriptor_table_junctiond_2eproto_getter,
-                                   &descriptor_table_junctiond_2eproto_once,
-                                   file_level_metadata_junctiond_2eproto[4]);
+::PROTOBUF_NAMESPACE_ID::Metadata FunctionList::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_junctiond_2eproto_getter, &descriptor_table_junctiond_2eproto_once,
+      file_level_metadata_junctiond_2eproto[5]);
 }
+
 // ===================================================================
 
 class StatusReply::_Internal {
  public:
 };
 
-StatusReply::StatusReply(::google::protobuf::Arena* arena)
-    : ::google::protobuf::Message(arena) {
-  SharedCtor(arena);
+StatusReply::StatusReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:junctiond.StatusReply)
 }
-inline PROTOBUF_NDEBUG_INLINE StatusReply::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from)
-      : message_(arena, from.message_),
-        _cached_size_{0} {}
-
-StatusReply::StatusReply(
-    ::google::protobuf::Arena* arena,
-    const StatusReply& from)
-    : ::google::protobuf::Message(arena) {
-  StatusReply* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
-  _impl_.success_ = from._impl_.success_;
-
+StatusReply::StatusReply(const StatusReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StatusReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){}
+    , decltype(_impl_.success_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_message().empty()) {
+    _this->_impl_.message_.Set(from._internal_message(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.success_ = from._impl_.success_;
   // @@protoc_insertion_point(copy_constructor:junctiond.StatusReply)
 }
-inline PROTOBUF_NDEBUG_INLINE StatusReply::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : message_(arena),
-        _cached_size_{0} {}
 
-inline void StatusReply::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.success_ = {};
+inline void StatusReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){}
+    , decltype(_impl_.success_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
+
 StatusReply::~StatusReply() {
   // @@protoc_insertion_point(destructor:junctiond.StatusReply)
-  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
+
 inline void StatusReply::SharedDtor() {
-  ABSL_DCHECK(GetArena() == nullptr);
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.message_.Destroy();
-  _impl_.~Impl_();
-}
-
-const ::google::protobuf::MessageLite::ClassData*
-StatusReply::GetClassData() const {
-  PROTOBUF_CONSTINIT static const ::google::protobuf::MessageLite::
-      ClassDataFull _data_ = {
-          {
-              nullptr,  // OnDemandRegisterArenaDtor
-              PROTOBUF_FIELD_OFFSET(StatusReply, _impl_._cached_size_),
-              false,
-          },
-          &StatusReply::MergeImpl,
-          &StatusReply::kDescriptorMethods,
-      };
-  return &_data_;
-}
-PROTOBUF_NOINLINE void StatusReply::Clear() {
+}
+
+void StatusReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StatusReply::Clear() {
 // @@protoc_insertion_point(message_clear_start:junctiond.StatusReply)
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  ::uint32_t cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   _impl_.message_.ClearToEmpty();
   _impl_.success_ = false;
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-const char* StatusReply::_InternalParse(
-    const char* ptr, ::_pbi::ParseContext* ctx) {
-  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StatusReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool success = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string message = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "junctiond.StatusReply.message"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
   return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 37, 2> StatusReply::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    &_StatusReply_default_instance_._instance,
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::junctiond::StatusReply>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string message = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(StatusReply, _impl_.message_)}},
-    // bool success = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(StatusReply, _impl_.success_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(StatusReply, _impl_.success_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // bool success = 1;
-    {PROTOBUF_FIELD_OFFSET(StatusReply, _impl_.success_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
-    // string message = 2;
-    {PROTOBUF_FIELD_OFFSET(StatusReply, _impl_.message_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\25\0\7\0\0\0\0\0"
-    "junctiond.StatusReply"
-    "message"
-  }},
-};
-
-::uint8_t* StatusReply::_InternalSerialize(
-    ::uint8_t* target,
-    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+uint8_t* StatusReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:junctiond.StatusReply)
-  ::uint32_t cached_has_bits = 0;
-  (void)cached_has_bits;
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
   // bool success = 1;
   if (this->_internal_success() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteBoolToArray(
-        1, this->_internal_success(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
   }
 
   // string message = 2;
   if (!this->_internal_message().empty()) {
-    const std::string& _s = this->_internal_message();
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "junctiond.StatusReply.message");
-    target = stream->WriteStringMaybeAliased(2, _s, target);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "junctiond.StatusReply.message");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_message(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target =
-        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:junctiond.StatusReply)
   return target;
 }
 
-::size_t StatusReply::ByteSizeLong() const {
+size_t StatusReply::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:junctiond.StatusReply)
-  ::size_t total_size = 0;
+  size_t total_size = 0;
 
-  ::uint32_t cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string message = 2;
   if (!this->_internal_message().empty()) {
-    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                    this->_internal_message());
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_message());
   }
 
   // bool success = 1;
   if (this->_internal_success() != 0) {
-    total_size += 2;
+    total_size += 1 + 1;
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StatusReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StatusReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StatusReply::GetClassData() const { return &_class_data_; }
 
-void StatusReply::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+
+void StatusReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
   auto* const _this = static_cast<StatusReply*>(&to_msg);
   auto& from = static_cast<const StatusReply&>(from_msg);
   // @@protoc_insertion_point(class_specific_merge_from_start:junctiond.StatusReply)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_message().empty()) {
     _this->_internal_set_message(from._internal_message());
   }
   if (from._internal_success() != 0) {
-    _this->_impl_.success_ = from._impl_.success_;
+    _this->_internal_set_success(from._internal_success());
   }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void StatusReply::CopyFrom(const StatusReply& from) {
@@ -1535,33 +1936,267 @@ void StatusReply::CopyFrom(const StatusReply& from) {
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool StatusReply::IsInitialized() const {
+bool StatusReply::IsInitialized() const {
   return true;
 }
 
-void StatusReply::InternalSwap(StatusReply* PROTOBUF_RESTRICT other) {
+void StatusReply::InternalSwap(StatusReply* other) {
   using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.message_, &other->_impl_.message_, arena);
-        swap(_impl_.success_, other->_impl_.success_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.message_, lhs_arena,
+      &other->_impl_.message_, rhs_arena
+  );
+  swap(_impl_.success_, other->_impl_.success_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StatusReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_junctiond_2eproto_getter, &descriptor_table_junctiond_2eproto_once,
+      file_level_metadata_junctiond_2eproto[6]);
 }
 
-::google::protobuf::Metadata StatusReply::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(&descriptor_table_junctiond_2eproto_getter,
-                                   &descriptor_table_junctiond_2eproto_once,
-                                   file_level_metadata_junctiond_2eproto[5]);
+// ===================================================================
+
+class MetricsReply::_Internal {
+ public:
+};
+
+MetricsReply::MetricsReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:junctiond.MetricsReply)
+}
+MetricsReply::MetricsReply(const MetricsReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetricsReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.text_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_text().empty()) {
+    _this->_impl_.text_.Set(from._internal_text(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:junctiond.MetricsReply)
 }
+
+inline void MetricsReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.text_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MetricsReply::~MetricsReply() {
+  // @@protoc_insertion_point(destructor:junctiond.MetricsReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MetricsReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.text_.Destroy();
+}
+
+void MetricsReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MetricsReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:junctiond.MetricsReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.text_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetricsReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string text = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "junctiond.MetricsReply.text"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetricsReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:junctiond.MetricsReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string text = 1;
+  if (!this->_internal_text().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_text().data(), static_cast<int>(this->_internal_text().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "junctiond.MetricsReply.text");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_text(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:junctiond.MetricsReply)
+  return target;
+}
+
+size_t MetricsReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:junctiond.MetricsReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string text = 1;
+  if (!this->_internal_text().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_text());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetricsReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetricsReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetricsReply::GetClassData() const { return &_class_data_; }
+
+
+void MetricsReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetricsReply*>(&to_msg);
+  auto& from = static_cast<const MetricsReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:junctiond.MetricsReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_text().empty()) {
+    _this->_internal_set_text(from._internal_text());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MetricsReply::CopyFrom(const MetricsReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:junctiond.MetricsReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MetricsReply::IsInitialized() const {
+  return true;
+}
+
+void MetricsReply::InternalSwap(MetricsReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.text_, lhs_arena,
+      &other->_impl_.text_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MetricsReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_junctiond_2eproto_getter, &descriptor_table_junctiond_2eproto_once,
+      file_level_metadata_junctiond_2eproto[7]);
+}
+
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace junctiond
-namespace google {
-namespace protobuf {
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::junctiond::Empty*
+Arena::CreateMaybeMessage< ::junctiond::Empty >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::junctiond::Empty >(arena);
+}
+template<> PROTOBUF_NOINLINE ::junctiond::FunctionData*
+Arena::CreateMaybeMessage< ::junctiond::FunctionData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::junctiond::FunctionData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::junctiond::FunctionName*
+Arena::CreateMaybeMessage< ::junctiond::FunctionName >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::junctiond::FunctionName >(arena);
+}
+template<> PROTOBUF_NOINLINE ::junctiond::FunctionStatus*
+Arena::CreateMaybeMessage< ::junctiond::FunctionStatus >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::junctiond::FunctionStatus >(arena);
+}
+template<> PROTOBUF_NOINLINE ::junctiond::MemoryFootprint*
+Arena::CreateMaybeMessage< ::junctiond::MemoryFootprint >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::junctiond::MemoryFootprint >(arena);
+}
+template<> PROTOBUF_NOINLINE ::junctiond::FunctionList*
+Arena::CreateMaybeMessage< ::junctiond::FunctionList >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::junctiond::FunctionList >(arena);
+}
+template<> PROTOBUF_NOINLINE ::junctiond::StatusReply*
+Arena::CreateMaybeMessage< ::junctiond::StatusReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::junctiond::StatusReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::junctiond::MetricsReply*
+Arena::CreateMaybeMessage< ::junctiond::MetricsReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::junctiond::MetricsReply >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY2
-static ::std::false_type _static_init_ PROTOBUF_UNUSED =
-    (::_pbi::AddDescriptors(&descriptor_table_junctiond_2eproto),
-     ::std::false_type{});
-#include "google/protobuf/port_undef.inc"
+#include <google/protobuf/port_undef.inc>
@@ -1,55 +1,50 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: junctiond.proto
-// Protobuf C++ Version: 5.26.1
 
-#ifndef GOOGLE_PROTOBUF_INCLUDED_junctiond_2eproto_2epb_2eh
-#define GOOGLE_PROTOBUF_INCLUDED_junctiond_2eproto_2epb_2eh
+#ifndef GOOGLE_PROTOBUF_INCLUDED_junctiond_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_junctiond_2eproto
 
 #include <limits>
 #include <string>
-#include <type_traits>
-#include <utility>
-
-#include "google/protobuf/port_def.inc"
-#if PROTOBUF_VERSION != 5026001
-#error "Protobuf C++ gencode is built with an incompatible version of"
-#error "Protobuf C++ headers/runtime. See"
-#error "https://protobuf.dev/support/cross-version-runtime-guarantee/#cpp"
-#endif
-#include "google/protobuf/port_undef.inc"
-#include "google/protobuf/io/coded_stream.h"
-#include "google/protobuf/arena.h"
-#include "google/protobuf/arenastring.h"
-#include "google/protobuf/generated_message_bases.h"
-#include "google/protobuf/generated_message_tctable_decl.h"
-#include "google/protobuf/generated_message_util.h"
-#include "google/protobuf/metadata_lite.h"
-#include "google/protobuf/generated_message_reflection.h"
-#include "google/protobuf/message.h"
-#include "google/protobuf/repeated_field.h"  // IWYU pragma: export
-#include "google/protobuf/extension_set.h"  // IWYU pragma: export
-#include "google/protobuf/unknown_field_set.h"
-// @@protoc_insertion_point(includes)
 
-// Must be included last.
-#include "google/protobuf/port_def.inc"
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_bases.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 #define PROTOBUF_INTERNAL_EXPORT_junctiond_2eproto
-
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 namespace internal {
 class AnyMetadata;
 }  // namespace internal
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_junctiond_2eproto {
-  static const ::uint32_t offsets[];
+  static const uint32_t offsets[];
 };
-extern const ::google::protobuf::internal::DescriptorTable
-    descriptor_table_junctiond_2eproto;
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_junctiond_2eproto;
 namespace junctiond {
 class Empty;
 struct EmptyDefaultTypeInternal;
@@ -66,44 +61,52 @@ extern FunctionNameDefaultTypeInternal _FunctionName_default_instance_;
 class FunctionStatus;
 struct FunctionStatusDefaultTypeInternal;
 extern FunctionStatusDefaultTypeInternal _FunctionStatus_default_instance_;
+class MemoryFootprint;
+struct MemoryFootprintDefaultTypeInternal;
+extern MemoryFootprintDefaultTypeInternal _MemoryFootprint_default_instance_;
+class MetricsReply;
+struct MetricsReplyDefaultTypeInternal;
+extern MetricsReplyDefaultTypeInternal _MetricsReply_default_instance_;
 class StatusReply;
 struct StatusReplyDefaultTypeInternal;
 extern StatusReplyDefaultTypeInternal _StatusReply_default_instance_;
 }  // namespace junctiond
-namespace google {
-namespace protobuf {
-}  // namespace protobuf
-}  // namespace google
-
+PROTOBUF_NAMESPACE_OPEN
+template<> ::junctiond::Empty* Arena::CreateMaybeMessage<::junctiond::Empty>(Arena*);
+template<> ::junctiond::FunctionData* Arena::CreateMaybeMessage<::junctiond::FunctionData>(Arena*);
+template<> ::junctiond::FunctionList* Arena::CreateMaybeMessage<::junctiond::FunctionList>(Arena*);
+template<> ::junctiond::FunctionName* Arena::CreateMaybeMessage<::junctiond::FunctionName>(Arena*);
+template<> ::junctiond::FunctionStatus* Arena::CreateMaybeMessage<::junctiond::FunctionStatus>(Arena*);
+template<> ::junctiond::MemoryFootprint* Arena::CreateMaybeMessage<::junctiond::MemoryFootprint>(Arena*);
+template<> ::junctiond::MetricsReply* Arena::CreateMaybeMessage<::junctiond::MetricsReply>(Arena*);
+template<> ::junctiond::StatusReply* Arena::CreateMaybeMessage<::junctiond::StatusReply>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
 namespace junctiond {
 
 // ===================================================================
 
-
-// -------------------------------------------------------------------
-
-class StatusReply final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:junctiond.StatusReply) */ {
+class Empty final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:junctiond.Empty) */ {
  public:
-  inline StatusReply() : StatusReply(nullptr) {}
-  ~StatusReply() override;
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR StatusReply(
-      ::google::protobuf::internal::ConstantInitialized);
+  inline Empty() : Empty(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR Empty(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  inline StatusReply(const StatusReply& from) : StatusReply(nullptr, from) {}
-  inline StatusReply(StatusReply&& from) noexcept
-      : StatusReply(nullptr, std::move(from)) {}
-  inline StatusReply& operator=(const StatusReply& from) {
+  Empty(const Empty& from);
+  Empty(Empty&& from) noexcept
+    : Empty() {
+    *this = ::std::move(from);
+  }
+
+  inline Empty& operator=(const Empty& from) {
     CopyFrom(from);
     return *this;
   }
-  inline StatusReply& operator=(StatusReply&& from) noexcept {
+  inline Empty& operator=(Empty&& from) noexcept {
     if (this == &from) return *this;
-    if (GetArena() == from.GetArena()
-#ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetArena() != nullptr
-#endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
     ) {
       InternalSwap(&from);
     } else {
@@ -112,183 +115,117 @@ class StatusReply final : public ::google::protobuf::Message
     return *this;
   }
 
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
     return default_instance().GetMetadata().descriptor;
   }
-  static const ::google::protobuf::Reflection* GetReflection() {
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const StatusReply& default_instance() {
+  static const Empty& default_instance() {
     return *internal_default_instance();
   }
-  static inline const StatusReply* internal_default_instance() {
-    return reinterpret_cast<const StatusReply*>(
-        &_StatusReply_default_instance_);
+  static inline const Empty* internal_default_instance() {
+    return reinterpret_cast<const Empty*>(
+               &_Empty_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 5;
-  friend void swap(StatusReply& a, StatusReply& b) { a.Swap(&b); }
-  inline void Swap(StatusReply* other) {
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Empty& a, Empty& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Empty* other) {
     if (other == this) return;
-#ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetArena() != nullptr && GetArena() == other->GetArena()) {
-#else   // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetArena() == other->GetArena()) {
-#endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(StatusReply* other) {
+  void UnsafeArenaSwap(Empty* other) {
     if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  StatusReply* New(::google::protobuf::Arena* arena = nullptr) const final {
-    return ::google::protobuf::Message::DefaultConstruct<StatusReply>(arena);
+  Empty* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Empty>(arena);
   }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const StatusReply& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const StatusReply& from) { StatusReply::MergeImpl(*this, from); }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const Empty& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const Empty& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
 
   private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "junctiond.Empty";
+  }
+  protected:
+  explicit Empty(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
 
-  ::size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  void SharedDtor();
-  void InternalSwap(StatusReply* other);
- private:
-  friend class ::google::protobuf::internal::AnyMetadata;
-  static ::absl::string_view FullMessageName() { return "junctiond.StatusReply"; }
-
- protected:
-  explicit StatusReply(::google::protobuf::Arena* arena);
-  StatusReply(::google::protobuf::Arena* arena, const StatusReply& from);
-  StatusReply(::google::protobuf::Arena* arena, StatusReply&& from) noexcept
-      : StatusReply(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::MessageLite::ClassData* GetClassData()
-      const final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
- public:
-  ::google::protobuf::Metadata GetMetadata() const final;
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
-  enum : int {
-    kMessageFieldNumber = 2,
-    kSuccessFieldNumber = 1,
-  };
-  // string message = 2;
-  void clear_message() ;
-  const std::string& message() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_message(Arg_&& arg, Args_... args);
-  std::string* mutable_message();
-  PROTOBUF_NODISCARD std::string* release_message();
-  void set_allocated_message(std::string* value);
-
-  private:
-  const std::string& _internal_message() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(
-      const std::string& value);
-  std::string* _internal_mutable_message();
-
-  public:
-  // bool success = 1;
-  void clear_success() ;
-  bool success() const;
-  void set_success(bool value);
-
-  private:
-  bool _internal_success() const;
-  void _internal_set_success(bool value);
 
-  public:
-  // @@protoc_insertion_point(class_scope:junctiond.StatusReply)
+  // @@protoc_insertion_point(class_scope:junctiond.Empty)
  private:
   class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      1, 2, 0,
-      37, 2>
-      _table_;
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from);
-    ::google::protobuf::internal::ArenaStringPtr message_;
-    bool success_;
-    mutable ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
   };
-  union { Impl_ _impl_; };
   friend struct ::TableStruct_junctiond_2eproto;
 };
 // -------------------------------------------------------------------
 
-class FunctionStatus final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:junctiond.FunctionStatus) */ {
+class FunctionData final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:junctiond.FunctionData) */ {
  public:
-  inline FunctionStatus() : FunctionStatus(nullptr) {}
-  ~FunctionStatus() override;
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR FunctionStatus(
-      ::google::protobuf::internal::ConstantInitialized);
+  inline FunctionData() : FunctionData(nullptr) {}
+  ~FunctionData() override;
+  explicit PROTOBUF_CONSTEXPR FunctionData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  inline FunctionStatus(const FunctionStatus& from) : FunctionStatus(nullptr, from) {}
-  inline FunctionStatus(FunctionStatus&& from) noexcept
-      : FunctionStatus(nullptr, std::move(from)) {}
-  inline FunctionStatus& operator=(const FunctionStatus& from) {
+  FunctionData(const FunctionData& from);
+  FunctionData(FunctionData&& from) noexcept
+    : FunctionData() {
+    *this = ::std::move(from);
+  }
+
+  inline FunctionData& operator=(const FunctionData& from) {
     CopyFrom(from);
     return *this;
   }
-  inline FunctionStatus& operator=(FunctionStatus&& from) noexcept {
+  inline FunctionData& operator=(FunctionData&& from) noexcept {
     if (this == &from) return *this;
-    if (GetArena() == from.GetArena()
-#ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetArena() != nullptr
-#endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
     ) {
       InternalSwap(&from);
     } else {
@@ -297,195 +234,221 @@ class FunctionStatus final : public ::google::protobuf::Message
     return *this;
   }
 
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
     return default_instance().GetMetadata().descriptor;
   }
-  static const ::google::protobuf::Reflection* GetReflection() {
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const FunctionStatus& default_instance() {
+  static const FunctionData& default_instance() {
     return *internal_default_instance();
   }
-  static inline const FunctionStatus* internal_default_instance() {
-    return reinterpret_cast<const FunctionStatus*>(
-        &_FunctionStatus_default_instance_);
+  static inline const FunctionData* internal_default_instance() {
+    return reinterpret_cast<const FunctionData*>(
+               &_FunctionData_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 3;
-  friend void swap(FunctionStatus& a, FunctionStatus& b) { a.Swap(&b); }
-  inline void Swap(FunctionStatus* other) {
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(FunctionData& a, FunctionData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FunctionData* other) {
     if (other == this) return;
-#ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetArena() != nullptr && GetArena() == other->GetArena()) {
-#else   // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetArena() == other->GetArena()) {
-#endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(FunctionStatus* other) {
+  void UnsafeArenaSwap(FunctionData* other) {
     if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  FunctionStatus* New(::google::protobuf::Arena* arena = nullptr) const final {
-    return ::google::protobuf::Message::DefaultConstruct<FunctionStatus>(arena);
+  FunctionData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FunctionData>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FunctionData& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FunctionData& from) {
+    FunctionData::MergeImpl(*this, from);
   }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const FunctionStatus& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const FunctionStatus& from) { FunctionStatus::MergeImpl(*this, from); }
-
   private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
-  ::size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void InternalSwap(FunctionStatus* other);
- private:
-  friend class ::google::protobuf::internal::AnyMetadata;
-  static ::absl::string_view FullMessageName() { return "junctiond.FunctionStatus"; }
-
- protected:
-  explicit FunctionStatus(::google::protobuf::Arena* arena);
-  FunctionStatus(::google::protobuf::Arena* arena, const FunctionStatus& from);
-  FunctionStatus(::google::protobuf::Arena* arena, FunctionStatus&& from) noexcept
-      : FunctionStatus(arena) {
-    *this = ::std::move(from);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FunctionData* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "junctiond.FunctionData";
   }
-  const ::google::protobuf::MessageLite::ClassData* GetClassData()
-      const final;
+  protected:
+  explicit FunctionData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
- public:
-  ::google::protobuf::Metadata GetMetadata() const final;
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
+
   enum : int {
     kNameFieldNumber = 1,
-    kRunningFieldNumber = 2,
-    kPidFieldNumber = 3,
+    kRootfsFieldNumber = 2,
+    kExecpathFieldNumber = 5,
+    kArgsFieldNumber = 6,
+    kCpuFieldNumber = 3,
+    kMemoryMBFieldNumber = 4,
   };
   // string name = 1;
-  void clear_name() ;
+  void clear_name();
   const std::string& name() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_name(Arg_&& arg, Args_... args);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
   PROTOBUF_NODISCARD std::string* release_name();
-  void set_allocated_name(std::string* value);
-
+  void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(
-      const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
+  public:
 
+  // string rootfs = 2;
+  void clear_rootfs();
+  const std::string& rootfs() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rootfs(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rootfs();
+  PROTOBUF_NODISCARD std::string* release_rootfs();
+  void set_allocated_rootfs(std::string* rootfs);
+  private:
+  const std::string& _internal_rootfs() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rootfs(const std::string& value);
+  std::string* _internal_mutable_rootfs();
   public:
-  // bool running = 2;
-  void clear_running() ;
-  bool running() const;
-  void set_running(bool value);
 
+  // string execpath = 5;
+  void clear_execpath();
+  const std::string& execpath() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_execpath(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_execpath();
+  PROTOBUF_NODISCARD std::string* release_execpath();
+  void set_allocated_execpath(std::string* execpath);
   private:
-  bool _internal_running() const;
-  void _internal_set_running(bool value);
+  const std::string& _internal_execpath() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_execpath(const std::string& value);
+  std::string* _internal_mutable_execpath();
+  public:
 
+  // string args = 6;
+  void clear_args();
+  const std::string& args() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_args(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_args();
+  PROTOBUF_NODISCARD std::string* release_args();
+  void set_allocated_args(std::string* args);
+  private:
+  const std::string& _internal_args() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_args(const std::string& value);
+  std::string* _internal_mutable_args();
   public:
-  // int32 pid = 3;
-  void clear_pid() ;
-  ::int32_t pid() const;
-  void set_pid(::int32_t value);
 
+  // int32 cpu = 3;
+  void clear_cpu();
+  int32_t cpu() const;
+  void set_cpu(int32_t value);
   private:
-  ::int32_t _internal_pid() const;
-  void _internal_set_pid(::int32_t value);
+  int32_t _internal_cpu() const;
+  void _internal_set_cpu(int32_t value);
+  public:
 
+  // int32 memoryMB = 4;
+  void clear_memorymb();
+  int32_t memorymb() const;
+  void set_memorymb(int32_t value);
+  private:
+  int32_t _internal_memorymb() const;
+  void _internal_set_memorymb(int32_t value);
   public:
-  // @@protoc_insertion_point(class_scope:junctiond.FunctionStatus)
+
+  // @@protoc_insertion_point(class_scope:junctiond.FunctionData)
  private:
   class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 3, 0,
-      37, 2>
-      _table_;
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from);
-    ::google::protobuf::internal::ArenaStringPtr name_;
-    bool running_;
-    ::int32_t pid_;
-    mutable ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rootfs_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr execpath_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr args_;
+    int32_t cpu_;
+    int32_t memorymb_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_junctiond_2eproto;
 };
 // -------------------------------------------------------------------
 
-class FunctionName final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:junctiond.FunctionName) */ {
+class FunctionName final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:junctiond.FunctionName) */ {
  public:
   inline FunctionName() : FunctionName(nullptr) {}
   ~FunctionName() override;
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR FunctionName(
-      ::google::protobuf::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR FunctionName(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FunctionName(const FunctionName& from);
+  FunctionName(FunctionName&& from) noexcept
+    : FunctionName() {
+    *this = ::std::move(from);
+  }
 
-  inline FunctionName(const FunctionName& from) : FunctionName(nullptr, from) {}
-  inline FunctionName(FunctionName&& from) noexcept
-      : FunctionName(nullptr, std::move(from)) {}
   inline FunctionName& operator=(const FunctionName& from) {
     CopyFrom(from);
     return *this;
   }
   inline FunctionName& operator=(FunctionName&& from) noexcept {
     if (this == &from) return *this;
-    if (GetArena() == from.GetArena()
-#ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetArena() != nullptr
-#endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
     ) {
       InternalSwap(&from);
     } else {
@@ -494,22 +457,13 @@ class FunctionName final : public ::google::protobuf::Message
     return *this;
   }
 
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
     return default_instance().GetMetadata().descriptor;
   }
-  static const ::google::protobuf::Reflection* GetReflection() {
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
   static const FunctionName& default_instance() {
@@ -517,148 +471,137 @@ class FunctionName final : public ::google::protobuf::Message
   }
   static inline const FunctionName* internal_default_instance() {
     return reinterpret_cast<const FunctionName*>(
-        &_FunctionName_default_instance_);
+               &_FunctionName_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(FunctionName& a, FunctionName& b) {
+    a.Swap(&b);
   }
-  static constexpr int kIndexInFileMessages = 2;
-  friend void swap(FunctionName& a, FunctionName& b) { a.Swap(&b); }
   inline void Swap(FunctionName* other) {
     if (other == this) return;
-#ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetArena() != nullptr && GetArena() == other->GetArena()) {
-#else   // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetArena() == other->GetArena()) {
-#endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
   void UnsafeArenaSwap(FunctionName* other) {
     if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  FunctionName* New(::google::protobuf::Arena* arena = nullptr) const final {
-    return ::google::protobuf::Message::DefaultConstruct<FunctionName>(arena);
+  FunctionName* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FunctionName>(arena);
   }
-  using ::google::protobuf::Message::CopyFrom;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const FunctionName& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const FunctionName& from) { FunctionName::MergeImpl(*this, from); }
-
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FunctionName& from) {
+    FunctionName::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
-  ::size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
+  void SetCachedSize(int size) const final;
   void InternalSwap(FunctionName* other);
- private:
-  friend class ::google::protobuf::internal::AnyMetadata;
-  static ::absl::string_view FullMessageName() { return "junctiond.FunctionName"; }
-
- protected:
-  explicit FunctionName(::google::protobuf::Arena* arena);
-  FunctionName(::google::protobuf::Arena* arena, const FunctionName& from);
-  FunctionName(::google::protobuf::Arena* arena, FunctionName&& from) noexcept
-      : FunctionName(arena) {
-    *this = ::std::move(from);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "junctiond.FunctionName";
   }
-  const ::google::protobuf::MessageLite::ClassData* GetClassData()
-      const final;
+  protected:
+  explicit FunctionName(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
- public:
-  ::google::protobuf::Metadata GetMetadata() const final;
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
+
   enum : int {
     kNameFieldNumber = 1,
   };
   // string name = 1;
-  void clear_name() ;
+  void clear_name();
   const std::string& name() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_name(Arg_&& arg, Args_... args);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
   PROTOBUF_NODISCARD std::string* release_name();
-  void set_allocated_name(std::string* value);
-
+  void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(
-      const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
-
   public:
+
   // @@protoc_insertion_point(class_scope:junctiond.FunctionName)
  private:
   class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      0, 1, 0,
-      35, 2>
-      _table_;
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from);
-    ::google::protobuf::internal::ArenaStringPtr name_;
-    mutable ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_junctiond_2eproto;
 };
 // -------------------------------------------------------------------
 
-class FunctionData final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:junctiond.FunctionData) */ {
+class FunctionStatus final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:junctiond.FunctionStatus) */ {
  public:
-  inline FunctionData() : FunctionData(nullptr) {}
-  ~FunctionData() override;
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR FunctionData(
-      ::google::protobuf::internal::ConstantInitialized);
+  inline FunctionStatus() : FunctionStatus(nullptr) {}
+  ~FunctionStatus() override;
+  explicit PROTOBUF_CONSTEXPR FunctionStatus(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  inline FunctionData(const FunctionData& from) : FunctionData(nullptr, from) {}
-  inline FunctionData(FunctionData&& from) noexcept
-      : FunctionData(nullptr, std::move(from)) {}
-  inline FunctionData& operator=(const FunctionData& from) {
+  FunctionStatus(const FunctionStatus& from);
+  FunctionStatus(FunctionStatus&& from) noexcept
+    : FunctionStatus() {
+    *this = ::std::move(from);
+  }
+
+  inline FunctionStatus& operator=(const FunctionStatus& from) {
     CopyFrom(from);
     return *this;
   }
-  inline FunctionData& operator=(FunctionData&& from) noexcept {
+  inline FunctionStatus& operator=(FunctionStatus&& from) noexcept {
     if (this == &from) return *this;
-    if (GetArena() == from.GetArena()
-#ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetArena() != nullptr
-#endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
     ) {
       InternalSwap(&from);
     } else {
@@ -667,248 +610,553 @@ class FunctionData final : public ::google::protobuf::Message
     return *this;
   }
 
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
     return default_instance().GetMetadata().descriptor;
   }
-  static const ::google::protobuf::Reflection* GetReflection() {
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const FunctionData& default_instance() {
+  static const FunctionStatus& default_instance() {
     return *internal_default_instance();
   }
-  static inline const FunctionData* internal_default_instance() {
-    return reinterpret_cast<const FunctionData*>(
-        &_FunctionData_default_instance_);
+  static inline const FunctionStatus* internal_default_instance() {
+    return reinterpret_cast<const FunctionStatus*>(
+               &_FunctionStatus_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 1;
-  friend void swap(FunctionData& a, FunctionData& b) { a.Swap(&b); }
-  inline void Swap(FunctionData* other) {
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(FunctionStatus& a, FunctionStatus& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FunctionStatus* other) {
     if (other == this) return;
-#ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetArena() != nullptr && GetArena() == other->GetArena()) {
-#else   // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetArena() == other->GetArena()) {
-#endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(FunctionData* other) {
+  void UnsafeArenaSwap(FunctionStatus* other) {
     if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  FunctionData* New(::google::protobuf::Arena* arena = nullptr) const final {
-    return ::google::protobuf::Message::DefaultConstruct<FunctionData>(arena);
+  FunctionStatus* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FunctionStatus>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FunctionStatus& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FunctionStatus& from) {
+    FunctionStatus::MergeImpl(*this, from);
   }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const FunctionData& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const FunctionData& from) { FunctionData::MergeImpl(*this, from); }
-
   private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
-  ::size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void InternalSwap(FunctionData* other);
- private:
-  friend class ::google::protobuf::internal::AnyMetadata;
-  static ::absl::string_view FullMessageName() { return "junctiond.FunctionData"; }
-
- protected:
-  explicit FunctionData(::google::protobuf::Arena* arena);
-  FunctionData(::google::protobuf::Arena* arena, const FunctionData& from);
-  FunctionData(::google::protobuf::Arena* arena, FunctionData&& from) noexcept
-      : FunctionData(arena) {
-    *this = ::std::move(from);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FunctionStatus* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "junctiond.FunctionStatus";
   }
-  const ::google::protobuf::MessageLite::ClassData* GetClassData()
-      const final;
+  protected:
+  explicit FunctionStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
- public:
-  ::google::protobuf::Metadata GetMetadata() const final;
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
+
   enum : int {
     kNameFieldNumber = 1,
-    kRootfsFieldNumber = 2,
-    kExecpathFieldNumber = 5,
-    kArgsFieldNumber = 6,
-    kCpuFieldNumber = 3,
-    kMemoryMBFieldNumber = 4,
+    kMemoryFieldNumber = 4,
+    kRunningFieldNumber = 2,
+    kPidFieldNumber = 3,
   };
   // string name = 1;
-  void clear_name() ;
+  void clear_name();
   const std::string& name() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_name(Arg_&& arg, Args_... args);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
   PROTOBUF_NODISCARD std::string* release_name();
-  void set_allocated_name(std::string* value);
-
+  void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(
-      const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
+  public:
 
+  // .junctiond.MemoryFootprint memory = 4;
+  bool has_memory() const;
+  private:
+  bool _internal_has_memory() const;
   public:
-  // string rootfs = 2;
-  void clear_rootfs() ;
-  const std::string& rootfs() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_rootfs(Arg_&& arg, Args_... args);
-  std::string* mutable_rootfs();
-  PROTOBUF_NODISCARD std::string* release_rootfs();
-  void set_allocated_rootfs(std::string* value);
+  void clear_memory();
+  const ::junctiond::MemoryFootprint& memory() const;
+  PROTOBUF_NODISCARD ::junctiond::MemoryFootprint* release_memory();
+  ::junctiond::MemoryFootprint* mutable_memory();
+  void set_allocated_memory(::junctiond::MemoryFootprint* memory);
+  private:
+  const ::junctiond::MemoryFootprint& _internal_memory() const;
+  ::junctiond::MemoryFootprint* _internal_mutable_memory();
+  public:
+  void unsafe_arena_set_allocated_memory(
+      ::junctiond::MemoryFootprint* memory);
+  ::junctiond::MemoryFootprint* unsafe_arena_release_memory();
 
+  // bool running = 2;
+  void clear_running();
+  bool running() const;
+  void set_running(bool value);
   private:
-  const std::string& _internal_rootfs() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rootfs(
-      const std::string& value);
-  std::string* _internal_mutable_rootfs();
+  bool _internal_running() const;
+  void _internal_set_running(bool value);
+  public:
 
+  // int32 pid = 3;
+  void clear_pid();
+  int32_t pid() const;
+  void set_pid(int32_t value);
+  private:
+  int32_t _internal_pid() const;
+  void _internal_set_pid(int32_t value);
   public:
-  // string execpath = 5;
-  void clear_execpath() ;
-  const std::string& execpath() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_execpath(Arg_&& arg, Args_... args);
-  std::string* mutable_execpath();
-  PROTOBUF_NODISCARD std::string* release_execpath();
-  void set_allocated_execpath(std::string* value);
 
+  // @@protoc_insertion_point(class_scope:junctiond.FunctionStatus)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::junctiond::MemoryFootprint* memory_;
+    bool running_;
+    int32_t pid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_junctiond_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MemoryFootprint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:junctiond.MemoryFootprint) */ {
+ public:
+  inline MemoryFootprint() : MemoryFootprint(nullptr) {}
+  ~MemoryFootprint() override;
+  explicit PROTOBUF_CONSTEXPR MemoryFootprint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MemoryFootprint(const MemoryFootprint& from);
+  MemoryFootprint(MemoryFootprint&& from) noexcept
+    : MemoryFootprint() {
+    *this = ::std::move(from);
+  }
+
+  inline MemoryFootprint& operator=(const MemoryFootprint& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MemoryFootprint& operator=(MemoryFootprint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MemoryFootprint& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MemoryFootprint* internal_default_instance() {
+    return reinterpret_cast<const MemoryFootprint*>(
+               &_MemoryFootprint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(MemoryFootprint& a, MemoryFootprint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MemoryFootprint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MemoryFootprint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MemoryFootprint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MemoryFootprint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MemoryFootprint& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MemoryFootprint& from) {
+    MemoryFootprint::MergeImpl(*this, from);
+  }
   private:
-  const std::string& _internal_execpath() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_execpath(
-      const std::string& value);
-  std::string* _internal_mutable_execpath();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MemoryFootprint* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "junctiond.MemoryFootprint";
+  }
+  protected:
+  explicit MemoryFootprint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  // string args = 6;
-  void clear_args() ;
-  const std::string& args() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_args(Arg_&& arg, Args_... args);
-  std::string* mutable_args();
-  PROTOBUF_NODISCARD std::string* release_args();
-  void set_allocated_args(std::string* value);
 
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRssKbFieldNumber = 1,
+    kPssKbFieldNumber = 2,
+    kSharedKbFieldNumber = 3,
+    kPrivateDirtyKbFieldNumber = 4,
+    kSwapKbFieldNumber = 5,
+    kSampledUnixNsFieldNumber = 6,
+  };
+  // uint64 rss_kb = 1;
+  void clear_rss_kb();
+  uint64_t rss_kb() const;
+  void set_rss_kb(uint64_t value);
   private:
-  const std::string& _internal_args() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_args(
-      const std::string& value);
-  std::string* _internal_mutable_args();
+  uint64_t _internal_rss_kb() const;
+  void _internal_set_rss_kb(uint64_t value);
+  public:
 
+  // uint64 pss_kb = 2;
+  void clear_pss_kb();
+  uint64_t pss_kb() const;
+  void set_pss_kb(uint64_t value);
+  private:
+  uint64_t _internal_pss_kb() const;
+  void _internal_set_pss_kb(uint64_t value);
   public:
-  // int32 cpu = 3;
-  void clear_cpu() ;
-  ::int32_t cpu() const;
-  void set_cpu(::int32_t value);
 
+  // uint64 shared_kb = 3;
+  void clear_shared_kb();
+  uint64_t shared_kb() const;
+  void set_shared_kb(uint64_t value);
   private:
-  ::int32_t _internal_cpu() const;
-  void _internal_set_cpu(::int32_t value);
+  uint64_t _internal_shared_kb() const;
+  void _internal_set_shared_kb(uint64_t value);
+  public:
 
+  // uint64 private_dirty_kb = 4;
+  void clear_private_dirty_kb();
+  uint64_t private_dirty_kb() const;
+  void set_private_dirty_kb(uint64_t value);
+  private:
+  uint64_t _internal_private_dirty_kb() const;
+  void _internal_set_private_dirty_kb(uint64_t value);
   public:
-  // int32 memoryMB = 4;
-  void clear_memorymb() ;
-  ::int32_t memorymb() const;
-  void set_memorymb(::int32_t value);
 
+  // uint64 swap_kb = 5;
+  void clear_swap_kb();
+  uint64_t swap_kb() const;
+  void set_swap_kb(uint64_t value);
   private:
-  ::int32_t _internal_memorymb() const;
-  void _internal_set_memorymb(::int32_t value);
+  uint64_t _internal_swap_kb() const;
+  void _internal_set_swap_kb(uint64_t value);
+  public:
 
+  // int64 sampled_unix_ns = 6;
+  void clear_sampled_unix_ns();
+  int64_t sampled_unix_ns() const;
+  void set_sampled_unix_ns(int64_t value);
+  private:
+  int64_t _internal_sampled_unix_ns() const;
+  void _internal_set_sampled_unix_ns(int64_t value);
   public:
-  // @@protoc_insertion_point(class_scope:junctiond.FunctionData)
+
+  // @@protoc_insertion_point(class_scope:junctiond.MemoryFootprint)
  private:
   class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      3, 6, 0,
-      53, 2>
-      _table_;
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from);
-    ::google::protobuf::internal::ArenaStringPtr name_;
-    ::google::protobuf::internal::ArenaStringPtr rootfs_;
-    ::google::protobuf::internal::ArenaStringPtr execpath_;
-    ::google::protobuf::internal::ArenaStringPtr args_;
-    ::int32_t cpu_;
-    ::int32_t memorymb_;
-    mutable ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
+    uint64_t rss_kb_;
+    uint64_t pss_kb_;
+    uint64_t shared_kb_;
+    uint64_t private_dirty_kb_;
+    uint64_t swap_kb_;
+    int64_t sampled_unix_ns_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_junctiond_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Empty final : public ::google::protobuf::internal::ZeroFieldsBase
-/* @@protoc_insertion_point(class_definition:junctiond.Empty) */ {
+class FunctionList final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:junctiond.FunctionList) */ {
  public:
-  inline Empty() : Empty(nullptr) {}
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR Empty(
-      ::google::protobuf::internal::ConstantInitialized);
+  inline FunctionList() : FunctionList(nullptr) {}
+  ~FunctionList() override;
+  explicit PROTOBUF_CONSTEXPR FunctionList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FunctionList(const FunctionList& from);
+  FunctionList(FunctionList&& from) noexcept
+    : FunctionList() {
+    *this = ::std::move(from);
+  }
+
+  inline FunctionList& operator=(const FunctionList& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FunctionList& operator=(FunctionList&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FunctionList& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FunctionList* internal_default_instance() {
+    return reinterpret_cast<const FunctionList*>(
+               &_FunctionList_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(FunctionList& a, FunctionList& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FunctionList* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FunctionList* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FunctionList* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FunctionList>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FunctionList& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FunctionList& from) {
+    FunctionList::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FunctionList* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "junctiond.FunctionList";
+  }
+  protected:
+  explicit FunctionList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFunctionsFieldNumber = 1,
+  };
+  // repeated .junctiond.FunctionStatus functions = 1;
+  int functions_size() const;
+  private:
+  int _internal_functions_size() const;
+  public:
+  void clear_functions();
+  ::junctiond::FunctionStatus* mutable_functions(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::junctiond::FunctionStatus >*
+      mutable_functions();
+  private:
+  const ::junctiond::FunctionStatus& _internal_functions(int index) const;
+  ::junctiond::FunctionStatus* _internal_add_functions();
+  public:
+  const ::junctiond::FunctionStatus& functions(int index) const;
+  ::junctiond::FunctionStatus* add_functions();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::junctiond::FunctionStatus >&
+      functions() const;
+
+  // @@protoc_insertion_point(class_scope:junctiond.FunctionList)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::junctiond::FunctionStatus > functions_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_junctiond_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StatusReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:junctiond.StatusReply) */ {
+ public:
+  inline StatusReply() : StatusReply(nullptr) {}
+  ~StatusReply() override;
+  explicit PROTOBUF_CONSTEXPR StatusReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StatusReply(const StatusReply& from);
+  StatusReply(StatusReply&& from) noexcept
+    : StatusReply() {
+    *this = ::std::move(from);
+  }
 
-  inline Empty(const Empty& from) : Empty(nullptr, from) {}
-  inline Empty(Empty&& from) noexcept
-      : Empty(nullptr, std::move(from)) {}
-  inline Empty& operator=(const Empty& from) {
+  inline StatusReply& operator=(const StatusReply& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Empty& operator=(Empty&& from) noexcept {
+  inline StatusReply& operator=(StatusReply&& from) noexcept {
     if (this == &from) return *this;
-    if (GetArena() == from.GetArena()
-#ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetArena() != nullptr
-#endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
     ) {
       InternalSwap(&from);
     } else {
@@ -917,127 +1165,162 @@ class Empty final : public ::google::protobuf::internal::ZeroFieldsBase
     return *this;
   }
 
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
     return default_instance().GetMetadata().descriptor;
   }
-  static const ::google::protobuf::Reflection* GetReflection() {
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const Empty& default_instance() {
+  static const StatusReply& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Empty* internal_default_instance() {
-    return reinterpret_cast<const Empty*>(
-        &_Empty_default_instance_);
+  static inline const StatusReply* internal_default_instance() {
+    return reinterpret_cast<const StatusReply*>(
+               &_StatusReply_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 0;
-  friend void swap(Empty& a, Empty& b) { a.Swap(&b); }
-  inline void Swap(Empty* other) {
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(StatusReply& a, StatusReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StatusReply* other) {
     if (other == this) return;
-#ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetArena() != nullptr && GetArena() == other->GetArena()) {
-#else   // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetArena() == other->GetArena()) {
-#endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Empty* other) {
+  void UnsafeArenaSwap(StatusReply* other) {
     if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  Empty* New(::google::protobuf::Arena* arena = nullptr) const final {
-    return ::google::protobuf::internal::ZeroFieldsBase::DefaultConstruct<Empty>(arena);
+  StatusReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StatusReply>(arena);
   }
-  using ::google::protobuf::internal::ZeroFieldsBase::CopyFrom;
-  inline void CopyFrom(const Empty& from) {
-    ::google::protobuf::internal::ZeroFieldsBase::CopyImpl(*this, from);
-  }
-  using ::google::protobuf::internal::ZeroFieldsBase::MergeFrom;
-  void MergeFrom(const Empty& from) {
-    ::google::protobuf::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StatusReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StatusReply& from) {
+    StatusReply::MergeImpl(*this, from);
   }
-
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
- private:
-  friend class ::google::protobuf::internal::AnyMetadata;
-  static ::absl::string_view FullMessageName() { return "junctiond.Empty"; }
-
- protected:
-  explicit Empty(::google::protobuf::Arena* arena);
-  Empty(::google::protobuf::Arena* arena, const Empty& from);
-  Empty(::google::protobuf::Arena* arena, Empty&& from) noexcept
-      : Empty(arena) {
-    *this = ::std::move(from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StatusReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "junctiond.StatusReply";
   }
+  protected:
+  explicit StatusReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
- public:
-  ::google::protobuf::Metadata GetMetadata() const final;
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
-  // @@protoc_insertion_point(class_scope:junctiond.Empty)
+
+  enum : int {
+    kMessageFieldNumber = 2,
+    kSuccessFieldNumber = 1,
+  };
+  // string message = 2;
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // bool success = 1;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:junctiond.StatusReply)
  private:
   class _Internal;
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from);
-    PROTOBUF_TSAN_DECLARE_MEMBER
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_junctiond_2eproto;
 };
 // -------------------------------------------------------------------
 
-class FunctionList final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:junctiond.FunctionList) */ {
+class MetricsReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:junctiond.MetricsReply) */ {
  public:
-  inline FunctionList() : FunctionList(nullptr) {}
-  ~FunctionList() override;
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR FunctionList(
-      ::google::protobuf::internal::ConstantInitialized);
+  inline MetricsReply() : MetricsReply(nullptr) {}
+  ~MetricsReply() override;
+  explicit PROTOBUF_CONSTEXPR MetricsReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  inline FunctionList(const FunctionList& from) : FunctionList(nullptr, from) {}
-  inline FunctionList(FunctionList&& from) noexcept
-      : FunctionList(nullptr, std::move(from)) {}
-  inline FunctionList& operator=(const FunctionList& from) {
+  MetricsReply(const MetricsReply& from);
+  MetricsReply(MetricsReply&& from) noexcept
+    : MetricsReply() {
+    *this = ::std::move(from);
+  }
+
+  inline MetricsReply& operator=(const MetricsReply& from) {
     CopyFrom(from);
     return *this;
   }
-  inline FunctionList& operator=(FunctionList&& from) noexcept {
+  inline MetricsReply& operator=(MetricsReply&& from) noexcept {
     if (this == &from) return *this;
-    if (GetArena() == from.GetArena()
-#ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetArena() != nullptr
-#endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
     ) {
       InternalSwap(&from);
     } else {
@@ -1046,163 +1329,135 @@ class FunctionList final : public ::google::protobuf::Message
     return *this;
   }
 
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
     return default_instance().GetMetadata().descriptor;
   }
-  static const ::google::protobuf::Reflection* GetReflection() {
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const FunctionList& default_instance() {
+  static const MetricsReply& default_instance() {
     return *internal_default_instance();
   }
-  static inline const FunctionList* internal_default_instance() {
-    return reinterpret_cast<const FunctionList*>(
-        &_FunctionList_default_instance_);
+  static inline const MetricsReply* internal_default_instance() {
+    return reinterpret_cast<const MetricsReply*>(
+               &_MetricsReply_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 4;
-  friend void swap(FunctionList& a, FunctionList& b) { a.Swap(&b); }
-  inline void Swap(FunctionList* other) {
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(MetricsReply& a, MetricsReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetricsReply* other) {
     if (other == this) return;
-#ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetArena() != nullptr && GetArena() == other->GetArena()) {
-#else   // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetArena() == other->GetArena()) {
-#endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(FunctionList* other) {
+  void UnsafeArenaSwap(MetricsReply* other) {
     if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  FunctionList* New(::google::protobuf::Arena* arena = nullptr) const final {
-    return ::google::protobuf::Message::DefaultConstruct<FunctionList>(arena);
+  MetricsReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetricsReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MetricsReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetricsReply& from) {
+    MetricsReply::MergeImpl(*this, from);
   }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const FunctionList& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const FunctionList& from) { FunctionList::MergeImpl(*this, from); }
-
   private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
-  ::size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void InternalSwap(FunctionList* other);
- private:
-  friend class ::google::protobuf::internal::AnyMetadata;
-  static ::absl::string_view FullMessageName() { return "junctiond.FunctionList"; }
-
- protected:
-  explicit FunctionList(::google::protobuf::Arena* arena);
-  FunctionList(::google::protobuf::Arena* arena, const FunctionList& from);
-  FunctionList(::google::protobuf::Arena* arena, FunctionList&& from) noexcept
-      : FunctionList(arena) {
-    *this = ::std::move(from);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetricsReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "junctiond.MetricsReply";
   }
-  const ::google::protobuf::MessageLite::ClassData* GetClassData()
-      const final;
+  protected:
+  explicit MetricsReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
- public:
-  ::google::protobuf::Metadata GetMetadata() const final;
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
+
   enum : int {
-    kFunctionsFieldNumber = 1,
+    kTextFieldNumber = 1,
   };
-  // repeated .junctiond.FunctionStatus functions = 1;
-  int functions_size() const;
+  // string text = 1;
+  void clear_text();
+  const std::string& text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_text();
+  PROTOBUF_NODISCARD std::string* release_text();
+  void set_allocated_text(std::string* text);
   private:
-  int _internal_functions_size() const;
-
+  const std::string& _internal_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_text(const std::string& value);
+  std::string* _internal_mutable_text();
   public:
-  void clear_functions() ;
-  ::junctiond::FunctionStatus* mutable_functions(int index);
-  ::google::protobuf::RepeatedPtrField<::junctiond::FunctionStatus>* mutable_functions();
 
-  private:
-  const ::google::protobuf::RepeatedPtrField<::junctiond::FunctionStatus>& _internal_functions() const;
-  ::google::protobuf::RepeatedPtrField<::junctiond::FunctionStatus>* _internal_mutable_functions();
-  public:
-  const ::junctiond::FunctionStatus& functions(int index) const;
-  ::junctiond::FunctionStatus* add_functions();
-  const ::google::protobuf::RepeatedPtrField<::junctiond::FunctionStatus>& functions() const;
-  // @@protoc_insertion_point(class_scope:junctiond.FunctionList)
+  // @@protoc_insertion_point(class_scope:junctiond.MetricsReply)
  private:
   class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      0, 1, 1,
-      0, 2>
-      _table_;
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from);
-    ::google::protobuf::RepeatedPtrField< ::junctiond::FunctionStatus > functions_;
-    mutable ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr text_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_junctiond_2eproto;
 };
-
 // ===================================================================
 
 
-
-
 // ===================================================================
 
-
 #ifdef __GNUC__
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
 #endif  // __GNUC__
-// -------------------------------------------------------------------
-
 // Empty
 
 // -------------------------------------------------------------------
@@ -1211,245 +1466,241 @@ class FunctionList final : public ::google::protobuf::Message
 
 // string name = 1;
 inline void FunctionData::clear_name() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   _impl_.name_.ClearToEmpty();
 }
-inline const std::string& FunctionData::name() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline const std::string& FunctionData::name() const {
   // @@protoc_insertion_point(field_get:junctiond.FunctionData.name)
   return _internal_name();
 }
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void FunctionData::set_name(Arg_&& arg,
-                                                     Args_... args) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.name_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FunctionData::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:junctiond.FunctionData.name)
 }
-inline std::string* FunctionData::mutable_name() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline std::string* FunctionData::mutable_name() {
   std::string* _s = _internal_mutable_name();
   // @@protoc_insertion_point(field_mutable:junctiond.FunctionData.name)
   return _s;
 }
 inline const std::string& FunctionData::_internal_name() const {
-  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
   return _impl_.name_.Get();
 }
 inline void FunctionData::_internal_set_name(const std::string& value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.name_.Set(value, GetArena());
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* FunctionData::_internal_mutable_name() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  return _impl_.name_.Mutable( GetArena());
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* FunctionData::release_name() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   // @@protoc_insertion_point(field_release:junctiond.FunctionData.name)
   return _impl_.name_.Release();
 }
-inline void FunctionData::set_allocated_name(std::string* value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.name_.SetAllocated(value, GetArena());
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        if (_impl_.name_.IsDefault()) {
-          _impl_.name_.Set("", GetArena());
-        }
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void FunctionData::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:junctiond.FunctionData.name)
 }
 
 // string rootfs = 2;
 inline void FunctionData::clear_rootfs() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   _impl_.rootfs_.ClearToEmpty();
 }
-inline const std::string& FunctionData::rootfs() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline const std::string& FunctionData::rootfs() const {
   // @@protoc_insertion_point(field_get:junctiond.FunctionData.rootfs)
   return _internal_rootfs();
 }
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void FunctionData::set_rootfs(Arg_&& arg,
-                                                     Args_... args) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.rootfs_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FunctionData::set_rootfs(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rootfs_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:junctiond.FunctionData.rootfs)
 }
-inline std::string* FunctionData::mutable_rootfs() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline std::string* FunctionData::mutable_rootfs() {
   std::string* _s = _internal_mutable_rootfs();
   // @@protoc_insertion_point(field_mutable:junctiond.FunctionData.rootfs)
   return _s;
 }
 inline const std::string& FunctionData::_internal_rootfs() const {
-  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
   return _impl_.rootfs_.Get();
 }
 inline void FunctionData::_internal_set_rootfs(const std::string& value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.rootfs_.Set(value, GetArena());
+  
+  _impl_.rootfs_.Set(value, GetArenaForAllocation());
 }
 inline std::string* FunctionData::_internal_mutable_rootfs() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  return _impl_.rootfs_.Mutable( GetArena());
+  
+  return _impl_.rootfs_.Mutable(GetArenaForAllocation());
 }
 inline std::string* FunctionData::release_rootfs() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   // @@protoc_insertion_point(field_release:junctiond.FunctionData.rootfs)
   return _impl_.rootfs_.Release();
 }
-inline void FunctionData::set_allocated_rootfs(std::string* value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.rootfs_.SetAllocated(value, GetArena());
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        if (_impl_.rootfs_.IsDefault()) {
-          _impl_.rootfs_.Set("", GetArena());
-        }
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void FunctionData::set_allocated_rootfs(std::string* rootfs) {
+  if (rootfs != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rootfs_.SetAllocated(rootfs, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rootfs_.IsDefault()) {
+    _impl_.rootfs_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:junctiond.FunctionData.rootfs)
 }
 
 // int32 cpu = 3;
 inline void FunctionData::clear_cpu() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   _impl_.cpu_ = 0;
 }
-inline ::int32_t FunctionData::cpu() const {
+inline int32_t FunctionData::_internal_cpu() const {
+  return _impl_.cpu_;
+}
+inline int32_t FunctionData::cpu() const {
   // @@protoc_insertion_point(field_get:junctiond.FunctionData.cpu)
   return _internal_cpu();
 }
-inline void FunctionData::set_cpu(::int32_t value) {
+inline void FunctionData::_internal_set_cpu(int32_t value) {
+  
+  _impl_.cpu_ = value;
+}
+inline void FunctionData::set_cpu(int32_t value) {
   _internal_set_cpu(value);
   // @@protoc_insertion_point(field_set:junctiond.FunctionData.cpu)
 }
-inline ::int32_t FunctionData::_internal_cpu() const {
-  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
-  return _impl_.cpu_;
-}
-inline void FunctionData::_internal_set_cpu(::int32_t value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.cpu_ = value;
-}
 
 // int32 memoryMB = 4;
 inline void FunctionData::clear_memorymb() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   _impl_.memorymb_ = 0;
 }
-inline ::int32_t FunctionData::memorymb() const {
+inline int32_t FunctionData::_internal_memorymb() const {
+  return _impl_.memorymb_;
+}
+inline int32_t FunctionData::memorymb() const {
   // @@protoc_insertion_point(field_get:junctiond.FunctionData.memoryMB)
   return _internal_memorymb();
 }
-inline void FunctionData::set_memorymb(::int32_t value) {
+inline void FunctionData::_internal_set_memorymb(int32_t value) {
+  
+  _impl_.memorymb_ = value;
+}
+inline void FunctionData::set_memorymb(int32_t value) {
   _internal_set_memorymb(value);
   // @@protoc_insertion_point(field_set:junctiond.FunctionData.memoryMB)
 }
-inline ::int32_t FunctionData::_internal_memorymb() const {
-  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
-  return _impl_.memorymb_;
-}
-inline void FunctionData::_internal_set_memorymb(::int32_t value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.memorymb_ = value;
-}
 
 // string execpath = 5;
 inline void FunctionData::clear_execpath() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   _impl_.execpath_.ClearToEmpty();
 }
-inline const std::string& FunctionData::execpath() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline const std::string& FunctionData::execpath() const {
   // @@protoc_insertion_point(field_get:junctiond.FunctionData.execpath)
   return _internal_execpath();
 }
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void FunctionData::set_execpath(Arg_&& arg,
-                                                     Args_... args) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.execpath_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FunctionData::set_execpath(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.execpath_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:junctiond.FunctionData.execpath)
 }
-inline std::string* FunctionData::mutable_execpath() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline std::string* FunctionData::mutable_execpath() {
   std::string* _s = _internal_mutable_execpath();
   // @@protoc_insertion_point(field_mutable:junctiond.FunctionData.execpath)
   return _s;
 }
 inline const std::string& FunctionData::_internal_execpath() const {
-  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
   return _impl_.execpath_.Get();
 }
 inline void FunctionData::_internal_set_execpath(const std::string& value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.execpath_.Set(value, GetArena());
+  
+  _impl_.execpath_.Set(value, GetArenaForAllocation());
 }
 inline std::string* FunctionData::_internal_mutable_execpath() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  return _impl_.execpath_.Mutable( GetArena());
+  
+  return _impl_.execpath_.Mutable(GetArenaForAllocation());
 }
 inline std::string* FunctionData::release_execpath() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   // @@protoc_insertion_point(field_release:junctiond.FunctionData.execpath)
   return _impl_.execpath_.Release();
 }
-inline void FunctionData::set_allocated_execpath(std::string* value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.execpath_.SetAllocated(value, GetArena());
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        if (_impl_.execpath_.IsDefault()) {
-          _impl_.execpath_.Set("", GetArena());
-        }
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void FunctionData::set_allocated_execpath(std::string* execpath) {
+  if (execpath != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.execpath_.SetAllocated(execpath, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.execpath_.IsDefault()) {
+    _impl_.execpath_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:junctiond.FunctionData.execpath)
 }
 
 // string args = 6;
 inline void FunctionData::clear_args() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   _impl_.args_.ClearToEmpty();
 }
-inline const std::string& FunctionData::args() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline const std::string& FunctionData::args() const {
   // @@protoc_insertion_point(field_get:junctiond.FunctionData.args)
   return _internal_args();
 }
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void FunctionData::set_args(Arg_&& arg,
-                                                     Args_... args) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.args_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FunctionData::set_args(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.args_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:junctiond.FunctionData.args)
 }
-inline std::string* FunctionData::mutable_args() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline std::string* FunctionData::mutable_args() {
   std::string* _s = _internal_mutable_args();
   // @@protoc_insertion_point(field_mutable:junctiond.FunctionData.args)
   return _s;
 }
 inline const std::string& FunctionData::_internal_args() const {
-  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
   return _impl_.args_.Get();
 }
 inline void FunctionData::_internal_set_args(const std::string& value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.args_.Set(value, GetArena());
+  
+  _impl_.args_.Set(value, GetArenaForAllocation());
 }
 inline std::string* FunctionData::_internal_mutable_args() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  return _impl_.args_.Mutable( GetArena());
+  
+  return _impl_.args_.Mutable(GetArenaForAllocation());
 }
 inline std::string* FunctionData::release_args() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   // @@protoc_insertion_point(field_release:junctiond.FunctionData.args)
   return _impl_.args_.Release();
 }
-inline void FunctionData::set_allocated_args(std::string* value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.args_.SetAllocated(value, GetArena());
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        if (_impl_.args_.IsDefault()) {
-          _impl_.args_.Set("", GetArena());
-        }
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void FunctionData::set_allocated_args(std::string* args) {
+  if (args != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.args_.SetAllocated(args, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.args_.IsDefault()) {
+    _impl_.args_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:junctiond.FunctionData.args)
 }
 
@@ -1459,51 +1710,51 @@ inline void FunctionData::set_allocated_args(std::string* value) {
 
 // string name = 1;
 inline void FunctionName::clear_name() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   _impl_.name_.ClearToEmpty();
 }
-inline const std::string& FunctionName::name() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline const std::string& FunctionName::name() const {
   // @@protoc_insertion_point(field_get:junctiond.FunctionName.name)
   return _internal_name();
 }
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void FunctionName::set_name(Arg_&& arg,
-                                                     Args_... args) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.name_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FunctionName::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:junctiond.FunctionName.name)
 }
-inline std::string* FunctionName::mutable_name() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline std::string* FunctionName::mutable_name() {
   std::string* _s = _internal_mutable_name();
   // @@protoc_insertion_point(field_mutable:junctiond.FunctionName.name)
   return _s;
 }
 inline const std::string& FunctionName::_internal_name() const {
-  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
   return _impl_.name_.Get();
 }
 inline void FunctionName::_internal_set_name(const std::string& value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.name_.Set(value, GetArena());
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* FunctionName::_internal_mutable_name() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  return _impl_.name_.Mutable( GetArena());
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* FunctionName::release_name() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   // @@protoc_insertion_point(field_release:junctiond.FunctionName.name)
   return _impl_.name_.Release();
 }
-inline void FunctionName::set_allocated_name(std::string* value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.name_.SetAllocated(value, GetArena());
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        if (_impl_.name_.IsDefault()) {
-          _impl_.name_.Set("", GetArena());
-        }
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void FunctionName::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:junctiond.FunctionName.name)
 }
 
@@ -1513,96 +1764,306 @@ inline void FunctionName::set_allocated_name(std::string* value) {
 
 // string name = 1;
 inline void FunctionStatus::clear_name() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   _impl_.name_.ClearToEmpty();
 }
-inline const std::string& FunctionStatus::name() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline const std::string& FunctionStatus::name() const {
   // @@protoc_insertion_point(field_get:junctiond.FunctionStatus.name)
   return _internal_name();
 }
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void FunctionStatus::set_name(Arg_&& arg,
-                                                     Args_... args) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.name_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FunctionStatus::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:junctiond.FunctionStatus.name)
 }
-inline std::string* FunctionStatus::mutable_name() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline std::string* FunctionStatus::mutable_name() {
   std::string* _s = _internal_mutable_name();
   // @@protoc_insertion_point(field_mutable:junctiond.FunctionStatus.name)
   return _s;
 }
 inline const std::string& FunctionStatus::_internal_name() const {
-  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
   return _impl_.name_.Get();
 }
 inline void FunctionStatus::_internal_set_name(const std::string& value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.name_.Set(value, GetArena());
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* FunctionStatus::_internal_mutable_name() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  return _impl_.name_.Mutable( GetArena());
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* FunctionStatus::release_name() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   // @@protoc_insertion_point(field_release:junctiond.FunctionStatus.name)
   return _impl_.name_.Release();
 }
-inline void FunctionStatus::set_allocated_name(std::string* value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.name_.SetAllocated(value, GetArena());
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        if (_impl_.name_.IsDefault()) {
-          _impl_.name_.Set("", GetArena());
-        }
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void FunctionStatus::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:junctiond.FunctionStatus.name)
 }
 
 // bool running = 2;
 inline void FunctionStatus::clear_running() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   _impl_.running_ = false;
 }
+inline bool FunctionStatus::_internal_running() const {
+  return _impl_.running_;
+}
 inline bool FunctionStatus::running() const {
   // @@protoc_insertion_point(field_get:junctiond.FunctionStatus.running)
   return _internal_running();
 }
+inline void FunctionStatus::_internal_set_running(bool value) {
+  
+  _impl_.running_ = value;
+}
 inline void FunctionStatus::set_running(bool value) {
   _internal_set_running(value);
   // @@protoc_insertion_point(field_set:junctiond.FunctionStatus.running)
 }
-inline bool FunctionStatus::_internal_running() const {
-  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
-  return _impl_.running_;
-}
-inline void FunctionStatus::_internal_set_running(bool value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.running_ = value;
-}
 
 // int32 pid = 3;
 inline void FunctionStatus::clear_pid() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   _impl_.pid_ = 0;
 }
-inline ::int32_t FunctionStatus::pid() const {
+inline int32_t FunctionStatus::_internal_pid() const {
+  return _impl_.pid_;
+}
+inline int32_t FunctionStatus::pid() const {
   // @@protoc_insertion_point(field_get:junctiond.FunctionStatus.pid)
   return _internal_pid();
 }
-inline void FunctionStatus::set_pid(::int32_t value) {
+inline void FunctionStatus::_internal_set_pid(int32_t value) {
+  
+  _impl_.pid_ = value;
+}
+inline void FunctionStatus::set_pid(int32_t value) {
   _internal_set_pid(value);
   // @@protoc_insertion_point(field_set:junctiond.FunctionStatus.pid)
 }
-inline ::int32_t FunctionStatus::_internal_pid() const {
-  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
-  return _impl_.pid_;
+
+// .junctiond.MemoryFootprint memory = 4;
+inline bool FunctionStatus::_internal_has_memory() const {
+  return this != internal_default_instance() && _impl_.memory_ != nullptr;
+}
+inline bool FunctionStatus::has_memory() const {
+  return _internal_has_memory();
+}
+inline void FunctionStatus::clear_memory() {
+  if (GetArenaForAllocation() == nullptr && _impl_.memory_ != nullptr) {
+    delete _impl_.memory_;
+  }
+  _impl_.memory_ = nullptr;
+}
+inline const ::junctiond::MemoryFootprint& FunctionStatus::_internal_memory() const {
+  const ::junctiond::MemoryFootprint* p = _impl_.memory_;
+  return p != nullptr ? *p : reinterpret_cast<const ::junctiond::MemoryFootprint&>(
+      ::junctiond::_MemoryFootprint_default_instance_);
+}
+inline const ::junctiond::MemoryFootprint& FunctionStatus::memory() const {
+  // @@protoc_insertion_point(field_get:junctiond.FunctionStatus.memory)
+  return _internal_memory();
+}
+inline void FunctionStatus::unsafe_arena_set_allocated_memory(
+    ::junctiond::MemoryFootprint* memory) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.memory_);
+  }
+  _impl_.memory_ = memory;
+  if (memory) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:junctiond.FunctionStatus.memory)
+}
+inline ::junctiond::MemoryFootprint* FunctionStatus::release_memory() {
+  
+  ::junctiond::MemoryFootprint* temp = _impl_.memory_;
+  _impl_.memory_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::junctiond::MemoryFootprint* FunctionStatus::unsafe_arena_release_memory() {
+  // @@protoc_insertion_point(field_release:junctiond.FunctionStatus.memory)
+  
+  ::junctiond::MemoryFootprint* temp = _impl_.memory_;
+  _impl_.memory_ = nullptr;
+  return temp;
+}
+inline ::junctiond::MemoryFootprint* FunctionStatus::_internal_mutable_memory() {
+  
+  if (_impl_.memory_ == nullptr) {
+    auto* p = CreateMaybeMessage<::junctiond::MemoryFootprint>(GetArenaForAllocation());
+    _impl_.memory_ = p;
+  }
+  return _impl_.memory_;
+}
+inline ::junctiond::MemoryFootprint* FunctionStatus::mutable_memory() {
+  ::junctiond::MemoryFootprint* _msg = _internal_mutable_memory();
+  // @@protoc_insertion_point(field_mutable:junctiond.FunctionStatus.memory)
+  return _msg;
+}
+inline void FunctionStatus::set_allocated_memory(::junctiond::MemoryFootprint* memory) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.memory_;
+  }
+  if (memory) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(memory);
+    if (message_arena != submessage_arena) {
+      memory = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, memory, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.memory_ = memory;
+  // @@protoc_insertion_point(field_set_allocated:junctiond.FunctionStatus.memory)
 }
-inline void FunctionStatus::_internal_set_pid(::int32_t value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.pid_ = value;
+
+// -------------------------------------------------------------------
+
+// MemoryFootprint
+
+// uint64 rss_kb = 1;
+inline void MemoryFootprint::clear_rss_kb() {
+  _impl_.rss_kb_ = uint64_t{0u};
+}
+inline uint64_t MemoryFootprint::_internal_rss_kb() const {
+  return _impl_.rss_kb_;
+}
+inline uint64_t MemoryFootprint::rss_kb() const {
+  // @@protoc_insertion_point(field_get:junctiond.MemoryFootprint.rss_kb)
+  return _internal_rss_kb();
+}
+inline void MemoryFootprint::_internal_set_rss_kb(uint64_t value) {
+  
+  _impl_.rss_kb_ = value;
+}
+inline void MemoryFootprint::set_rss_kb(uint64_t value) {
+  _internal_set_rss_kb(value);
+  // @@protoc_insertion_point(field_set:junctiond.MemoryFootprint.rss_kb)
+}
+
+// uint64 pss_kb = 2;
+inline void MemoryFootprint::clear_pss_kb() {
+  _impl_.pss_kb_ = uint64_t{0u};
+}
+inline uint64_t MemoryFootprint::_internal_pss_kb() const {
+  return _impl_.pss_kb_;
+}
+inline uint64_t MemoryFootprint::pss_kb() const {
+  // @@protoc_insertion_point(field_get:junctiond.MemoryFootprint.pss_kb)
+  return _internal_pss_kb();
+}
+inline void MemoryFootprint::_internal_set_pss_kb(uint64_t value) {
+  
+  _impl_.pss_kb_ = value;
+}
+inline void MemoryFootprint::set_pss_kb(uint64_t value) {
+  _internal_set_pss_kb(value);
+  // @@protoc_insertion_point(field_set:junctiond.MemoryFootprint.pss_kb)
+}
+
+// uint64 shared_kb = 3;
+inline void MemoryFootprint::clear_shared_kb() {
+  _impl_.shared_kb_ = uint64_t{0u};
+}
+inline uint64_t MemoryFootprint::_internal_shared_kb() const {
+  return _impl_.shared_kb_;
+}
+inline uint64_t MemoryFootprint::shared_kb() const {
+  // @@protoc_insertion_point(field_get:junctiond.MemoryFootprint.shared_kb)
+  return _internal_shared_kb();
+}
+inline void MemoryFootprint::_internal_set_shared_kb(uint64_t value) {
+  
+  _impl_.shared_kb_ = value;
+}
+inline void MemoryFootprint::set_shared_kb(uint64_t value) {
+  _internal_set_shared_kb(value);
+  // @@protoc_insertion_point(field_set:junctiond.MemoryFootprint.shared_kb)
+}
+
+// uint64 private_dirty_kb = 4;
+inline void MemoryFootprint::clear_private_dirty_kb() {
+  _impl_.private_dirty_kb_ = uint64_t{0u};
+}
+inline uint64_t MemoryFootprint::_internal_private_dirty_kb() const {
+  return _impl_.private_dirty_kb_;
+}
+inline uint64_t MemoryFootprint::private_dirty_kb() const {
+  // @@protoc_insertion_point(field_get:junctiond.MemoryFootprint.private_dirty_kb)
+  return _internal_private_dirty_kb();
+}
+inline void MemoryFootprint::_internal_set_private_dirty_kb(uint64_t value) {
+  
+  _impl_.private_dirty_kb_ = value;
+}
+inline void MemoryFootprint::set_private_dirty_kb(uint64_t value) {
+  _internal_set_private_dirty_kb(value);
+  // @@protoc_insertion_point(field_set:junctiond.MemoryFootprint.private_dirty_kb)
+}
+
+// uint64 swap_kb = 5;
+inline void MemoryFootprint::clear_swap_kb() {
+  _impl_.swap_kb_ = uint64_t{0u};
+}
+inline uint64_t MemoryFootprint::_internal_swap_kb() const {
+  return _impl_.swap_kb_;
+}
+inline uint64_t MemoryFootprint::swap_kb() const {
+  // @@protoc_insertion_point(field_get:junctiond.MemoryFootprint.swap_kb)
+  return _internal_swap_kb();
+}
+inline void MemoryFootprint::_internal_set_swap_kb(uint64_t value) {
+  
+  _impl_.swap_kb_ = value;
+}
+inline void MemoryFootprint::set_swap_kb(uint64_t value) {
+  _internal_set_swap_kb(value);
+  // @@protoc_insertion_point(field_set:junctiond.MemoryFootprint.swap_kb)
+}
+
+// int64 sampled_unix_ns = 6;
+inline void MemoryFootprint::clear_sampled_unix_ns() {
+  _impl_.sampled_unix_ns_ = int64_t{0};
+}
+inline int64_t MemoryFootprint::_internal_sampled_unix_ns() const {
+  return _impl_.sampled_unix_ns_;
+}
+inline int64_t MemoryFootprint::sampled_unix_ns() const {
+  // @@protoc_insertion_point(field_get:junctiond.MemoryFootprint.sampled_unix_ns)
+  return _internal_sampled_unix_ns();
+}
+inline void MemoryFootprint::_internal_set_sampled_unix_ns(int64_t value) {
+  
+  _impl_.sampled_unix_ns_ = value;
+}
+inline void MemoryFootprint::set_sampled_unix_ns(int64_t value) {
+  _internal_set_sampled_unix_ns(value);
+  // @@protoc_insertion_point(field_set:junctiond.MemoryFootprint.sampled_unix_ns)
 }
 
 // -------------------------------------------------------------------
@@ -1611,52 +2072,43 @@ inline void FunctionStatus::_internal_set_pid(::int32_t value) {
 
 // repeated .junctiond.FunctionStatus functions = 1;
 inline int FunctionList::_internal_functions_size() const {
-  return _internal_functions().size();
+  return _impl_.functions_.size();
 }
 inline int FunctionList::functions_size() const {
   return _internal_functions_size();
 }
 inline void FunctionList::clear_functions() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   _impl_.functions_.Clear();
 }
-inline ::junctiond::FunctionStatus* FunctionList::mutable_functions(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline ::junctiond::FunctionStatus* FunctionList::mutable_functions(int index) {
   // @@protoc_insertion_point(field_mutable:junctiond.FunctionList.functions)
-  return _internal_mutable_functions()->Mutable(index);
+  return _impl_.functions_.Mutable(index);
 }
-inline ::google::protobuf::RepeatedPtrField<::junctiond::FunctionStatus>* FunctionList::mutable_functions()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::junctiond::FunctionStatus >*
+FunctionList::mutable_functions() {
   // @@protoc_insertion_point(field_mutable_list:junctiond.FunctionList.functions)
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  return _internal_mutable_functions();
+  return &_impl_.functions_;
 }
-inline const ::junctiond::FunctionStatus& FunctionList::functions(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline const ::junctiond::FunctionStatus& FunctionList::_internal_functions(int index) const {
+  return _impl_.functions_.Get(index);
+}
+inline const ::junctiond::FunctionStatus& FunctionList::functions(int index) const {
   // @@protoc_insertion_point(field_get:junctiond.FunctionList.functions)
-  return _internal_functions().Get(index);
+  return _internal_functions(index);
+}
+inline ::junctiond::FunctionStatus* FunctionList::_internal_add_functions() {
+  return _impl_.functions_.Add();
 }
-inline ::junctiond::FunctionStatus* FunctionList::add_functions() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  ::junctiond::FunctionStatus* _add = _internal_mutable_functions()->Add();
+inline ::junctiond::FunctionStatus* FunctionList::add_functions() {
+  ::junctiond::FunctionStatus* _add = _internal_add_functions();
   // @@protoc_insertion_point(field_add:junctiond.FunctionList.functions)
   return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField<::junctiond::FunctionStatus>& FunctionList::functions() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::junctiond::FunctionStatus >&
+FunctionList::functions() const {
   // @@protoc_insertion_point(field_list:junctiond.FunctionList.functions)
-  return _internal_functions();
-}
-inline const ::google::protobuf::RepeatedPtrField<::junctiond::FunctionStatus>&
-FunctionList::_internal_functions() const {
-  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
   return _impl_.functions_;
 }
-inline ::google::protobuf::RepeatedPtrField<::junctiond::FunctionStatus>*
-FunctionList::_internal_mutable_functions() {
-  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
-  return &_impl_.functions_;
-}
 
 // -------------------------------------------------------------------
 
@@ -1664,86 +2116,151 @@ FunctionList::_internal_mutable_functions() {
 
 // bool success = 1;
 inline void StatusReply::clear_success() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   _impl_.success_ = false;
 }
+inline bool StatusReply::_internal_success() const {
+  return _impl_.success_;
+}
 inline bool StatusReply::success() const {
   // @@protoc_insertion_point(field_get:junctiond.StatusReply.success)
   return _internal_success();
 }
+inline void StatusReply::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
 inline void StatusReply::set_success(bool value) {
   _internal_set_success(value);
   // @@protoc_insertion_point(field_set:junctiond.StatusReply.success)
 }
-inline bool StatusReply::_internal_success() const {
-  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
-  return _impl_.success_;
-}
-inline void StatusReply::_internal_set_success(bool value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.success_ = value;
-}
 
 // string message = 2;
 inline void StatusReply::clear_message() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   _impl_.message_.ClearToEmpty();
 }
-inline const std::string& StatusReply::message() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline const std::string& StatusReply::message() const {
   // @@protoc_insertion_point(field_get:junctiond.StatusReply.message)
   return _internal_message();
 }
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void StatusReply::set_message(Arg_&& arg,
-                                                     Args_... args) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.message_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StatusReply::set_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:junctiond.StatusReply.message)
 }
-inline std::string* StatusReply::mutable_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline std::string* StatusReply::mutable_message() {
   std::string* _s = _internal_mutable_message();
   // @@protoc_insertion_point(field_mutable:junctiond.StatusReply.message)
   return _s;
 }
 inline const std::string& StatusReply::_internal_message() const {
-  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
   return _impl_.message_.Get();
 }
 inline void StatusReply::_internal_set_message(const std::string& value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.message_.Set(value, GetArena());
+  
+  _impl_.message_.Set(value, GetArenaForAllocation());
 }
 inline std::string* StatusReply::_internal_mutable_message() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  return _impl_.message_.Mutable( GetArena());
+  
+  return _impl_.message_.Mutable(GetArenaForAllocation());
 }
 inline std::string* StatusReply::release_message() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   // @@protoc_insertion_point(field_release:junctiond.StatusReply.message)
   return _impl_.message_.Release();
 }
-inline void StatusReply::set_allocated_message(std::string* value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.message_.SetAllocated(value, GetArena());
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        if (_impl_.message_.IsDefault()) {
-          _impl_.message_.Set("", GetArena());
-        }
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void StatusReply::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:junctiond.StatusReply.message)
 }
 
+// -------------------------------------------------------------------
+
+// MetricsReply
+
+// string text = 1;
+inline void MetricsReply::clear_text() {
+  _impl_.text_.ClearToEmpty();
+}
+inline const std::string& MetricsReply::text() const {
+  // @@protoc_insertion_point(field_get:junctiond.MetricsReply.text)
+  return _internal_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MetricsReply::set_text(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.text_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:junctiond.MetricsReply.text)
+}
+inline std::string* MetricsReply::mutable_text() {
+  std::string* _s = _internal_mutable_text();
+  // @@protoc_insertion_point(field_mutable:junctiond.MetricsReply.text)
+  return _s;
+}
+inline const std::string& MetricsReply::_internal_text() const {
+  return _impl_.text_.Get();
+}
+inline void MetricsReply::_internal_set_text(const std::string& value) {
+  
+  _impl_.text_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MetricsReply::_internal_mutable_text() {
+  
+  return _impl_.text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MetricsReply::release_text() {
+  // @@protoc_insertion_point(field_release:junctiond.MetricsReply.text)
+  return _impl_.text_.Release();
+}
+inline void MetricsReply::set_allocated_text(std::string* text) {
+  if (text != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.text_.SetAllocated(text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:junctiond.MetricsReply.text)
+}
+
 #ifdef __GNUC__
-#pragma GCC diagnostic pop
+  #pragma GCC diagnostic pop
 #endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
-}  // namespace junctiond
 
+}  // namespace junctiond
 
 // @@protoc_insertion_point(global_scope)
 
-#include "google/protobuf/port_undef.inc"
-
-#endif  // GOOGLE_PROTOBUF_INCLUDED_junctiond_2eproto_2epb_2eh
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_junctiond_2eproto
@@ -1,4 +1,5 @@
 #include "junctiond.h"
+#include "metrics.h"
 #include <iostream>
 #include <fstream>
 #include <csignal>
@@ -9,29 +10,125 @@
 #include <sys/stat.h>
 #include <cstring>
 #include <sstream>
+#include <set>
 #include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/sendfile.h>
+
+namespace {
+// Looked up once; every JunctionD in the process records into the same series.
+struct JunctiondMetrics {
+    metrics::Counter &spawned;
+    metrics::Counter &spawnFailed;
+    metrics::Counter &removed;
+    metrics::Histogram &spawnSeconds;
+    metrics::Histogram &startupSeconds;
+};
+
+JunctiondMetrics &junctiondMetrics() {
+    metrics::Registry &r = metrics::Registry::global();
+    static JunctiondMetrics m{
+        r.counter("junctiond_spawns_total", "Instance spawns", {{"result", "ok"}}),
+        r.counter("junctiond_spawns_total", "Instance spawns", {{"result", "failed"}}),
+        r.counter("junctiond_removals_total", "Instances removed"),
+        r.histogram("junctiond_spawn_duration_seconds", "Time spawn() takes: config, pipes and fork"),
+        r.histogram("junctiond_startup_seconds", "Time from spawn to the instance's ready mark"),
+    };
+    return m;
+}
+
+// Every live JunctionD. The registry keeps one callback per series, so the
+// junctiond_instances gauge sums over these instead of reading one daemon.
+struct LiveDaemons {
+    std::mutex mtx;
+    std::set<JunctionD *> all;
+};
+
+LiveDaemons &liveDaemons() {
+    static LiveDaemons l;
+    return l;
+}
+
+// Both ends of a pipe, closed on scope exit unless handed off with release(),
+// so every early return in spawnInstance() gives its descriptors back.
+struct Pipe {
+    int fd[2] = {-1, -1};
+    Pipe() = default;
+    Pipe(const Pipe &) = delete;
+    Pipe &operator=(const Pipe &) = delete;
+    ~Pipe() {
+        for (int f : fd)
+            if (f >= 0) close(f);
+    }
+    void closeEnd(int i) {
+        close(fd[i]);
+        fd[i] = -1;
+    }
+    int release(int i) {
+        int f = fd[i];
+        fd[i] = -1;
+        return f;
+    }
+};
+}  // namespace
+
+double JunctionD::runningInstances() {
+    LiveDaemons &l = liveDaemons();
+    std::lock_guard<std::mutex> liveLock(l.mtx);
+    double running = 0;
+    for (JunctionD *jd : l.all) {
+        std::lock_guard<std::mutex> lock(jd->mtx);
+        for (auto &kv : jd->statusMap) running += kv.second.running ? 1 : 0;
+    }
+    return running;
+}
 
 JunctionD::JunctionD() {
+    junctiondMetrics();
+    static std::once_flag gaugeOnce;
+    std::call_once(gaugeOnce, [] {
+        metrics::Registry::global().gaugeCallback("junctiond_instances", "Instances JunctionD is tracking",
+                                                  {{"state", "running"}}, &JunctionD::runningInstances);
+    });
+    {
+        LiveDaemons &l = liveDaemons();
+        std::lock_guard<std::mutex> lock(l.mtx);
+        l.all.insert(this);
+    }
     monitorThread = std::thread([this]() { 
         monitorInstances(); 
     });
-    monitorThread.detach();
 }
 JunctionD::~JunctionD() {
-    std::lock_guard<std::mutex> lock(mtx);
-    for (auto &kv : statusMap) {
-        remove(kv.first);
+    {
+        LiveDaemons &l = liveDaemons();
+        std::lock_guard<std::mutex> lock(l.mtx);
+        l.all.erase(this);
+    }
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        monitorStop = true;
+    }
+    monitorWake.notify_all();
+    monitorThread.join();
+
+    // remove() takes the lock itself and erases from statusMap, so collect first.
+    std::vector<std::string> names;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        for (auto &kv : statusMap) names.push_back(kv.first);
+    }
+    for (const auto &name : names) {
+        remove(name);
+    }
+    for (auto &kv : sharedModels) {
+        close(kv.second);
     }
 }
 JobResult JunctionD::collect(std::string name) {
     std::lock_guard<std::mutex> lock(mtx);
-    Job* jobPtr = nullptr;
-    for (auto &j : activeJobs) {
-        if (j.name == name) {
-            jobPtr = &j;
-            break;
-        }
-    }
+    Job* jobPtr = findJob(name);
 
     auto it = statusMap.find(name);
     if (it == statusMap.end()) {
@@ -64,24 +161,114 @@ JobResult JunctionD::collect(std::string name) {
     if (waitpid(status.pid, &code, WNOHANG) == status.pid)
         status.running = false;
 
-    return { name, fullOutput, 0, 0 };
+    // stdout is at EOF, so the instance has sent every mark it is going to.
+    drainPhases(*jobPtr);
+    const int64_t doneNs = phaseNow();
+    std::vector<PhaseMark> timeline = mergeTimeline(jobPtr->phases);
+    double startup = 0;
+    double total = 0;
+    if (!timeline.empty()) {
+        const int64_t spawnNs = timeline.front().ns;
+        for (const auto &m : timeline) {
+            if (m.name == "ready" && m.source == "instance") startup = (m.ns - spawnNs) / 1e9;
+        }
+        total = (doneNs - spawnNs) / 1e9;
+    }
+
+    // JUNCTIOND_TRACE_DIR: keep every start's timeline for chrome://tracing.
+    if (const char *traceDir = std::getenv("JUNCTIOND_TRACE_DIR")) {
+        std::string tracePath = std::string(traceDir) + "/" + name + "-" + std::to_string(status.pid) + ".trace.json";
+        std::ofstream trace(tracePath);
+        trace << chromeTraceJson(name, status.pid, timeline);
+        if (!trace) std::cerr << "[junctiond] Failed to write trace " << tracePath << std::endl;
+    }
+
+    if (startup > 0) junctiondMetrics().startupSeconds.observe(startup);
+    return { name, fullOutput, startup, total };
+}
+
+Job *JunctionD::findJob(const std::string &name) {
+    for (auto &j : activeJobs) {
+        if (j.name == name) return &j;
+    }
+    return nullptr;
+}
+
+// Caller holds mtx. The read end is non-blocking: take whatever marks are there.
+void JunctionD::drainPhases(Job &job) {
+    if (job.fd_phase < 0) return;
+    char buffer[4096];
+    ssize_t bytes;
+    while ((bytes = read(job.fd_phase, buffer, sizeof(buffer))) > 0) {
+        job.phaseBuffer.append(buffer, static_cast<size_t>(bytes));
+    }
+    size_t first = job.phases.size();
+    parsePhaseLines(job.phaseBuffer, job.phases);
+    // The forked child is still JunctionD until execvp; its marks go on our track.
+    for (size_t i = first; i < job.phases.size(); ++i) {
+        if (job.phases[i].name == "fork" || job.phases[i].name == "exec") job.phases[i].source = "junctiond";
+    }
+}
+
+std::vector<PhaseMark> JunctionD::phases(const std::string &name) {
+    std::lock_guard<std::mutex> lock(mtx);
+    Job *job = findJob(name);
+    if (!job) return {};
+    drainPhases(*job);
+    return mergeTimeline(job->phases);
+}
+
+std::string JunctionD::chromeTrace(const std::string &name) {
+    std::vector<PhaseMark> timeline = phases(name);
+    pid_t pid = 0;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (Job *job = findJob(name)) pid = job->pid;
+    }
+    return chromeTraceJson(name, pid, timeline);
 }
 
 
 bool JunctionD::spawn(const FunctionData &func) {
+    auto start = std::chrono::steady_clock::now();
+    bool ok = spawnInstance(func);
+    JunctiondMetrics &m = junctiondMetrics();
+    (ok ? m.spawned : m.spawnFailed).inc();
+    m.spawnSeconds.observe(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    return ok;
+}
+
+bool JunctionD::spawnInstance(const FunctionData &func) {
     // 1. Create the Pipes (The plumbing)
-    int pipe_in[2];  // We write to [1], Child reads from [0]
-    int pipe_out[2]; // Child writes to [1], We read from [0]
+    Pipe pipe_in;  // We write to [1], Child reads from [0]
+    Pipe pipe_out; // Child writes to [1], We read from [0]
 
-    if (pipe(pipe_in) < 0 || pipe(pipe_out) < 0) {
+    if (pipe(pipe_in.fd) < 0 || pipe(pipe_out.fd) < 0) {
         perror("[junctiond] Failed to create pipes");
         return false;
     }
 
     auto startTime = std::chrono::steady_clock::now();
+    std::vector<PhaseMark> marks{{"spawn", "junctiond", phaseNow()}};
+
+    // Side channel for the instance's cold-start phase marks, kept off stdout so
+    // the function's output stays clean. CLOEXEC so no other instance inherits it.
+    Pipe pipe_phase;
+    if (pipe2(pipe_phase.fd, O_CLOEXEC) < 0) {
+        perror("[junctiond] Failed to create phase pipe");
+        return false;
+    }
 
     std::string cfgFile;
-    if (!generateConfig(func, cfgFile)) return false;
+    bool ready = generateConfig(func, cfgFile);
+
+    int modelFd = -1;
+    if (ready && !func.sharedModel.empty()) {
+        modelFd = sharedModelFd(func.sharedModel);
+        ready = modelFd >= 0;
+    }
+    if (!ready) return false;
+    marks.push_back({"config", "junctiond", phaseNow()});
 
     // Determine path...
     const char* home = std::getenv("HOME");
@@ -95,14 +282,28 @@ bool JunctionD::spawn(const FunctionData &func) {
 
     if (pid == 0) {
         // --- CHILD PROCESS ---
-        dup2(pipe_in[0], STDIN_FILENO);
-        dup2(pipe_out[1], STDOUT_FILENO);
+        // Stamp fork here: the parent may not run again until after the child.
+        const int64_t forkNs = phaseNow();
+        dup2(pipe_in.fd[0], STDIN_FILENO);
+        dup2(pipe_out.fd[1], STDOUT_FILENO);
 
         // Close all pipe ends
-        close(pipe_in[0]);
-        close(pipe_in[1]);
-        close(pipe_out[0]);
-        close(pipe_out[1]);
+        close(pipe_in.fd[0]);
+        close(pipe_in.fd[1]);
+        close(pipe_out.fd[0]);
+        close(pipe_out.fd[1]);
+
+        for (const auto &kv : func.env) setenv(kv.first.c_str(), kv.second.c_str(), 1);
+        // Shared model memfds are CLOEXEC like the phase pipes; only this
+        // instance's own model survives exec, and it learns which descriptor it is.
+        if (modelFd >= 0) {
+            fcntl(modelFd, F_SETFD, 0);
+            setenv("JUNCTION_MODEL_FD", std::to_string(modelFd).c_str(), 1);
+        }
+        // Only this instance's phase pipe survives exec.
+        close(pipe_phase.fd[0]);
+        fcntl(pipe_phase.fd[1], F_SETFD, 0);
+        setenv("JUNCTION_PHASE_FD", std::to_string(pipe_phase.fd[1]).c_str(), 1);
 
         //  Prepare arguments 
         std::vector<std::string> full_cmd_args;
@@ -123,6 +324,10 @@ bool JunctionD::spawn(const FunctionData &func) {
         for (auto &a : full_cmd_args) std::cerr << " " << a;
         std::cerr << std::endl;
         // Execute
+        char childMarks[128];
+        int n = snprintf(childMarks, sizeof(childMarks), "PHASE fork %lld\nPHASE exec %lld\n",
+                         static_cast<long long>(forkNs), static_cast<long long>(phaseNow()));
+        (void)!write(pipe_phase.fd[1], childMarks, n);
         execvp(junctionRun.c_str(), c_args.data());
         std::cerr << "[junctiond] Exec failed: " << strerror(errno) << std::endl;
         exit(1);
@@ -132,9 +337,11 @@ bool JunctionD::spawn(const FunctionData &func) {
 
     // A. Close the ends we don't use
     // We WRITE to pipe_in, so close the read end
-    close(pipe_in[0]); 
+    pipe_in.closeEnd(0);
     // We READ from pipe_out, so close the write end
-    close(pipe_out[1]);
+    pipe_out.closeEnd(1);
+    pipe_phase.closeEnd(1);
+    fcntl(pipe_phase.fd[0], F_SETFL, O_NONBLOCK);
 
     std::lock_guard<std::mutex> lock(mtx);
 
@@ -144,8 +351,8 @@ bool JunctionD::spawn(const FunctionData &func) {
 
     status.name     = func.name;
     status.pid      = pid;
-    status.fd_write = pipe_in[1];
-    status.fd_read  = pipe_out[0];
+    status.fd_write = pipe_in.release(1);
+    status.fd_read  = pipe_out.release(0);
     status.running  = true;
     
     Job newJob;
@@ -154,6 +361,8 @@ bool JunctionD::spawn(const FunctionData &func) {
     newJob.fd_write = status.fd_write;
     newJob.fd_read = status.fd_read;
     newJob.startTime = startTime;
+    newJob.fd_phase = pipe_phase.release(0);
+    newJob.phases = std::move(marks);
     activeJobs.push_back(newJob);
     
     
@@ -177,7 +386,19 @@ bool JunctionD::remove(const std::string &name) {
     std::string cfgPath = "/tmp/junction_" + name + ".config";
     unlink(cfgPath.c_str());
 
+    // The pipes belong to this instance; without this every spawn leaks two fds.
+    if (status.fd_write >= 0) close(status.fd_write);
+    if (status.fd_read >= 0) close(status.fd_read);
+    for (auto j = activeJobs.begin(); j != activeJobs.end(); ++j) {
+        if (j->name == name) {
+            if (j->fd_phase >= 0) close(j->fd_phase);
+            activeJobs.erase(j);
+            break;
+        }
+    }
+
     statusMap.erase(it);
+    junctiondMetrics().removed.inc();
     return true;
 }
 
@@ -190,26 +411,52 @@ std::vector<FunctionStatus> JunctionD::list() {
     return functions;
 }
 
-// This runs in a continuous background loop to clean up dead processes.
+// This runs in a continuous background loop to clean up dead processes, and
+// samples the memory footprint of the live ones.
 void JunctionD::monitorInstances() {
-    while (true) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    long sampleMs = 2000;
+    if (const char *env = std::getenv("JUNCTIOND_MEMORY_SAMPLE_MS")) sampleMs = std::atol(env);
+    auto nextSample = std::chrono::steady_clock::now();
 
-        std::lock_guard<std::mutex> lock(mtx);
+    while (true) {
+        std::vector<std::pair<std::string, pid_t>> toSample;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            if (monitorWake.wait_for(lock, std::chrono::milliseconds(500), [this] { return monitorStop; })) return;
+
+            for (auto &it : statusMap) {
+                FunctionStatus &fs = it.second;
+
+                int status;
+                pid_t ret = waitpid(fs.pid, &status, WNOHANG);
+
+                if (ret == fs.pid) {
+                    if (fs.running) {
+                        std::cout << "[junctiond] Instance '" << fs.name
+                                  << "' (PID " << fs.pid << ") terminated.\n";
+                    }
+                    fs.running = false;
+                    fs.memory = MemoryFootprint();
+                }
+                if (fs.running) toSample.emplace_back(fs.name, fs.pid);
+            }
+        }
 
-        for (auto &it : statusMap) {
-            FunctionStatus &fs = it.second;
+        const auto now = std::chrono::steady_clock::now();
+        if (sampleMs <= 0 || now < nextSample || toSample.empty()) continue;
+        nextSample = now + std::chrono::milliseconds(sampleMs);
 
-            int status;
-            pid_t ret = waitpid(fs.pid, &status, WNOHANG);
+        // Read without the lock: the kernel walks each instance's page tables.
+        std::vector<MemoryFootprint> sampled;
+        sampled.reserve(toSample.size());
+        for (auto &s : toSample) sampled.push_back(readMemoryFootprint(s.second));
 
-            if (ret == fs.pid) {
-                if (fs.running) {
-                    std::cout << "[junctiond] Instance '" << fs.name
-                              << "' (PID " << fs.pid << ") terminated.\n";
-                }
-                fs.running = false;
-            }
+        std::lock_guard<std::mutex> lock(mtx);
+        for (size_t i = 0; i < toSample.size(); ++i) {
+            auto it = statusMap.find(toSample[i].first);
+            // Skip instances removed or respawned while we were reading.
+            if (it == statusMap.end() || it->second.pid != toSample[i].second || !it->second.running) continue;
+            it->second.memory = sampled[i];
         }
     }
 }
@@ -250,4 +497,51 @@ bool JunctionD::generateConfig(const FunctionData &func, std::string &cfgPath) {
 
     std::cout << "[junctiond] Generated config at " << cfgPath << std::endl;
     return true;
-}
\ No newline at end of file
+}
+
+// Copy the model into a memfd once and seal it read-only. Instances map the
+// descriptor MAP_SHARED, so however many are running, the weights occupy one set
+// of shmem pages instead of one private copy each.
+int JunctionD::sharedModelFd(const std::string &path) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = sharedModels.find(path);
+    if (it != sharedModels.end()) return it->second;
+
+    int src = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (src < 0) {
+        std::cerr << "[junctiond] Cannot open shared model " << path << ": " << strerror(errno) << std::endl;
+        return -1;
+    }
+    struct stat st;
+    if (fstat(src, &st) != 0) {
+        std::cerr << "[junctiond] Cannot stat shared model " << path << ": " << strerror(errno) << std::endl;
+        close(src);
+        return -1;
+    }
+
+    // CLOEXEC: every later fork (other instances, the gateway's cold-path execs)
+    // would otherwise inherit every model. spawnInstance clears it in the one
+    // child that gets this model.
+    int fd = memfd_create("junction_model", MFD_ALLOW_SEALING | MFD_CLOEXEC);
+    if (fd < 0) {
+        std::cerr << "[junctiond] memfd_create failed: " << strerror(errno) << std::endl;
+        close(src);
+        return -1;
+    }
+    off_t offset = 0;
+    bool ok = ftruncate(fd, st.st_size) == 0;
+    while (ok && offset < st.st_size) {
+        ssize_t n = sendfile(fd, src, &offset, static_cast<size_t>(st.st_size - offset));
+        if (n <= 0) ok = false;
+    }
+    close(src);
+    if (!ok || fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) != 0) {
+        std::cerr << "[junctiond] Failed to stage shared model " << path << ": " << strerror(errno) << std::endl;
+        close(fd);
+        return -1;
+    }
+
+    std::cout << "[junctiond] Shared model " << path << " (" << st.st_size << " bytes) as fd " << fd << std::endl;
+    sharedModels[path] = fd;
+    return fd;
+}
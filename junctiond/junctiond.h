@@ -5,7 +5,12 @@
 #include <map>
 #include <vector>
 #include <mutex>
+#include <condition_variable>
 #include <thread>
+#include <chrono>
+
+#include "cold_start_trace.h"
+#include "memory_footprint.h"
 
 struct FunctionData {
     std::string name;
@@ -14,6 +19,9 @@ struct FunctionData {
     int cpu;
     int memoryMB;
     std::map<std::string, std::string> env;
+    // Model file to hand the instance as a sealed memfd (JUNCTION_MODEL_FD), so
+    // every instance of the model maps the same pages. Empty: none.
+    std::string sharedModel;
 };
 
 struct FunctionStatus {
@@ -24,6 +32,10 @@ struct FunctionStatus {
     // Add these two:
     int fd_write; 
     int fd_read;  
+
+    // Last smaps_rollup sample of a running instance, refreshed by the monitor
+    // thread every JUNCTIOND_MEMORY_SAMPLE_MS (default 2000, 0 disables).
+    MemoryFootprint memory;
 };
 // Represents a job currently running in the background
 struct Job {
@@ -34,13 +46,16 @@ struct Job {
     std::chrono::steady_clock::time_point startTime;
     bool startupCaptured = false;
     double startupTime = 0.0;
+    int fd_phase = -1;            // read end of the instance's JUNCTION_PHASE_FD pipe
+    std::string phaseBuffer;      // partial line not parsed yet
+    std::vector<PhaseMark> phases; // spawn, config, fork, exec, then the instance's marks
 };
 
 struct JobResult {
     std::string name;
     std::string output;
-    double startupSeconds; // Time from fork to "READY"
-    double totalSeconds;   // Time from fork to exit
+    double startupSeconds; // Time from spawn to the instance's "ready" mark (0 if it sent none)
+    double totalSeconds;   // Time from spawn to exit
 };
 
 class JunctionD {
@@ -48,20 +63,41 @@ public:
     JunctionD();
     ~JunctionD();
 
+    // Also records junctiond_spawns_total and junctiond_spawn_duration_seconds in
+    // metrics::Registry::global().
     bool spawn(const FunctionData &func);
     bool remove(const std::string &name);
     JobResult collect(std::string name);
     std::vector<FunctionStatus> list();
 
+    // Cold-start timeline of an instance: JunctionD's own marks merged with the
+    // phase marks the instance has sent so far. Empty if `name` is unknown.
+    std::vector<PhaseMark> phases(const std::string &name);
+    // The same timeline as Chrome trace JSON.
+    std::string chromeTrace(const std::string &name);
+
 private:
+    // Reads junctiond_instances{state="running"}: running instances over every
+    // live JunctionD in the process.
+    static double runningInstances();
     void monitorInstances();
+    bool spawnInstance(const FunctionData &func);
     
     bool generateConfig(const FunctionData &func, std::string &cfgPath); // declare here
+    int sharedModelFd(const std::string &path);
+    Job *findJob(const std::string &name);
+    void drainPhases(Job &job);
+
+    // One memfd per shared model path, created on first spawn and kept for the
+    // daemon's lifetime so later instances reuse the same pages.
+    std::map<std::string, int> sharedModels;
 
     std::map<std::string, FunctionStatus> statusMap;
     std::vector<Job> activeJobs;
     std::mutex mtx;
     std::thread monitorThread;
+    std::condition_variable monitorWake;  // the destructor stops the monitor early
+    bool monitorStop = false;             // guarded by mtx
 };
 
 
@@ -1,5 +1,6 @@
 #include "junctiond.grpc.pb.h"
 #include "junctiond.h"
+#include "metrics.h"
 
 #include <grpcpp/grpcpp.h>
 #include <memory>
@@ -67,10 +68,28 @@ public:
             f->set_name(st.name);
             f->set_running(st.running);
             f->set_pid(st.pid);
+            if (st.memory.valid) {
+                auto* m = f->mutable_memory();
+                m->set_rss_kb(st.memory.rssKB);
+                m->set_pss_kb(st.memory.pssKB);
+                m->set_shared_kb(st.memory.sharedKB);
+                m->set_private_dirty_kb(st.memory.privateDirtyKB);
+                m->set_swap_kb(st.memory.swapKB);
+                m->set_sampled_unix_ns(st.memory.sampledNs);
+            }
         }
         return Status::OK;
     }
 
+    // gRPC wrapper for the process-wide metrics registry
+    Status GetMetrics(ServerContext* ctx,
+                      const junctiond::Empty*,
+                      junctiond::MetricsReply* reply) override
+    {
+        reply->set_text(metrics::Registry::global().expose());
+        return Status::OK;
+    }
+
 private:
     JunctionD* jd_;   // Your real implementation lives here
 };
@@ -0,0 +1,53 @@
+#include "memory_footprint.h"
+
+#include "cold_start_trace.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+// "Rss:                1388 kB" -> 1388, if `line` starts with `key` (colon included).
+bool field(const char *line, const char *key, uint64_t &out) {
+    const size_t n = std::strlen(key);
+    if (std::strncmp(line, key, n) != 0) return false;
+    out = std::strtoull(line + n, nullptr, 10);
+    return true;
+}
+}  // namespace
+
+MemoryFootprint readMemoryFootprint(pid_t pid) {
+    MemoryFootprint m;
+    char path[64];
+    std::snprintf(path, sizeof(path), "/proc/%d/smaps_rollup", static_cast<int>(pid));
+    const int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return m;
+
+    // About 1 KB of text; read it whole so the kernel generates it once.
+    char buf[4096];
+    size_t len = 0;
+    ssize_t r;
+    while (len < sizeof(buf) - 1 && (r = read(fd, buf + len, sizeof(buf) - 1 - len)) > 0) len += r;
+    close(fd);
+    if (len == 0) return m;
+    buf[len] = '\0';
+
+    uint64_t sharedClean = 0, sharedDirty = 0, v = 0;
+    for (char *line = buf; line && *line;) {
+        char *next = std::strchr(line, '\n');
+        if (next) *next++ = '\0';
+        if (field(line, "Rss:", v)) m.rssKB = v;
+        else if (field(line, "Pss:", v)) m.pssKB = v;
+        else if (field(line, "Shared_Clean:", v)) sharedClean = v;
+        else if (field(line, "Shared_Dirty:", v)) sharedDirty = v;
+        else if (field(line, "Private_Dirty:", v)) m.privateDirtyKB = v;
+        else if (field(line, "Swap:", v)) m.swapKB = v;
+        line = next;
+    }
+    m.sharedKB = sharedClean + sharedDirty;
+    m.sampledNs = phaseNow();
+    m.valid = true;
+    return m;
+}
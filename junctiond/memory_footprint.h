@@ -0,0 +1,28 @@
+#ifndef MEMORY_FOOTPRINT_H
+#define MEMORY_FOOTPRINT_H
+
+#include <cstdint>
+#include <sys/types.h>
+
+// How much memory an instance holds, and how much of it is its own, from
+// /proc/<pid>/smaps_rollup (Linux 4.14+). PSS splits every shared page evenly
+// between its mappers. So instances that map the same model memfd
+// (FunctionData::sharedModel) are each charged their share of the weights:
+// summed over instances, PSS is what they really cost the host. Private_Dirty is
+// what eviction would give back for certain.
+struct MemoryFootprint {
+    bool valid = false;        // false until sampled, or if the read failed
+    uint64_t rssKB = 0;
+    uint64_t pssKB = 0;
+    uint64_t sharedKB = 0;     // Shared_Clean + Shared_Dirty
+    uint64_t privateDirtyKB = 0;
+    uint64_t swapKB = 0;
+    int64_t sampledNs = 0;     // CLOCK_REALTIME of the read
+};
+
+// One read of /proc/<pid>/smaps_rollup. The kernel walks the process's page
+// tables to produce it, so this costs roughly a millisecond per GB resident:
+// fine every few seconds, not per request.
+MemoryFootprint readMemoryFootprint(pid_t pid);
+
+#endif // MEMORY_FOOTPRINT_H
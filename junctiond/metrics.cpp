@@ -0,0 +1,198 @@
+#include "metrics.h"
+
+#include <cmath>
+#include <cstdio>
+#include <sstream>
+
+namespace metrics {
+
+size_t nextShard() {
+    static std::atomic<size_t> next{0};
+    return next.fetch_add(1, std::memory_order_relaxed) % kShards;
+}
+
+uint64_t Counter::value() const {
+    uint64_t total = 0;
+    for (const auto &s : shards) total += s.value.load(std::memory_order_relaxed);
+    return total;
+}
+
+void Gauge::set(int64_t v) {
+    for (auto &s : shards) s.value.store(0, std::memory_order_relaxed);
+    shards[0].value.store(v, std::memory_order_relaxed);
+}
+
+int64_t Gauge::value() const {
+    int64_t total = 0;
+    for (const auto &s : shards) total += s.value.load(std::memory_order_relaxed);
+    return total;
+}
+
+double Histogram::bucketUpper(size_t index) {
+    if (index < 4) return static_cast<double>(index + 1);
+    const int k = static_cast<int>((index - 4) / 4) + 2;
+    const double sub = static_cast<double>((index - 4) % 4);
+    return (4 + sub + 1) * std::ldexp(1.0, k - 2);
+}
+
+Histogram::Snapshot Histogram::snapshot() const {
+    Snapshot snap;
+    uint64_t sumTicks = 0;
+    for (const auto &s : shards) {
+        for (size_t i = 0; i < kBuckets; ++i) snap.buckets[i] += s.buckets[i].load(std::memory_order_relaxed);
+        sumTicks += s.sumTicks.load(std::memory_order_relaxed);
+    }
+    for (uint64_t b : snap.buckets) snap.count += b;
+    snap.sum = static_cast<double>(sumTicks) * resolution;
+    return snap;
+}
+
+Registry::Series &Registry::series(const std::string &name, const std::string &help, Type type,
+                                   const Labels &labels) {
+    Family *family = nullptr;
+    for (auto &f : families) {
+        if (f.name == name) {
+            family = &f;
+            break;
+        }
+    }
+    if (!family) {
+        families.push_back({name, help, type, {}});
+        family = &families.back();
+    }
+    for (auto &s : family->series) {
+        if (s.labels == labels) return s;
+    }
+    family->series.emplace_back();
+    family->series.back().labels = labels;
+    return family->series.back();
+}
+
+Counter &Registry::counter(const std::string &name, const std::string &help, const Labels &labels) {
+    std::lock_guard<std::mutex> lock(mtx);
+    Series &s = series(name, help, Type::Counter, labels);
+    if (!s.counter) s.counter = std::make_unique<Counter>();
+    return *s.counter;
+}
+
+Gauge &Registry::gauge(const std::string &name, const std::string &help, const Labels &labels) {
+    std::lock_guard<std::mutex> lock(mtx);
+    Series &s = series(name, help, Type::Gauge, labels);
+    if (!s.gauge) s.gauge = std::make_unique<Gauge>();
+    return *s.gauge;
+}
+
+Histogram &Registry::histogram(const std::string &name, const std::string &help, const Labels &labels,
+                               double resolution) {
+    std::lock_guard<std::mutex> lock(mtx);
+    Series &s = series(name, help, Type::Histogram, labels);
+    if (!s.histogram) s.histogram = std::make_unique<Histogram>(resolution);
+    return *s.histogram;
+}
+
+void Registry::gaugeCallback(const std::string &name, const std::string &help, const Labels &labels,
+                             std::function<double()> read) {
+    std::lock_guard<std::mutex> lock(mtx);
+    series(name, help, Type::Gauge, labels).read = std::move(read);
+}
+
+namespace {
+std::string escapeLabel(const std::string &v) {
+    std::string out;
+    for (char c : v) {
+        if (c == '\\' || c == '"') out += '\\';
+        if (c == '\n') {
+            out += "\\n";
+            continue;
+        }
+        out += c;
+    }
+    return out;
+}
+
+// {a="x",b="y"}, with `extra` (le="...") appended; empty for no labels.
+std::string labelSet(const Labels &labels, const std::string &extra = "") {
+    if (labels.empty() && extra.empty()) return "";
+    std::string out = "{";
+    for (size_t i = 0; i < labels.size(); ++i) {
+        if (i) out += ',';
+        out += labels[i].first + "=\"" + escapeLabel(labels[i].second) + "\"";
+    }
+    if (!extra.empty()) out += (labels.empty() ? "" : ",") + extra;
+    return out + "}";
+}
+
+std::string number(double v) {
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.9g", v);
+    return buf;
+}
+}  // namespace
+
+std::string Registry::expose() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    std::ostringstream os;
+    for (const auto &f : families) {
+        const char *type = f.type == Type::Counter ? "counter" : f.type == Type::Gauge ? "gauge" : "histogram";
+        os << "# HELP " << f.name << " " << f.help << "\n# TYPE " << f.name << " " << type << "\n";
+        for (const auto &s : f.series) {
+            if (s.counter) {
+                os << f.name << labelSet(s.labels) << " " << s.counter->value() << "\n";
+            } else if (s.gauge) {
+                os << f.name << labelSet(s.labels) << " " << s.gauge->value() << "\n";
+            } else if (s.read) {
+                os << f.name << labelSet(s.labels) << " " << number(s.read()) << "\n";
+            } else if (s.histogram) {
+                const Histogram::Snapshot snap = s.histogram->snapshot();
+                // Buckets up to the highest one ever hit; the set only grows.
+                size_t last = 0;
+                for (size_t i = 0; i < Histogram::kBuckets; ++i) {
+                    if (snap.buckets[i]) last = i;
+                }
+                uint64_t cumulative = 0;
+                for (size_t i = 0; snap.count && i <= last; ++i) {
+                    cumulative += snap.buckets[i];
+                    const double le = Histogram::bucketUpper(i) * s.histogram->unit();
+                    os << f.name << "_bucket" << labelSet(s.labels, "le=\"" + number(le) + "\"") << " " << cumulative
+                       << "\n";
+                }
+                os << f.name << "_bucket" << labelSet(s.labels, "le=\"+Inf\"") << " " << snap.count << "\n";
+                os << f.name << "_sum" << labelSet(s.labels) << " " << number(snap.sum) << "\n";
+                os << f.name << "_count" << labelSet(s.labels) << " " << snap.count << "\n";
+            }
+        }
+    }
+    return os.str();
+}
+
+namespace {
+Labels withStatus(Labels labels, const char *status) {
+    labels.emplace_back("status", status);
+    return labels;
+}
+}  // namespace
+
+RequestMetrics::RequestMetrics(Registry &registry, const std::string &prefix, const Labels &labels)
+    : inflight(registry.gauge(prefix + "_inflight_requests", "Requests being handled", labels)),
+      duration(registry.histogram(prefix + "_request_duration_seconds", "Time to handle a request", labels)) {
+    static const char *classes[] = {"1xx", "2xx", "3xx", "4xx", "5xx"};
+    for (size_t i = 0; i < byStatusClass.size(); ++i) {
+        byStatusClass[i] = &registry.counter(prefix + "_requests_total", "Requests handled, by status class",
+                                             withStatus(labels, classes[i]));
+    }
+}
+
+RequestMetrics::Scope::~Scope() {
+    metrics.duration.observe(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    // httplib leaves status at -1 until after the handler, then sends 200.
+    const int cls = (status > 0 ? status : 200) / 100;
+    metrics.byStatusClass[cls >= 1 && cls <= 5 ? cls - 1 : 4]->inc();
+}
+
+Registry &Registry::global() {
+    // Never destroyed: threads may still record while the process exits.
+    static Registry *registry = new Registry();
+    return *registry;
+}
+
+}  // namespace metrics
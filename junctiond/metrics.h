@@ -0,0 +1,204 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+// Prometheus-style metrics shared by junctiond, the gateway and the function
+// services.
+//
+// Counters, gauges and histograms are split into per-thread shards, each on its own
+// cache line: recording is one relaxed atomic add on the calling thread's shard
+// (a few ns, no contention between threads), and only a scrape walks every shard
+// to sum them. Metrics are created once at startup through a Registry and then
+// recorded through the returned reference, which stays valid for the registry's
+// lifetime; the registry's lock is taken only to register and to expose.
+//
+// Histograms are log-linear: every power of two is split into four equal buckets,
+// so a bucket is at most 25% wide relative to its value, from 1 resolution unit
+// (1 us by default) up to the full 64-bit range, with no configuration.
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace metrics {
+
+using Labels = std::vector<std::pair<std::string, std::string>>;
+
+constexpr size_t kShards = 16;
+
+size_t nextShard();
+
+// The shard this thread records into; threads are spread round-robin. Constant
+// initialized, so reading it needs no thread_local guard.
+inline size_t shardIndex() {
+    static thread_local size_t index = kShards;
+    if (__builtin_expect(index == kShards, 0)) index = nextShard();
+    return index;
+}
+
+class Counter {
+public:
+    void inc(uint64_t n = 1) { shards[shardIndex()].value.fetch_add(n, std::memory_order_relaxed); }
+    uint64_t value() const;
+
+private:
+    struct alignas(64) Shard {
+        std::atomic<uint64_t> value{0};
+    };
+    std::array<Shard, kShards> shards;
+};
+
+// Use add() for values that move up and down (in-flight requests) or set() for
+// ones sampled whole, not both on one gauge: set() is not atomic with
+// concurrent adds.
+class Gauge {
+public:
+    void add(int64_t n) { shards[shardIndex()].value.fetch_add(n, std::memory_order_relaxed); }
+    void sub(int64_t n) { add(-n); }
+    void set(int64_t v);
+    int64_t value() const;
+
+private:
+    struct alignas(64) Shard {
+        std::atomic<int64_t> value{0};
+    };
+    std::array<Shard, kShards> shards;
+};
+
+class Histogram {
+public:
+    static constexpr size_t kBuckets = 252;  // 4 exact + 4 per power of two from 4 up to 2^64
+
+    // Values are observed in the unit they are exposed in (seconds) and counted in
+    // steps of `resolution`.
+    explicit Histogram(double resolution = 1e-6) : resolution(resolution), scale(1.0 / resolution) {}
+
+    void observe(double v) {
+        const uint64_t ticks = v > 0 ? static_cast<uint64_t>(v * scale) : 0;
+        Shard &s = shards[shardIndex()];
+        s.buckets[bucketOf(ticks)].fetch_add(1, std::memory_order_relaxed);
+        s.sumTicks.fetch_add(ticks, std::memory_order_relaxed);
+    }
+
+    static size_t bucketOf(uint64_t ticks) {
+        if (ticks < 4) return static_cast<size_t>(ticks);
+        const int k = 63 - __builtin_clzll(ticks);
+        return 4 + static_cast<size_t>(k - 2) * 4 + static_cast<size_t>((ticks >> (k - 2)) & 3);
+    }
+    // Exclusive upper bound of a bucket, in ticks.
+    static double bucketUpper(size_t index);
+
+    struct Snapshot {
+        std::array<uint64_t, kBuckets> buckets{};
+        uint64_t count = 0;
+        double sum = 0;
+    };
+    Snapshot snapshot() const;
+    double unit() const { return resolution; }
+
+private:
+    struct alignas(64) Shard {
+        std::array<std::atomic<uint64_t>, kBuckets> buckets{};
+        std::atomic<uint64_t> sumTicks{0};
+    };
+    double resolution;
+    double scale;
+    std::array<Shard, kShards> shards;
+};
+
+class Registry {
+public:
+    // The same name and labels return the same metric. A name keeps the type and
+    // help it was first registered with.
+    Counter &counter(const std::string &name, const std::string &help, const Labels &labels = {});
+    Gauge &gauge(const std::string &name, const std::string &help, const Labels &labels = {});
+    Histogram &histogram(const std::string &name, const std::string &help, const Labels &labels = {},
+                         double resolution = 1e-6);
+    // A gauge read at scrape time, for state something else already tracks
+    // (queue depth, running instances). `read` must stay callable for the
+    // registry's lifetime.
+    void gaugeCallback(const std::string &name, const std::string &help, const Labels &labels,
+                       std::function<double()> read);
+
+    // Text exposition format 0.0.4, as served on /metrics.
+    std::string expose() const;
+
+    // The process-wide registry every component records into.
+    static Registry &global();
+
+private:
+    enum class Type { Counter, Gauge, Histogram };
+    struct Series {
+        Labels labels;
+        std::unique_ptr<Counter> counter;
+        std::unique_ptr<Gauge> gauge;
+        std::unique_ptr<Histogram> histogram;
+        std::function<double()> read;
+    };
+    struct Family {
+        std::string name;
+        std::string help;
+        Type type;
+        std::deque<Series> series;
+    };
+
+    Series &series(const std::string &name, const std::string &help, Type type, const Labels &labels);
+
+    mutable std::mutex mtx;
+    std::deque<Family> families;
+};
+
+// Prometheus' content type for expose().
+constexpr const char *kContentType = "text/plain; version=0.0.4";
+
+// Adds one to a gauge for as long as it lives (in-flight requests).
+class InFlight {
+public:
+    explicit InFlight(Gauge &g) : gauge(g) { gauge.add(1); }
+    ~InFlight() { gauge.sub(1); }
+    InFlight(const InFlight &) = delete;
+    InFlight &operator=(const InFlight &) = delete;
+
+private:
+    Gauge &gauge;
+};
+
+// The usual metrics of one kind of HTTP request: <prefix>_requests_total by
+// status class, <prefix>_inflight_requests and <prefix>_request_duration_seconds.
+class RequestMetrics {
+public:
+    RequestMetrics(Registry &registry, const std::string &prefix, const Labels &labels = {});
+
+    // Times one request from construction and counts it, by the HTTP status
+    // `status` holds when the scope ends.
+    class Scope {
+    public:
+        Scope(RequestMetrics &m, const int &status)
+            : metrics(m), status(status), inflight(m.inflight), start(std::chrono::steady_clock::now()) {}
+        ~Scope();
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        RequestMetrics &metrics;
+        const int &status;
+        InFlight inflight;
+        std::chrono::steady_clock::time_point start;
+    };
+
+private:
+    std::array<Counter *, 5> byStatusClass;  // 1xx..5xx
+    Gauge &inflight;
+    Histogram &duration;
+};
+
+}  // namespace metrics
+
+#endif  // METRICS_H
@@ -1,7 +1,7 @@
 // Code generated by protoc-gen-go. DO NOT EDIT.
 // versions:
 // 	protoc-gen-go v1.36.11
-// 	protoc        v5.26.1
+// 	protoc        v3.21.12
 // source: junctiond/proto/junctiond.proto
 
 package junctiond
@@ -187,10 +187,13 @@ func (x *FunctionName) GetName() string {
 }
 
 type FunctionStatus struct {
-	state         protoimpl.MessageState `protogen:"open.v1"`
-	Name          string                 `protobuf:"bytes,1,opt,name=name,proto3" json:"name,omitempty"`
-	Running       bool                   `protobuf:"varint,2,opt,name=running,proto3" json:"running,omitempty"`
-	Pid           int32                  `protobuf:"varint,3,opt,name=pid,proto3" json:"pid,omitempty"`
+	state   protoimpl.MessageState `protogen:"open.v1"`
+	Name    string                 `protobuf:"bytes,1,opt,name=name,proto3" json:"name,omitempty"`
+	Running bool                   `protobuf:"varint,2,opt,name=running,proto3" json:"running,omitempty"`
+	Pid     int32                  `protobuf:"varint,3,opt,name=pid,proto3" json:"pid,omitempty"`
+	// From /proc/<pid>/smaps_rollup, sampled every few seconds; absent until the
+	// first sample of a running instance.
+	Memory        *MemoryFootprint `protobuf:"bytes,4,opt,name=memory,proto3" json:"memory,omitempty"`
 	unknownFields protoimpl.UnknownFields
 	sizeCache     protoimpl.SizeCache
 }
@@ -246,6 +249,97 @@ func (x *FunctionStatus) GetPid() int32 {
 	return 0
 }
 
+func (x *FunctionStatus) GetMemory() *MemoryFootprint {
+	if x != nil {
+		return x.Memory
+	}
+	return nil
+}
+
+type MemoryFootprint struct {
+	state          protoimpl.MessageState `protogen:"open.v1"`
+	RssKb          uint64                 `protobuf:"varint,1,opt,name=rss_kb,json=rssKb,proto3" json:"rss_kb,omitempty"`
+	PssKb          uint64                 `protobuf:"varint,2,opt,name=pss_kb,json=pssKb,proto3" json:"pss_kb,omitempty"` // shared pages split between their mappers
+	SharedKb       uint64                 `protobuf:"varint,3,opt,name=shared_kb,json=sharedKb,proto3" json:"shared_kb,omitempty"`
+	PrivateDirtyKb uint64                 `protobuf:"varint,4,opt,name=private_dirty_kb,json=privateDirtyKb,proto3" json:"private_dirty_kb,omitempty"`
+	SwapKb         uint64                 `protobuf:"varint,5,opt,name=swap_kb,json=swapKb,proto3" json:"swap_kb,omitempty"`
+	SampledUnixNs  int64                  `protobuf:"varint,6,opt,name=sampled_unix_ns,json=sampledUnixNs,proto3" json:"sampled_unix_ns,omitempty"`
+	unknownFields  protoimpl.UnknownFields
+	sizeCache      protoimpl.SizeCache
+}
+
+func (x *MemoryFootprint) Reset() {
+	*x = MemoryFootprint{}
+	mi := &file_junctiond_proto_junctiond_proto_msgTypes[4]
+	ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+	ms.StoreMessageInfo(mi)
+}
+
+func (x *MemoryFootprint) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*MemoryFootprint) ProtoMessage() {}
+
+func (x *MemoryFootprint) ProtoReflect() protoreflect.Message {
+	mi := &file_junctiond_proto_junctiond_proto_msgTypes[4]
+	if x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use MemoryFootprint.ProtoReflect.Descriptor instead.
+func (*MemoryFootprint) Descriptor() ([]byte, []int) {
+	return file_junctiond_proto_junctiond_proto_rawDescGZIP(), []int{4}
+}
+
+func (x *MemoryFootprint) GetRssKb() uint64 {
+	if x != nil {
+		return x.RssKb
+	}
+	return 0
+}
+
+func (x *MemoryFootprint) GetPssKb() uint64 {
+	if x != nil {
+		return x.PssKb
+	}
+	return 0
+}
+
+func (x *MemoryFootprint) GetSharedKb() uint64 {
+	if x != nil {
+		return x.SharedKb
+	}
+	return 0
+}
+
+func (x *MemoryFootprint) GetPrivateDirtyKb() uint64 {
+	if x != nil {
+		return x.PrivateDirtyKb
+	}
+	return 0
+}
+
+func (x *MemoryFootprint) GetSwapKb() uint64 {
+	if x != nil {
+		return x.SwapKb
+	}
+	return 0
+}
+
+func (x *MemoryFootprint) GetSampledUnixNs() int64 {
+	if x != nil {
+		return x.SampledUnixNs
+	}
+	return 0
+}
+
 type FunctionList struct {
 	state         protoimpl.MessageState `protogen:"open.v1"`
 	Functions     []*FunctionStatus      `protobuf:"bytes,1,rep,name=functions,proto3" json:"functions,omitempty"`
@@ -255,7 +349,7 @@ type FunctionList struct {
 
 func (x *FunctionList) Reset() {
 	*x = FunctionList{}
-	mi := &file_junctiond_proto_junctiond_proto_msgTypes[4]
+	mi := &file_junctiond_proto_junctiond_proto_msgTypes[5]
 	ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 	ms.StoreMessageInfo(mi)
 }
@@ -267,7 +361,7 @@ func (x *FunctionList) String() string {
 func (*FunctionList) ProtoMessage() {}
 
 func (x *FunctionList) ProtoReflect() protoreflect.Message {
-	mi := &file_junctiond_proto_junctiond_proto_msgTypes[4]
+	mi := &file_junctiond_proto_junctiond_proto_msgTypes[5]
 	if x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -280,7 +374,7 @@ func (x *FunctionList) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use FunctionList.ProtoReflect.Descriptor instead.
 func (*FunctionList) Descriptor() ([]byte, []int) {
-	return file_junctiond_proto_junctiond_proto_rawDescGZIP(), []int{4}
+	return file_junctiond_proto_junctiond_proto_rawDescGZIP(), []int{5}
 }
 
 func (x *FunctionList) GetFunctions() []*FunctionStatus {
@@ -300,7 +394,7 @@ type StatusReply struct {
 
 func (x *StatusReply) Reset() {
 	*x = StatusReply{}
-	mi := &file_junctiond_proto_junctiond_proto_msgTypes[5]
+	mi := &file_junctiond_proto_junctiond_proto_msgTypes[6]
 	ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 	ms.StoreMessageInfo(mi)
 }
@@ -312,7 +406,7 @@ func (x *StatusReply) String() string {
 func (*StatusReply) ProtoMessage() {}
 
 func (x *StatusReply) ProtoReflect() protoreflect.Message {
-	mi := &file_junctiond_proto_junctiond_proto_msgTypes[5]
+	mi := &file_junctiond_proto_junctiond_proto_msgTypes[6]
 	if x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -325,7 +419,7 @@ func (x *StatusReply) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use StatusReply.ProtoReflect.Descriptor instead.
 func (*StatusReply) Descriptor() ([]byte, []int) {
-	return file_junctiond_proto_junctiond_proto_rawDescGZIP(), []int{5}
+	return file_junctiond_proto_junctiond_proto_rawDescGZIP(), []int{6}
 }
 
 func (x *StatusReply) GetSuccess() bool {
@@ -342,6 +436,50 @@ func (x *StatusReply) GetMessage() string {
 	return ""
 }
 
+type MetricsReply struct {
+	state         protoimpl.MessageState `protogen:"open.v1"`
+	Text          string                 `protobuf:"bytes,1,opt,name=text,proto3" json:"text,omitempty"`
+	unknownFields protoimpl.UnknownFields
+	sizeCache     protoimpl.SizeCache
+}
+
+func (x *MetricsReply) Reset() {
+	*x = MetricsReply{}
+	mi := &file_junctiond_proto_junctiond_proto_msgTypes[7]
+	ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+	ms.StoreMessageInfo(mi)
+}
+
+func (x *MetricsReply) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*MetricsReply) ProtoMessage() {}
+
+func (x *MetricsReply) ProtoReflect() protoreflect.Message {
+	mi := &file_junctiond_proto_junctiond_proto_msgTypes[7]
+	if x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use MetricsReply.ProtoReflect.Descriptor instead.
+func (*MetricsReply) Descriptor() ([]byte, []int) {
+	return file_junctiond_proto_junctiond_proto_rawDescGZIP(), []int{7}
+}
+
+func (x *MetricsReply) GetText() string {
+	if x != nil {
+		return x.Text
+	}
+	return ""
+}
+
 var File_junctiond_proto_junctiond_proto protoreflect.FileDescriptor
 
 const file_junctiond_proto_junctiond_proto_rawDesc = "" +
@@ -356,20 +494,32 @@ const file_junctiond_proto_junctiond_proto_rawDesc = "" +
 	"\bexecpath\x18\x05 \x01(\tR\bexecpath\x12\x12\n" +
 	"\x04args\x18\x06 \x01(\tR\x04args\"\"\n" +
 	"\fFunctionName\x12\x12\n" +
-	"\x04name\x18\x01 \x01(\tR\x04name\"P\n" +
+	"\x04name\x18\x01 \x01(\tR\x04name\"\x84\x01\n" +
 	"\x0eFunctionStatus\x12\x12\n" +
 	"\x04name\x18\x01 \x01(\tR\x04name\x12\x18\n" +
 	"\arunning\x18\x02 \x01(\bR\arunning\x12\x10\n" +
-	"\x03pid\x18\x03 \x01(\x05R\x03pid\"G\n" +
+	"\x03pid\x18\x03 \x01(\x05R\x03pid\x122\n" +
+	"\x06memory\x18\x04 \x01(\v2\x1a.junctiond.MemoryFootprintR\x06memory\"\xc7\x01\n" +
+	"\x0fMemoryFootprint\x12\x15\n" +
+	"\x06rss_kb\x18\x01 \x01(\x04R\x05rssKb\x12\x15\n" +
+	"\x06pss_kb\x18\x02 \x01(\x04R\x05pssKb\x12\x1b\n" +
+	"\tshared_kb\x18\x03 \x01(\x04R\bsharedKb\x12(\n" +
+	"\x10private_dirty_kb\x18\x04 \x01(\x04R\x0eprivateDirtyKb\x12\x17\n" +
+	"\aswap_kb\x18\x05 \x01(\x04R\x06swapKb\x12&\n" +
+	"\x0fsampled_unix_ns\x18\x06 \x01(\x03R\rsampledUnixNs\"G\n" +
 	"\fFunctionList\x127\n" +
 	"\tfunctions\x18\x01 \x03(\v2\x19.junctiond.FunctionStatusR\tfunctions\"A\n" +
 	"\vStatusReply\x12\x18\n" +
 	"\asuccess\x18\x01 \x01(\bR\asuccess\x12\x18\n" +
-	"\amessage\x18\x02 \x01(\tR\amessage2\xb9\x01\n" +
+	"\amessage\x18\x02 \x01(\tR\amessage\"\"\n" +
+	"\fMetricsReply\x12\x12\n" +
+	"\x04text\x18\x01 \x01(\tR\x04text2\xf2\x01\n" +
 	"\x0fJunctionService\x128\n" +
 	"\x05Spawn\x12\x17.junctiond.FunctionData\x1a\x16.junctiond.StatusReply\x129\n" +
 	"\x06Remove\x12\x17.junctiond.FunctionName\x1a\x16.junctiond.StatusReply\x121\n" +
-	"\x04List\x12\x10.junctiond.Empty\x1a\x17.junctiond.FunctionListB5Z3github.com/DonaldLucy/faasd/pkg/junctiond;junctiondb\x06proto3"
+	"\x04List\x12\x10.junctiond.Empty\x1a\x17.junctiond.FunctionList\x127\n" +
+	"\n" +
+	"GetMetrics\x12\x10.junctiond.Empty\x1a\x17.junctiond.MetricsReplyB5Z3github.com/DonaldLucy/faasd/pkg/junctiond;junctiondb\x06proto3"
 
 var (
 	file_junctiond_proto_junctiond_proto_rawDescOnce sync.Once
@@ -383,28 +533,33 @@ func file_junctiond_proto_junctiond_proto_rawDescGZIP() []byte {
 	return file_junctiond_proto_junctiond_proto_rawDescData
 }
 
-var file_junctiond_proto_junctiond_proto_msgTypes = make([]protoimpl.MessageInfo, 6)
+var file_junctiond_proto_junctiond_proto_msgTypes = make([]protoimpl.MessageInfo, 8)
 var file_junctiond_proto_junctiond_proto_goTypes = []any{
-	(*Empty)(nil),          // 0: junctiond.Empty
-	(*FunctionData)(nil),   // 1: junctiond.FunctionData
-	(*FunctionName)(nil),   // 2: junctiond.FunctionName
-	(*FunctionStatus)(nil), // 3: junctiond.FunctionStatus
-	(*FunctionList)(nil),   // 4: junctiond.FunctionList
-	(*StatusReply)(nil),    // 5: junctiond.StatusReply
+	(*Empty)(nil),           // 0: junctiond.Empty
+	(*FunctionData)(nil),    // 1: junctiond.FunctionData
+	(*FunctionName)(nil),    // 2: junctiond.FunctionName
+	(*FunctionStatus)(nil),  // 3: junctiond.FunctionStatus
+	(*MemoryFootprint)(nil), // 4: junctiond.MemoryFootprint
+	(*FunctionList)(nil),    // 5: junctiond.FunctionList
+	(*StatusReply)(nil),     // 6: junctiond.StatusReply
+	(*MetricsReply)(nil),    // 7: junctiond.MetricsReply
 }
 var file_junctiond_proto_junctiond_proto_depIdxs = []int32{
-	3, // 0: junctiond.FunctionList.functions:type_name -> junctiond.FunctionStatus
-	1, // 1: junctiond.JunctionService.Spawn:input_type -> junctiond.FunctionData
-	2, // 2: junctiond.JunctionService.Remove:input_type -> junctiond.FunctionName
-	0, // 3: junctiond.JunctionService.List:input_type -> junctiond.Empty
-	5, // 4: junctiond.JunctionService.Spawn:output_type -> junctiond.StatusReply
-	5, // 5: junctiond.JunctionService.Remove:output_type -> junctiond.StatusReply
-	4, // 6: junctiond.JunctionService.List:output_type -> junctiond.FunctionList
-	4, // [4:7] is the sub-list for method output_type
-	1, // [1:4] is the sub-list for method input_type
-	1, // [1:1] is the sub-list for extension type_name
-	1, // [1:1] is the sub-list for extension extendee
-	0, // [0:1] is the sub-list for field type_name
+	4, // 0: junctiond.FunctionStatus.memory:type_name -> junctiond.MemoryFootprint
+	3, // 1: junctiond.FunctionList.functions:type_name -> junctiond.FunctionStatus
+	1, // 2: junctiond.JunctionService.Spawn:input_type -> junctiond.FunctionData
+	2, // 3: junctiond.JunctionService.Remove:input_type -> junctiond.FunctionName
+	0, // 4: junctiond.JunctionService.List:input_type -> junctiond.Empty
+	0, // 5: junctiond.JunctionService.GetMetrics:input_type -> junctiond.Empty
+	6, // 6: junctiond.JunctionService.Spawn:output_type -> junctiond.StatusReply
+	6, // 7: junctiond.JunctionService.Remove:output_type -> junctiond.StatusReply
+	5, // 8: junctiond.JunctionService.List:output_type -> junctiond.FunctionList
+	7, // 9: junctiond.JunctionService.GetMetrics:output_type -> junctiond.MetricsReply
+	6, // [6:10] is the sub-list for method output_type
+	2, // [2:6] is the sub-list for method input_type
+	2, // [2:2] is the sub-list for extension type_name
+	2, // [2:2] is the sub-list for extension extendee
+	0, // [0:2] is the sub-list for field type_name
 }
 
 func init() { file_junctiond_proto_junctiond_proto_init() }
@@ -418,7 +573,7 @@ func file_junctiond_proto_junctiond_proto_init() {
 			GoPackagePath: reflect.TypeOf(x{}).PkgPath(),
 			RawDescriptor: unsafe.Slice(unsafe.StringData(file_junctiond_proto_junctiond_proto_rawDesc), len(file_junctiond_proto_junctiond_proto_rawDesc)),
 			NumEnums:      0,
-			NumMessages:   6,
+			NumMessages:   8,
 			NumExtensions: 0,
 			NumServices:   1,
 		},
@@ -1,7 +1,7 @@
 // Code generated by protoc-gen-go-grpc. DO NOT EDIT.
 // versions:
 // - protoc-gen-go-grpc v1.6.0
-// - protoc             v5.26.1
+// - protoc             v3.21.12
 // source: junctiond/proto/junctiond.proto
 
 package junctiond
@@ -19,9 +19,10 @@ import (
 const _ = grpc.SupportPackageIsVersion9
 
 const (
-	JunctionService_Spawn_FullMethodName  = "/junctiond.JunctionService/Spawn"
-	JunctionService_Remove_FullMethodName = "/junctiond.JunctionService/Remove"
-	JunctionService_List_FullMethodName   = "/junctiond.JunctionService/List"
+	JunctionService_Spawn_FullMethodName      = "/junctiond.JunctionService/Spawn"
+	JunctionService_Remove_FullMethodName     = "/junctiond.JunctionService/Remove"
+	JunctionService_List_FullMethodName       = "/junctiond.JunctionService/List"
+	JunctionService_GetMetrics_FullMethodName = "/junctiond.JunctionService/GetMetrics"
 )
 
 // JunctionServiceClient is the client API for JunctionService service.
@@ -38,6 +39,8 @@ type JunctionServiceClient interface {
 	Remove(ctx context.Context, in *FunctionName, opts ...grpc.CallOption) (*StatusReply, error)
 	// List all currently running instances (maps to JunctionD::list)
 	List(ctx context.Context, in *Empty, opts ...grpc.CallOption) (*FunctionList, error)
+	// Metrics in the Prometheus text format, as the gateway serves on /metrics
+	GetMetrics(ctx context.Context, in *Empty, opts ...grpc.CallOption) (*MetricsReply, error)
 }
 
 type junctionServiceClient struct {
@@ -78,6 +81,16 @@ func (c *junctionServiceClient) List(ctx context.Context, in *Empty, opts ...grp
 	return out, nil
 }
 
+func (c *junctionServiceClient) GetMetrics(ctx context.Context, in *Empty, opts ...grpc.CallOption) (*MetricsReply, error) {
+	cOpts := append([]grpc.CallOption{grpc.StaticMethod()}, opts...)
+	out := new(MetricsReply)
+	err := c.cc.Invoke(ctx, JunctionService_GetMetrics_FullMethodName, in, out, cOpts...)
+	if err != nil {
+		return nil, err
+	}
+	return out, nil
+}
+
 // JunctionServiceServer is the server API for JunctionService service.
 // All implementations must embed UnimplementedJunctionServiceServer
 // for forward compatibility.
@@ -92,6 +105,8 @@ type JunctionServiceServer interface {
 	Remove(context.Context, *FunctionName) (*StatusReply, error)
 	// List all currently running instances (maps to JunctionD::list)
 	List(context.Context, *Empty) (*FunctionList, error)
+	// Metrics in the Prometheus text format, as the gateway serves on /metrics
+	GetMetrics(context.Context, *Empty) (*MetricsReply, error)
 	mustEmbedUnimplementedJunctionServiceServer()
 }
 
@@ -111,6 +126,9 @@ func (UnimplementedJunctionServiceServer) Remove(context.Context, *FunctionName)
 func (UnimplementedJunctionServiceServer) List(context.Context, *Empty) (*FunctionList, error) {
 	return nil, status.Error(codes.Unimplemented, "method List not implemented")
 }
+func (UnimplementedJunctionServiceServer) GetMetrics(context.Context, *Empty) (*MetricsReply, error) {
+	return nil, status.Error(codes.Unimplemented, "method GetMetrics not implemented")
+}
 func (UnimplementedJunctionServiceServer) mustEmbedUnimplementedJunctionServiceServer() {}
 func (UnimplementedJunctionServiceServer) testEmbeddedByValue()                         {}
 
@@ -186,6 +204,24 @@ func _JunctionService_List_Handler(srv interface{}, ctx context.Context, dec fun
 	return interceptor(ctx, in, info, handler)
 }
 
+func _JunctionService_GetMetrics_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
+	in := new(Empty)
+	if err := dec(in); err != nil {
+		return nil, err
+	}
+	if interceptor == nil {
+		return srv.(JunctionServiceServer).GetMetrics(ctx, in)
+	}
+	info := &grpc.UnaryServerInfo{
+		Server:     srv,
+		FullMethod: JunctionService_GetMetrics_FullMethodName,
+	}
+	handler := func(ctx context.Context, req interface{}) (interface{}, error) {
+		return srv.(JunctionServiceServer).GetMetrics(ctx, req.(*Empty))
+	}
+	return interceptor(ctx, in, info, handler)
+}
+
 // JunctionService_ServiceDesc is the grpc.ServiceDesc for JunctionService service.
 // It's only intended for direct use with grpc.RegisterService,
 // and not to be introspected or modified (even as a copy)
@@ -205,6 +241,10 @@ var JunctionService_ServiceDesc = grpc.ServiceDesc{
 			MethodName: "List",
 			Handler:    _JunctionService_List_Handler,
 		},
+		{
+			MethodName: "GetMetrics",
+			Handler:    _JunctionService_GetMetrics_Handler,
+		},
 	},
 	Streams:  []grpc.StreamDesc{},
 	Metadata: "junctiond/proto/junctiond.proto",
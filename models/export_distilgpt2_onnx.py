@@ -42,6 +42,7 @@ class DistilGPT2WithPast(nn.Module):
         self,
         input_ids,
         attention_mask,
+        position_ids,
         past_0_key, past_0_value,
         past_1_key, past_1_value,
         past_2_key, past_2_value,
@@ -61,6 +62,7 @@ class DistilGPT2WithPast(nn.Module):
         outputs = self.model(
             input_ids=input_ids,
             attention_mask=attention_mask,
+            position_ids=position_ids,
             past_key_values=past_key_values,
             use_cache=True,
         )
@@ -88,7 +90,10 @@ head_dim = model.config.n_embd // num_heads
 past_seq_len = 10
 
 input_ids = torch.ones((1, 1), dtype=torch.long)
-attention_mask = torch.ones((1, 1), dtype=torch.long)
+# The mask covers past + current positions so decoders can bind a full-length mask.
+attention_mask = torch.ones((1, past_seq_len + 1), dtype=torch.long)
+# Explicit positions let batched decoders left-pad ragged pasts without shifting them.
+position_ids = torch.full((1, 1), past_seq_len, dtype=torch.long)
 
 past_shape = (1, num_heads, past_seq_len, head_dim)
 
@@ -97,18 +102,20 @@ past = [torch.randn(past_shape) for _ in range(12)]
 model_args = (
     input_ids,
     attention_mask,
+    position_ids,
     *past,
 )
 
 # --------------------------------------------------
 # Names and dynamic axes
 # --------------------------------------------------
-input_names = ["input_ids", "attention_mask"]
+input_names = ["input_ids", "attention_mask", "position_ids"]
 output_names = ["logits"]
 
 dynamic_axes = {
-    "input_ids": {0: "batch"},
-    "attention_mask": {0: "batch"},
+    "input_ids": {0: "batch", 1: "sequence"},
+    "attention_mask": {0: "batch", 1: "total_sequence"},
+    "position_ids": {0: "batch", 1: "sequence"},
     "logits": {0: "batch", 1: "sequence"},
 }
 
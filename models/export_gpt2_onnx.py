@@ -45,7 +45,7 @@ class GPT2ONNXWrapper(nn.Module):
         self.model = model
         self.num_layers = model.config.n_layer
 
-    def forward(self, input_ids, attention_mask, *past):
+    def forward(self, input_ids, attention_mask, position_ids, *past):
         past_key_values = tuple(
             (past[2 * i], past[2 * i + 1])
             for i in range(self.num_layers)
@@ -54,6 +54,7 @@ class GPT2ONNXWrapper(nn.Module):
         outputs = self.model(
             input_ids=input_ids,
             attention_mask=attention_mask,
+            position_ids=position_ids,
             past_key_values=past_key_values,
             use_cache=True,
         )
@@ -77,7 +78,9 @@ head_dim = model.config.n_embd // num_heads
 past_seq_len = 8  # dummy cache length
 
 input_ids = torch.ones((1, 1), dtype=torch.long)
-attention_mask = torch.ones((1, 1), dtype=torch.long)
+# Mask spans past + current tokens (total_sequence axis below).
+attention_mask = torch.ones((1, past_seq_len + 1), dtype=torch.long)
+position_ids = torch.full((1, 1), past_seq_len, dtype=torch.long)
 
 past_shape = (1, num_heads, past_seq_len, head_dim)
 
@@ -87,17 +90,18 @@ past_key_values = tuple(
 )
 
 flattened_past = tuple(t for layer in past_key_values for t in layer)
-model_args = (input_ids, attention_mask) + flattened_past
+model_args = (input_ids, attention_mask, position_ids) + flattened_past
 
 # ---------------------------------------------------------------------
 # ONNX IO names + dynamic axes
 # ---------------------------------------------------------------------
-input_names = ["input_ids", "attention_mask"]
+input_names = ["input_ids", "attention_mask", "position_ids"]
 output_names = ["logits"]
 
 dynamic_axes = {
-    "input_ids": {0: "batch"},
-    "attention_mask": {0: "batch"},
+    "input_ids": {0: "batch", 1: "sequence"},
+    "attention_mask": {0: "batch", 1: "total_sequence"},
+    "position_ids": {0: "batch", 1: "sequence"},
     "logits": {0: "batch", 1: "sequence"},
 }
 
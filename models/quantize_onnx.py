@@ -0,0 +1,186 @@
+"""INT8 dynamic quantization for the exported FP32 models.
+
+Writes <name>.int8.onnx next to the FP32 export and records both variants in the
+model registry (registry.json by default) with their size, session memory,
+single-request latency and an accuracy figure, so the gateway and services can
+pick a variant by name.
+
+    python quantize_onnx.py --name distilbert --fp32 distilbert.onnx --task classification
+    python quantize_onnx.py --name distilgpt2 --fp32 distilgpt2.onnx --task causal-lm \
+        --hf-model distilbert/distilgpt2
+"""
+import argparse
+import json
+import os
+import time
+from pathlib import Path
+
+import numpy as np
+import onnxruntime as ort
+from onnxruntime.quantization import QuantType, quantize_dynamic
+
+# --------------------------------------------------
+# Configuration
+# --------------------------------------------------
+DEFAULT_HF_MODELS = {
+    "classification": "distilbert/distilbert-base-uncased-finetuned-sst-2-english",
+    "causal-lm": "distilbert/distilgpt2",
+}
+CLASSIFICATION_LENGTHS = [32, 128, 512]
+CAUSAL_LENGTHS = [1, 32, 128]  # prefill lengths with an empty past
+LATENCY_RUNS = 20
+
+parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+parser.add_argument("--name", required=True, help="registry key, e.g. distilbert")
+parser.add_argument("--fp32", required=True, type=Path, help="FP32 ONNX export")
+parser.add_argument("--task", choices=["classification", "causal-lm"], default="classification")
+parser.add_argument("--hf-model", help="tokenizer/model id used for evaluation")
+parser.add_argument("--registry", type=Path, default=Path(os.environ.get("MODEL_REGISTRY", "registry.json")))
+parser.add_argument("--per-channel", action="store_true", help="per-channel weight scales (slower, more accurate)")
+parser.add_argument("--eval-samples", type=int, default=872, help="SST-2 validation sentences / prompts to score")
+parser.add_argument("--default", choices=["fp32", "int8"], default="fp32", help="variant served when none is named")
+args = parser.parse_args()
+
+hf_model = args.hf_model or DEFAULT_HF_MODELS[args.task]
+int8_path = args.fp32.with_name(args.fp32.stem + ".int8.onnx")
+
+
+# --------------------------------------------------
+# Quantize
+# --------------------------------------------------
+print(f"Quantizing {args.fp32} -> {int8_path}")
+quantize_dynamic(
+    model_input=str(args.fp32),
+    model_output=str(int8_path),
+    weight_type=QuantType.QInt8,
+    per_channel=args.per_channel,
+    # Only MatMuls against constant weights; activation x activation MatMuls
+    # (attention scores) stay FP32.
+    extra_options={"MatMulConstBOnly": True},
+)
+
+
+# --------------------------------------------------
+# Measurement helpers
+# --------------------------------------------------
+def rss_mb():
+    with open("/proc/self/status") as f:
+        for line in f:
+            if line.startswith("VmRSS:"):
+                return int(line.split()[1]) / 1024.0
+    return 0.0
+
+
+def open_session(path):
+    opts = ort.SessionOptions()
+    opts.intra_op_num_threads = 1
+    opts.graph_optimization_level = ort.GraphOptimizationLevel.ORT_ENABLE_ALL
+    before = rss_mb()
+    sess = ort.InferenceSession(str(path), opts, providers=["CPUExecutionProvider"])
+    return sess, rss_mb() - before
+
+
+def causal_feeds(sess, ids):
+    """Feeds for a prefill of `ids` with an empty past, shaped from the session's inputs."""
+    n = ids.shape[1]
+    feeds = {}
+    for inp in sess.get_inputs():
+        if inp.name == "input_ids":
+            feeds[inp.name] = ids
+        elif inp.name == "attention_mask":
+            feeds[inp.name] = np.ones((1, n), dtype=np.int64)
+        elif inp.name == "position_ids":
+            feeds[inp.name] = np.arange(n, dtype=np.int64)[None, :]
+        else:  # past.{i}.key / value: [batch, heads, past_sequence, head_dim]
+            _, heads, _, head_dim = inp.shape
+            feeds[inp.name] = np.zeros((1, heads, 0, head_dim), dtype=np.float32)
+    return feeds
+
+
+def classification_feeds(ids, mask):
+    return {"input_ids": ids, "attention_mask": mask}
+
+
+def latency_ms(sess, lengths):
+    out = {}
+    for n in lengths:
+        ids = np.full((1, n), 1000, dtype=np.int64)
+        if args.task == "classification":
+            feeds = classification_feeds(ids, np.ones_like(ids))
+        else:
+            feeds = causal_feeds(sess, ids)
+        sess.run(None, feeds)  # warm-up
+        samples = []
+        for _ in range(LATENCY_RUNS):
+            t0 = time.perf_counter()
+            sess.run(None, feeds)
+            samples.append((time.perf_counter() - t0) * 1000.0)
+        out[str(n)] = round(float(np.median(samples)), 3)
+    return out
+
+
+# --------------------------------------------------
+# Accuracy
+# --------------------------------------------------
+from transformers import AutoTokenizer  # noqa: E402
+
+tokenizer = AutoTokenizer.from_pretrained(hf_model)
+
+
+def sst2_accuracy(sess):
+    from datasets import load_dataset
+
+    data = load_dataset("glue", "sst2", split="validation").select(range(args.eval_samples))
+    correct = 0
+    for row in data:
+        enc = tokenizer(row["sentence"], return_tensors="np")
+        logits = sess.run(["logits"], classification_feeds(enc["input_ids"].astype(np.int64),
+                                                           enc["attention_mask"].astype(np.int64)))[0]
+        correct += int(np.argmax(logits[0]) == row["label"])
+    return {"metric": "sst2_accuracy", "value": round(correct / len(data), 4), "samples": len(data)}
+
+
+def next_token_predictions(sess):
+    prompts_file = Path(__file__).resolve().parent.parent / "data" / "prompts.json"
+    prompts = list(json.loads(prompts_file.read_text()).values())[: args.eval_samples]
+    preds = []
+    for text in prompts:
+        ids = tokenizer(text, return_tensors="np")["input_ids"].astype(np.int64)
+        for end in range(1, ids.shape[1] + 1):  # every prefix of the prompt
+            logits = sess.run(["logits"], causal_feeds(sess, ids[:, :end]))[0]
+            preds.append(int(np.argmax(logits[0, -1])))
+    return np.array(preds)
+
+
+# --------------------------------------------------
+# Measure both variants and update the registry
+# --------------------------------------------------
+variants = {}
+reference = None
+for name, path in [("fp32", args.fp32), ("int8", int8_path)]:
+    sess, session_mb = open_session(path)
+    entry = {
+        "path": os.path.relpath(path.resolve(), args.registry.resolve().parent),
+        "precision": name,
+        "size_mb": round(path.stat().st_size / 2**20, 1),
+        "session_rss_mb": round(session_mb, 1),
+        "latency_ms_p50": latency_ms(sess, CLASSIFICATION_LENGTHS if args.task == "classification" else CAUSAL_LENGTHS),
+    }
+    if args.task == "classification":
+        entry["accuracy"] = sst2_accuracy(sess)
+    else:
+        preds = next_token_predictions(sess)
+        if reference is None:
+            reference = preds
+        entry["accuracy"] = {"metric": "top1_agreement_vs_fp32",
+                             "value": round(float(np.mean(preds == reference)), 4),
+                             "samples": int(len(preds))}
+    if name == "int8":
+        entry["quantization"] = {"method": "dynamic", "weight_type": "QInt8", "per_channel": args.per_channel}
+    variants[name] = entry
+    print(f"{name}: {json.dumps(entry)}")
+
+registry = json.loads(args.registry.read_text()) if args.registry.exists() else {"models": {}}
+registry["models"][args.name] = {"task": args.task, "default": args.default, "variants": variants}
+args.registry.write_text(json.dumps(registry, indent=2) + "\n")
+print(f"Registry updated: {args.registry}")
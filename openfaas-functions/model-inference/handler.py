@@ -27,6 +27,8 @@ def handle(event, context):
         if not text.strip():
             return _resp(400, {"error": "missing non-empty 'text'"})
 
+        # Whether this call paid for loading the model, for cross-platform cold-start counts.
+        cold = _model is None
         tokenizer, model = _get_model()
 
         inputs = tokenizer(
@@ -51,6 +53,7 @@ def handle(event, context):
             "label": label,
             "score": float(score),
             "raw_logits": [float(x) for x in logits.tolist()],
+            "cold": cold,
         })
     except Exception as e:
         return _resp(500, {"error": str(e)})
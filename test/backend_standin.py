@@ -0,0 +1,75 @@
+"""Local stand-in for the Junction gateway, OpenFaaS or OpenWhisk, for dry runs of
+test/compare_backends.py without the real platforms.
+
+It answers with the response shape of the chosen platform, including how that
+platform reports cold starts. Latency is synthetic: --base-ms plus --per-token-ms per
+input token, plus --cold-ms whenever the previous request finished more than
+--keep-alive seconds ago (or there was none).
+
+    python test/backend_standin.py --kind openwhisk --port 30080 --cold-ms 800
+"""
+import argparse
+import json
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Serve a fake junction/openfaas/openwhisk endpoint.")
+    parser.add_argument("--kind", choices=("junction", "openfaas", "openwhisk"), required=True)
+    parser.add_argument("--host", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=8090)
+    parser.add_argument("--base-ms", type=float, default=5.0)
+    parser.add_argument("--per-token-ms", type=float, default=0.05)
+    parser.add_argument("--cold-ms", type=float, default=500.0)
+    parser.add_argument("--keep-alive", type=float, default=60.0, help="Idle seconds before the next request is cold")
+    args = parser.parse_args()
+
+    lock = threading.Lock()
+    state = {"last_done": None}
+
+    class Handler(BaseHTTPRequestHandler):
+        protocol_version = "HTTP/1.1"
+
+        def log_message(self, *_):
+            pass
+
+        def do_POST(self):
+            body = json.loads(self.rfile.read(int(self.headers.get("Content-Length", 0))) or b"{}")
+            tokens = len(body.get("input_ids", [])) or body.get("max_length") or body.get("context_tokens") or 0
+            with lock:
+                now = time.time()
+                cold = state["last_done"] is None or now - state["last_done"] > args.keep_alive
+                state["last_done"] = float("inf")  # busy: not idle until it finishes
+            delay_ms = args.base_ms + args.per_token_ms * tokens + (args.cold_ms if cold else 0.0)
+            time.sleep(delay_ms / 1000.0)
+            with lock:
+                state["last_done"] = time.time()
+
+            headers = {}
+            if args.kind == "junction":
+                out = {"logits": [0.1, 0.9]}
+                headers["X-Cold-Start"] = "1" if cold else "0"
+            elif args.kind == "openfaas":
+                out = {"label": "POSITIVE", "score": 0.9, "raw_logits": [0.1, 0.9], "cold": cold}
+            else:
+                out = {"activationId": "standin", "duration": int(delay_ms),
+                       "annotations": [{"key": "waitTime", "value": 1}]
+                       + ([{"key": "initTime", "value": int(args.cold_ms)}] if cold else []),
+                       "response": {"status": "success", "success": True, "result": {"label": "POSITIVE"}}}
+            data = json.dumps(out).encode()
+            self.send_response(200)
+            self.send_header("Content-Type", "application/json")
+            self.send_header("Content-Length", str(len(data)))
+            for k, v in headers.items():
+                self.send_header(k, v)
+            self.end_headers()
+            self.wfile.write(data)
+
+    print(f"{args.kind} stand-in on {args.host}:{args.port}", flush=True)
+    ThreadingHTTPServer((args.host, args.port), Handler).serve_forever()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,227 @@
+"""Replay one trace against several deployment paths and compare them side by side.
+
+Each --target runs trace_replay once, with the same trace, payloads, time scale and
+connection count; only the backend adapter differs (see
+junction-functions/common/backend_adapter.h). Targets run one after another so they
+do not compete for the host. Earlier results can be folded in with --from-csv: any
+trace_replay CSV, a test/results CSV from latency_test*.py, or an
+invocation/latency_ow_k8s.csv from invokepattern.py.
+
+The report has, per target: requests, successes, errors, offered and achieved
+throughput, latency percentiles of the successful requests, p99 again with the
+failed requests counted at their latency but no less than --timeout (p99_all_s), and
+the cold-start rate with cold vs. warm medians where the platform reports cold
+starts. A second table gives p99 per token bucket, failures included the same way. Both go to stdout and to <out-dir>/comparison.csv.
+
+    python test/compare_backends.py --trace data/trace.csv --payloads invocation/payloads.json \\
+        --target junction=junction:http://127.0.0.1:8080/infer_warm \\
+        --target faasd=openfaas:http://127.0.0.1:8081/function/model-inference \\
+        --target openwhisk=openwhisk:http://10.10.1.1:30080/api/v1/namespaces/_/actions/distilbert \\
+        --auth "$AUTH_KEY" --scale-time 0.1 --limit 2000
+
+test/backend_standin.py serves any of the three APIs locally for a dry run.
+"""
+import argparse
+import csv
+import math
+import subprocess
+import sys
+from collections import defaultdict
+from pathlib import Path
+
+KINDS = ("junction", "openfaas", "openwhisk")
+
+
+def parse_target(spec):
+    """LABEL=KIND:URL"""
+    label, sep, rest = spec.partition("=")
+    kind, sep2, url = rest.partition(":")
+    if not sep or not sep2 or kind not in KINDS or not url:
+        raise argparse.ArgumentTypeError(f"expected LABEL=KIND:URL with KIND one of {', '.join(KINDS)}: {spec}")
+    return label, kind, url
+
+
+def parse_csv_spec(spec):
+    label, sep, path = spec.partition("=")
+    if not sep or not path:
+        raise argparse.ArgumentTypeError(f"expected LABEL=PATH: {spec}")
+    return label, Path(path)
+
+
+def run_replay(args, label, kind, url):
+    out = args.out_dir / f"{label}.csv"
+    cmd = [
+        args.replay_bin, "--trace", args.trace, "--payloads", args.payloads, "--url", url,
+        "--backend", kind, "--out", str(out), "--connections", str(args.connections),
+        "--timeout", str(args.timeout), "--scale-time", str(args.scale_time),
+    ]
+    if args.limit is not None:
+        cmd += ["--limit", str(args.limit)]
+    if kind == "openwhisk":
+        if not args.auth:
+            sys.exit(f"{label}: openwhisk targets need --auth uuid:key")
+        cmd += ["--auth", args.auth]
+    print(f"== {label} ({kind}) {url}", flush=True)
+    subprocess.run(cmd, check=True)
+    return out
+
+
+def bucket_for_tokens(tokens):
+    """Same thresholds as bucket_for_tokens in junction-functions/common/trace_file.cpp."""
+    if tokens <= 256:
+        return "small"
+    if tokens <= 1000:
+        return "medium"
+    if tokens <= 4000:
+        return "large"
+    return "xl"
+
+
+def load_rows(path):
+    """Rows as (ts_seconds, bucket, ok, latency_s or None, cold or None).
+
+    invokepattern.py's bucket_id is a ContextTokens quartile ("1".."4"), not a
+    trace_replay bucket, so rows that carry context_tokens are re-binned by token
+    count to keep the per-bucket table comparable across sources.
+    """
+    rows = []
+    with open(path, newline="") as f:
+        for row in csv.DictReader(f):
+            ts = row.get("ts_seconds", row.get("rel_timestamp"))
+            bucket = row.get("bucket", row.get("bucket_id", ""))
+            if "bucket" not in row and row.get("context_tokens"):
+                bucket = bucket_for_tokens(float(row["context_tokens"]))
+            status = row.get("status", row.get("status_code", ""))
+            latency = row.get("latency_s", row.get("client_latency_sec", ""))
+            cold = row.get("cold", "")
+            ok = status.isdigit() and 200 <= int(status) < 300 and not row.get("error")
+            rows.append((
+                float(ts),
+                str(bucket),
+                ok,
+                float(latency) if latency else None,
+                int(cold) if cold in ("0", "1") else None,
+            ))
+    return rows
+
+
+def percentile(sorted_values, p):
+    if not sorted_values:
+        return float("nan")
+    k = max(0, min(len(sorted_values) - 1, math.ceil(p / 100.0 * len(sorted_values)) - 1))
+    return sorted_values[k]
+
+
+def with_failures(rows, timeout):
+    """Latencies of every row, a failure counted at no less than `timeout`.
+
+    A failed request's latency is missing (transport errors in older CSVs) or is
+    how long it took to fail; leaving it out would make an overloaded backend
+    look faster than one that answered everything slowly.
+    """
+    return sorted(
+        r[3] if r[2] else max(r[3] or 0.0, timeout) for r in rows if not r[2] or r[3] is not None
+    )
+
+
+def summarize(label, rows, timeout):
+    ok = sorted(r[3] for r in rows if r[2] and r[3] is not None)
+    every = with_failures(rows, timeout)
+    first = min(r[0] for r in rows)
+    span = max(r[0] for r in rows) - first
+    finished = [r[0] + r[3] for r in rows if r[3] is not None]
+    duration = (max(finished) - first) if finished else span
+    reported = [r for r in rows if r[2] and r[4] is not None]
+    cold = sorted(r[3] for r in reported if r[4] == 1)
+    warm = sorted(r[3] for r in reported if r[4] == 0)
+    return {
+        "target": label,
+        "requests": len(rows),
+        "ok": len(ok),
+        "errors": len(rows) - len(ok),
+        "offered_rps": len(rows) / span if span > 0 else float("nan"),
+        "achieved_rps": len(ok) / duration if duration > 0 else float("nan"),
+        "mean_s": sum(ok) / len(ok) if ok else float("nan"),
+        "p50_s": percentile(ok, 50),
+        "p90_s": percentile(ok, 90),
+        "p99_s": percentile(ok, 99),
+        "p99_all_s": percentile(every, 99),
+        "max_s": ok[-1] if ok else float("nan"),
+        "cold": len(cold) if reported else "",
+        "cold_rate": len(cold) / len(reported) if reported else "",
+        "cold_p50_s": percentile(cold, 50) if cold else "",
+        "warm_p50_s": percentile(warm, 50) if warm else "",
+    }
+
+
+def fmt(value):
+    if isinstance(value, float):
+        return f"{value:.4f}"
+    return str(value) if value != "" else "n/a"
+
+
+def print_table(header, rows):
+    cells = [header] + [[fmt(r[h]) for h in header] for r in rows]
+    widths = [max(len(c[i]) for c in cells) for i in range(len(header))]
+    for c in cells:
+        print("  ".join(v.rjust(w) for v, w in zip(c, widths)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Replay a trace against several backends and compare them.")
+    parser.add_argument("--target", type=parse_target, action="append", default=[],
+                        help="LABEL=KIND:URL, KIND one of junction, openfaas, openwhisk (repeatable)")
+    parser.add_argument("--from-csv", type=parse_csv_spec, action="append", default=[],
+                        help="LABEL=PATH of an existing results CSV to include (repeatable)")
+    parser.add_argument("--trace", default="data/trace.csv", help="Trace CSV/JSONL as trace_replay reads it")
+    parser.add_argument("--payloads", default="invocation/payloads.json", help="Output of test/make_payloads.py")
+    parser.add_argument("--replay-bin", default="junction-functions/build/trace_replay", help="trace_replay binary")
+    parser.add_argument("--auth", default=None, help="OpenWhisk auth key, uuid:key")
+    parser.add_argument("--out-dir", type=Path, default=Path("test/results/compare"), help="Per-target CSVs and the report")
+    parser.add_argument("--connections", type=int, default=32, help="trace_replay sender connections")
+    parser.add_argument("--timeout", type=float, default=30.0,
+                        help="Per-request timeout seconds; also the least latency a failure counts at")
+    parser.add_argument("--scale-time", type=float, default=1.0, help="Scale factor for inter-arrival times")
+    parser.add_argument("--limit", type=int, default=None, help="Optional limit on number of requests")
+    args = parser.parse_args()
+    if not args.target and not args.from_csv:
+        parser.error("give at least one --target or --from-csv")
+
+    args.out_dir.mkdir(parents=True, exist_ok=True)
+    sources = [(label, run_replay(args, label, kind, url)) for label, kind, url in args.target]
+    sources += args.from_csv
+
+    summaries = []
+    buckets = defaultdict(dict)
+    for label, path in sources:
+        rows = load_rows(path)
+        if not rows:
+            print(f"{label}: {path} has no rows, skipped", file=sys.stderr)
+            continue
+        summaries.append(summarize(label, rows, args.timeout))
+        per_bucket = defaultdict(list)
+        for r in rows:
+            per_bucket[r[1]].append(r)
+        for bucket, bucket_rows in per_bucket.items():
+            buckets[bucket][label] = percentile(with_failures(bucket_rows, args.timeout), 99)
+
+    if not summaries:
+        sys.exit("no results to compare")
+    header = list(summaries[0].keys())
+    print()
+    print_table(header, summaries)
+    labels = [s["target"] for s in summaries]
+    bucket_rows = [{"bucket": b, **{l: buckets[b].get(l, "") for l in labels}} for b in sorted(buckets)]
+    print("\np99_s per bucket, failures at no less than --timeout")
+    print_table(["bucket"] + labels, bucket_rows)
+
+    report = args.out_dir / "comparison.csv"
+    with open(report, "w", newline="") as f:
+        writer = csv.DictWriter(f, fieldnames=header)
+        writer.writeheader()
+        writer.writerows(summaries)
+    print(f"\nWrote {report}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,46 @@
+"""Pre-tokenize prompts.json into request bodies for the C++ trace_replay tool.
+
+trace_replay has no tokenizer, so it sends these bodies verbatim, one per bucket,
+exactly as latency_test.py would have built them on the fly. The prompt text is kept
+too, for the OpenFaaS and OpenWhisk backends, which tokenize on their side.
+"""
+import argparse
+import json
+from pathlib import Path
+
+from transformers import AutoTokenizer
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Tokenize prompts.json into per-bucket request bodies.")
+    parser.add_argument("--prompts", default="invocation/prompts.json", help="Path to prompts mapping")
+    parser.add_argument("--out", default="invocation/payloads.json", help="Where to write the bucket -> body JSON")
+    parser.add_argument("--no-truncation", action="store_true",
+                        help="Keep prompts past 512 tokens (distilbert_service windows them)")
+    args = parser.parse_args()
+
+    prompts = json.loads(Path(args.prompts).read_text())
+    cache_dir = (Path(__file__).resolve().parent.parent / "hf-cache").as_posix()
+    tokenizer = AutoTokenizer.from_pretrained(
+        "distilbert-base-uncased-finetuned-sst-2-english",
+        cache_dir=cache_dir,
+    )
+
+    payloads = {}
+    for bucket, prompt_text in prompts.items():
+        encoded = tokenizer(prompt_text, return_tensors="np", truncation=not args.no_truncation)
+        payloads[bucket] = {
+            "input_ids": encoded["input_ids"][0].tolist(),
+            "attention_mask": encoded["attention_mask"][0].tolist(),
+            "bucket": bucket,
+            "text": prompt_text,
+        }
+
+    out = Path(args.out)
+    out.parent.mkdir(parents=True, exist_ok=True)
+    out.write_text(json.dumps(payloads))
+    print(f"Wrote {out} with {len(payloads)} buckets")
+
+
+if __name__ == "__main__":
+    main()
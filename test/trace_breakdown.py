@@ -0,0 +1,86 @@
+"""Break the slowest requests down by stage from the span collector file.
+
+The gateway (--trace-file), distilbert_service and distilbert_infer append one JSON
+line per span to the same file. Grouped by trace_id, each request's spans show where
+its time went: gateway handler, junction_run exec or the warm call, queueing in the
+service, session.Run. With --replay, the slowest rows of a trace_replay CSV are
+picked by their client-side latency instead of the gateway span.
+"""
+import argparse
+import csv
+import json
+from collections import defaultdict
+
+
+def load_spans(path):
+    traces = defaultdict(list)
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if line:
+                span = json.loads(line)
+                traces[span["trace_id"]].append(span)
+    return traces
+
+
+def slowest_from_replay(path, top):
+    rows = []
+    with open(path, newline="") as f:
+        for row in csv.DictReader(f):
+            if row.get("trace_id") and row.get("latency_s"):
+                rows.append((float(row["latency_s"]), row["trace_id"]))
+    rows.sort(reverse=True)
+    return rows[:top]
+
+
+def print_trace(trace_id, spans, client_latency=None):
+    spans.sort(key=lambda s: s["start_ns"])
+    origin = spans[0]["start_ns"]
+    children = defaultdict(list)
+    ids = {s["span_id"] for s in spans}
+    roots = []
+    for s in spans:
+        (children[s["parent_id"]] if s["parent_id"] in ids else roots).append(s)
+
+    header = f"trace {trace_id}"
+    if client_latency is not None:
+        header += f"  client latency {client_latency * 1e3:.2f} ms"
+    print(header)
+
+    def walk(span, depth):
+        start_ms = (span["start_ns"] - origin) / 1e6
+        dur_ms = span["dur_ns"] / 1e6
+        print(f"  {'  ' * depth}{span['name']:<{32 - 2 * depth}} {span['service']:<20} "
+              f"+{start_ms:9.3f} ms  {dur_ms:9.3f} ms")
+        for child in children[span["span_id"]]:
+            walk(child, depth + 1)
+
+    for root in roots:
+        walk(root, 0)
+    print()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Per-stage breakdown of the slowest traced requests.")
+    parser.add_argument("spans", help="Span collector file (JSON lines)")
+    parser.add_argument("--replay", help="trace_replay output CSV with a trace_id column")
+    parser.add_argument("--top", type=int, default=5, help="How many of the slowest requests to show")
+    args = parser.parse_args()
+
+    traces = load_spans(args.spans)
+    if args.replay:
+        for latency, trace_id in slowest_from_replay(args.replay, args.top):
+            if trace_id in traces:
+                print_trace(trace_id, traces[trace_id], latency)
+            else:
+                print(f"trace {trace_id}: no spans recorded\n")
+        return
+
+    # Without client latencies, rank by the longest span of each trace (its root).
+    ranked = sorted(traces.items(), key=lambda kv: max(s["dur_ns"] for s in kv[1]), reverse=True)
+    for trace_id, spans in ranked[:args.top]:
+        print_trace(trace_id, spans)
+
+
+if __name__ == "__main__":
+    main()